@@ -0,0 +1,154 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AudioClockTimingSource.h"
+#include "Components/AudioComponent.h"
+#include "Sound/SoundSubmix.h"
+#include "Sound/SoundWave.h"
+#include "AudioDeviceManager.h"
+
+namespace AudioClockTimingSource
+{
+	/** Ring capacity in buffers (~1s at 1024-frame buffers / 48kHz) */
+	constexpr uint32 RenderSampleCapacity = 64;
+
+	/** Anchor error above which the song start is snapped instead of smoothed (seek, loop) */
+	constexpr double AnchorSnapThreshold = 0.05;
+
+	/** Smoothing factor for small anchor corrections */
+	constexpr double AnchorSmoothing = 0.1;
+}
+
+FAudioClockTimingSource::FAudioClockTimingSource()
+	: RenderSamples(AudioClockTimingSource::RenderSampleCapacity)
+{
+}
+
+bool FAudioClockTimingSource::Initialize(UAudioComponent* InSongComponent)
+{
+	check(IsInGameThread());
+
+	if (!InSongComponent)
+	{
+		return false;
+	}
+
+	FAudioDevice* AudioDevice = InSongComponent->GetAudioDevice();
+	if (!AudioDevice)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FAudioClockTimingSource: Audio component '%s' has no audio device"), *InSongComponent->GetName());
+		return false;
+	}
+
+	SongComponent = InSongComponent;
+	AudioDeviceHandle = FAudioDeviceManager::Get()->GetAudioDevice(AudioDevice->DeviceID);
+
+	// Listen on the main submix: every rendered buffer advances the audio clock
+	USoundSubmix& MainSubmix = AudioDevice->GetMainSubmixObject();
+	RegisteredSubmix = &MainSubmix;
+	AudioDevice->RegisterSubmixBufferListener(AsShared(), MainSubmix);
+
+	PlaybackPercentHandle = InSongComponent->OnAudioPlaybackPercentNative.AddSP(AsShared(), &FAudioClockTimingSource::HandlePlaybackPercent);
+
+	return true;
+}
+
+void FAudioClockTimingSource::Shutdown()
+{
+	if (UAudioComponent* Component = SongComponent.Get())
+	{
+		Component->OnAudioPlaybackPercentNative.Remove(PlaybackPercentHandle);
+	}
+	PlaybackPercentHandle.Reset();
+
+	if (FAudioDevice* AudioDevice = AudioDeviceHandle.GetAudioDevice())
+	{
+		if (USoundSubmix* Submix = RegisteredSubmix.Get())
+		{
+			AudioDevice->UnregisterSubmixBufferListener(AsShared(), *Submix);
+		}
+	}
+
+	AudioDeviceHandle.Reset();
+	RegisteredSubmix.Reset();
+	SongComponent.Reset();
+	bHasAudioClock = false;
+	bHasSongAnchor = false;
+}
+
+void FAudioClockTimingSource::OnNewSubmixBuffer(const USoundSubmix* OwningSubmix, float* AudioData, int32 NumSamples, int32 NumChannels, const int32 SampleRate, double AudioClock)
+{
+	// Audio render thread: no allocation, no locks
+	if (NumChannels <= 0 || SampleRate <= 0)
+	{
+		return;
+	}
+
+	FAudioClockSample Sample;
+	Sample.BufferSeconds = static_cast<double>(NumSamples / NumChannels) / SampleRate;
+	Sample.AudioClock = AudioClock + Sample.BufferSeconds;
+	Sample.PlatformSeconds = FPlatformTime::Seconds();
+
+	// If the game thread stalls the ring fills; dropping the newest sample only delays the next update
+	RenderSamples.Enqueue(Sample);
+}
+
+const FString& FAudioClockTimingSource::GetListenerName() const
+{
+	static const FString ListenerName(TEXT("UniversalBeatAudioClock"));
+	return ListenerName;
+}
+
+void FAudioClockTimingSource::DrainRenderSamples()
+{
+	FAudioClockSample Sample;
+	while (RenderSamples.Dequeue(Sample))
+	{
+		LatestSample = Sample;
+		bHasAudioClock = true;
+	}
+}
+
+void FAudioClockTimingSource::Tick()
+{
+	DrainRenderSamples();
+}
+
+void FAudioClockTimingSource::HandlePlaybackPercent(const UAudioComponent* InComponent, const USoundWave* InSoundWave, const float InPercent)
+{
+	DrainRenderSamples();
+
+	if (!bHasAudioClock || !InSoundWave)
+	{
+		return;
+	}
+
+	// Playback percent is reported for the buffer just rendered, pair it with the latest audio clock
+	const double WavePosition = static_cast<double>(InPercent) * InSoundWave->Duration;
+	const double MeasuredStart = LatestSample.AudioClock - WavePosition;
+
+	if (!bHasSongAnchor || FMath::Abs(MeasuredStart - SongStartAudioClock) > AudioClockTimingSource::AnchorSnapThreshold)
+	{
+		SongStartAudioClock = MeasuredStart;
+		LastReportedTime = 0.0;
+		bHasSongAnchor = true;
+	}
+	else
+	{
+		SongStartAudioClock += (MeasuredStart - SongStartAudioClock) * AudioClockTimingSource::AnchorSmoothing;
+	}
+}
+
+double FAudioClockTimingSource::GetTimeSeconds() const
+{
+	if (!IsReady())
+	{
+		return 0.0;
+	}
+
+	// Interpolate from the last rendered buffer, never past two buffers ahead of it
+	const double SinceRender = FMath::Clamp(FPlatformTime::Seconds() - LatestSample.PlatformSeconds, 0.0, LatestSample.BufferSeconds * 2.0);
+	const double SongTime = LatestSample.AudioClock + SinceRender - SongStartAudioClock;
+
+	LastReportedTime = FMath::Max(LastReportedTime, SongTime);
+	return LastReportedTime;
+}
@@ -0,0 +1,88 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BeatTimingSource.h"
+#include "AudioDevice.h"
+#include "Containers/CircularQueue.h"
+
+class UAudioComponent;
+class USoundWave;
+class USoundSubmix;
+
+/**
+ * Song-position timing source driven by the audio mixer render thread
+ *
+ * The render thread pushes (audio clock, platform time) pairs into a lock-free
+ * single-producer ring every submix buffer. The game thread drains the ring,
+ * anchors the song start against the song component's reported playback position,
+ * and interpolates between buffers with the platform clock.
+ */
+class FAudioClockTimingSource
+	: public IBeatTimingSource
+	, public ISubmixBufferListener
+	, public TSharedFromThis<FAudioClockTimingSource, ESPMode::ThreadSafe>
+{
+public:
+	FAudioClockTimingSource();
+
+	/**
+	 * Register with the component's audio device and start tracking its playback position.
+	 * @return False if the component has no audio device
+	 */
+	bool Initialize(UAudioComponent* InSongComponent);
+
+	// ~ IBeatTimingSource Interface
+	virtual double GetTimeSeconds() const override;
+	virtual bool IsSongPositionSource() const override { return true; }
+	virtual bool IsReady() const override { return bHasAudioClock && bHasSongAnchor; }
+	virtual void Tick() override;
+	virtual void Shutdown() override;
+	// ~ End IBeatTimingSource Interface
+
+	// ~ ISubmixBufferListener Interface (audio render thread)
+	virtual void OnNewSubmixBuffer(const USoundSubmix* OwningSubmix, float* AudioData, int32 NumSamples, int32 NumChannels, const int32 SampleRate, double AudioClock) override;
+	virtual const FString& GetListenerName() const override;
+	// ~ End ISubmixBufferListener Interface
+
+private:
+	/** One render-thread observation of the audio clock */
+	struct FAudioClockSample
+	{
+		/** Audio clock at the end of the rendered buffer */
+		double AudioClock = 0.0;
+
+		/** FPlatformTime::Seconds() when the buffer was rendered */
+		double PlatformSeconds = 0.0;
+
+		/** Duration of the buffer, used to bound interpolation */
+		double BufferSeconds = 0.0;
+	};
+
+	/** Pull all pending render-thread samples (game thread) */
+	void DrainRenderSamples();
+
+	/** Playback percent callback from the song component (game thread) */
+	void HandlePlaybackPercent(const UAudioComponent* InComponent, const USoundWave* InSoundWave, const float InPercent);
+
+	/** Render thread -> game thread ring (single producer, single consumer) */
+	TCircularQueue<FAudioClockSample> RenderSamples;
+
+	/** Most recent sample drained on the game thread */
+	FAudioClockSample LatestSample;
+
+	/** Audio clock value at which the song was at position 0 */
+	double SongStartAudioClock = 0.0;
+
+	/** Last value returned, keeps interpolation monotonic across buffer updates */
+	mutable double LastReportedTime = 0.0;
+
+	bool bHasAudioClock = false;
+	bool bHasSongAnchor = false;
+
+	TWeakObjectPtr<UAudioComponent> SongComponent;
+	TWeakObjectPtr<USoundSubmix> RegisteredSubmix;
+	FAudioDeviceHandle AudioDeviceHandle;
+	FDelegateHandle PlaybackPercentHandle;
+};
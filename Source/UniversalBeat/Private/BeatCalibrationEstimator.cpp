@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BeatCalibrationEstimator.h"
+#include "Algo/Sort.h"
+
+namespace
+{
+	/** Median of a sorted, non-empty range */
+	float SortedMedian(const TArrayView<const float> Sorted)
+	{
+		const int32 Middle = Sorted.Num() / 2;
+		return (Sorted.Num() % 2 != 0) ? Sorted[Middle] : 0.5f * (Sorted[Middle - 1] + Sorted[Middle]);
+	}
+}
+
+bool FBeatCalibrationEstimator::AddSample(float OffsetMs)
+{
+	if (!FMath::IsFinite(OffsetMs) || FMath::Abs(OffsetMs) > MaxSampleMs)
+	{
+		++NumRejected;
+		return false;
+	}
+
+	if (Num() >= MinSamplesForRejection)
+	{
+		const float Threshold = OutlierSigmas * FMath::Max(DeviationMs, MinDeviationMs);
+		if (FMath::Abs(OffsetMs - MedianMs) > Threshold)
+		{
+			if (ConsecutiveRejections < MaxConsecutiveRejections)
+			{
+				++NumRejected;
+				++ConsecutiveRejections;
+				return false;
+			}
+
+			// The player has moved on (new headphones, a different screen): what the window holds is stale
+			Samples.Reset();
+			NextSample = 0;
+		}
+	}
+	ConsecutiveRejections = 0;
+
+	if (Samples.Num() < MaxSamples)
+	{
+		Samples.Add(OffsetMs);
+	}
+	else
+	{
+		Samples[NextSample] = OffsetMs;
+		NextSample = (NextSample + 1) % MaxSamples;
+	}
+
+	Update();
+	return true;
+}
+
+void FBeatCalibrationEstimator::Reset()
+{
+	Samples.Reset();
+	NextSample = 0;
+	NumRejected = 0;
+	ConsecutiveRejections = 0;
+	MedianMs = 0.0f;
+	DeviationMs = 0.0f;
+	EstimateMs = 0.0f;
+}
+
+float FBeatCalibrationEstimator::GetStandardErrorMs() const
+{
+	if (Num() < 2)
+	{
+		return TNumericLimits<float>::Max();
+	}
+	return FMath::Max(DeviationMs, MinDeviationMs) / FMath::Sqrt(static_cast<float>(Num()));
+}
+
+void FBeatCalibrationEstimator::Update()
+{
+	TArray<float, TFixedAllocator<MaxSamples>> Sorted(Samples);
+	Algo::Sort(Sorted);
+	MedianMs = SortedMedian(Sorted);
+
+	TArray<float, TFixedAllocator<MaxSamples>> Deviations;
+	for (const float Sample : Sorted)
+	{
+		Deviations.Add(FMath::Abs(Sample - MedianMs));
+	}
+	Algo::Sort(Deviations);
+
+	// Scaled so it matches the standard deviation for normally distributed taps
+	DeviationMs = 1.4826f * SortedMedian(Deviations);
+
+	const int32 NumTrimmed = FMath::Min(FMath::FloorToInt32(Sorted.Num() * FMath::Clamp(TrimFraction, 0.0f, 0.49f)), (Sorted.Num() - 1) / 2);
+	double Sum = 0.0;
+	for (int32 Index = NumTrimmed; Index < Sorted.Num() - NumTrimmed; ++Index)
+	{
+		Sum += Sorted[Index];
+	}
+	EstimateMs = static_cast<float>(Sum / (Sorted.Num() - 2 * NumTrimmed));
+}
@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BeatClock.h"
+
+void FBeatClock::Start(double InAnchorSeconds, float InBPM, int32 InTicksPerBeat, double InStartBeat)
+{
+	AnchorSeconds = InAnchorSeconds;
+	BeatAtAnchor = InStartBeat;
+	SecondsPerBeat = InBPM > 0.0f ? 60.0 / InBPM : 0.5;
+	TicksPerBeat = FMath::Max(InTicksPerBeat, 1);
+	PausedAtSeconds = InAnchorSeconds;
+	bStarted = true;
+	bPaused = false;
+}
+
+void FBeatClock::Stop()
+{
+	bStarted = false;
+	bPaused = false;
+	BeatAtAnchor = 0.0;
+}
+
+void FBeatClock::SetBPM(double InTimeSeconds, float InBPM)
+{
+	if (InBPM <= 0.0f)
+	{
+		return;
+	}
+
+	if (bStarted)
+	{
+		// Re-anchor at the change point so the beat position stays continuous
+		const double CurrentBeat = GetBeatPosition(InTimeSeconds);
+		AnchorSeconds = (bPaused ? PausedAtSeconds : InTimeSeconds) - OffsetSeconds;
+		BeatAtAnchor = CurrentBeat;
+	}
+
+	SecondsPerBeat = 60.0 / InBPM;
+}
+
+void FBeatClock::Pause(double InTimeSeconds)
+{
+	if (!bPaused)
+	{
+		PausedAtSeconds = InTimeSeconds;
+		bPaused = true;
+	}
+}
+
+void FBeatClock::Resume(double InTimeSeconds)
+{
+	if (bPaused)
+	{
+		AnchorSeconds += InTimeSeconds - PausedAtSeconds;
+		bPaused = false;
+	}
+}
+
+void FBeatClock::Rebase(double InOldDomainNow, double InNewDomainNow)
+{
+	const double Delta = InNewDomainNow - InOldDomainNow;
+	AnchorSeconds += Delta;
+	PausedAtSeconds += Delta;
+}
@@ -0,0 +1,63 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BeatInputPreprocessor.h"
+#include "Input/Events.h"
+
+bool FBeatInputPreprocessor::HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	// Auto-repeat is not a new press
+	if (!InKeyEvent.IsRepeat())
+	{
+		RecordPress(InKeyEvent.GetKey());
+	}
+	return false;
+}
+
+bool FBeatInputPreprocessor::HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+	RecordPress(MouseEvent.GetEffectingButton());
+	return false;
+}
+
+bool FBeatInputPreprocessor::HandleMouseButtonDoubleClickEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+	// The second click of a double click arrives here instead of as a button down
+	RecordPress(MouseEvent.GetEffectingButton());
+	return false;
+}
+
+bool FBeatInputPreprocessor::HandleKeyUpEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	RecordRelease(InKeyEvent.GetKey());
+	return false;
+}
+
+bool FBeatInputPreprocessor::HandleMouseButtonUpEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+	RecordRelease(MouseEvent.GetEffectingButton());
+	return false;
+}
+
+double FBeatInputPreprocessor::GetLastPressTime(const FKey& Key) const
+{
+	const double* PressTime = LastPressTimes.Find(Key);
+	return PressTime ? *PressTime : 0.0;
+}
+
+double FBeatInputPreprocessor::GetLastReleaseTime(const FKey& Key) const
+{
+	const double* ReleaseTime = LastReleaseTimes.Find(Key);
+	return ReleaseTime ? *ReleaseTime : 0.0;
+}
+
+void FBeatInputPreprocessor::RecordPress(const FKey& Key)
+{
+	const double Now = FPlatformTime::Seconds();
+	LastPressTimes.Add(Key, Now);
+	LastAnyPressTime = Now;
+}
+
+void FBeatInputPreprocessor::RecordRelease(const FKey& Key)
+{
+	LastReleaseTimes.Add(Key, FPlatformTime::Seconds());
+}
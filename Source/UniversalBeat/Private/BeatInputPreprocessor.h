@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Framework/Application/IInputProcessor.h"
+#include "InputCoreTypes.h"
+
+/**
+ * Slate input preprocessor that stamps key and button presses and releases
+ *
+ * Runs when Slate routes the platform message, before widgets, the player controller
+ * or Enhanced Input see the press. The recorded FPlatformTime::Seconds() values can be
+ * passed to the *AtTime timing checks so judgement does not include game-thread dispatch
+ * latency. Never consumes input.
+ */
+class FBeatInputPreprocessor : public IInputProcessor
+{
+public:
+	// ~ IInputProcessor Interface
+	virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override {}
+	virtual bool HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) override;
+	virtual bool HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+	virtual bool HandleMouseButtonDoubleClickEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+	virtual bool HandleKeyUpEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) override;
+	virtual bool HandleMouseButtonUpEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+	virtual const TCHAR* GetDebugName() const override { return TEXT("UniversalBeatInput"); }
+
+	/** Platform time of the latest press of a key, 0 if it was never pressed */
+	double GetLastPressTime(const FKey& Key) const;
+
+	/** Platform time of the latest release of a key, 0 if it was never released */
+	double GetLastReleaseTime(const FKey& Key) const;
+
+	/** Platform time of the latest press of any key or button, 0 if nothing was pressed */
+	double GetLastAnyPressTime() const { return LastAnyPressTime; }
+
+private:
+	void RecordPress(const FKey& Key);
+	void RecordRelease(const FKey& Key);
+
+	/** Latest press time per key (the set of keys a game uses is small) */
+	TMap<FKey, double> LastPressTimes;
+
+	/** Latest release time per key */
+	TMap<FKey, double> LastReleaseTimes;
+
+	double LastAnyPressTime = 0.0;
+};
@@ -0,0 +1,411 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BeatReplay.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/StringBuilder.h"
+#include "Serialization/Archive.h"
+
+namespace BeatReplay
+{
+	/** Longest encoded event: header, escaped palette index, timestamp delta, float payload */
+	static constexpr int32 MaxEventBytes = 1 + 10 + 10 + sizeof(float);
+
+	/** Longest palette name accepted by the reader */
+	static constexpr uint64 MaxNameBytes = NAME_SIZE;
+
+	FORCEINLINE int32 WriteVarint(uint8* Out, uint64 Value)
+	{
+		int32 NumBytes = 0;
+		while (Value >= 0x80)
+		{
+			Out[NumBytes++] = static_cast<uint8>(Value) | 0x80;
+			Value >>= 7;
+		}
+		Out[NumBytes++] = static_cast<uint8>(Value);
+		return NumBytes;
+	}
+
+	FORCEINLINE uint64 ZigZag(int64 Value) { return (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63); }
+	FORCEINLINE int64 UnZigZag(uint64 Value) { return static_cast<int64>(Value >> 1) ^ -static_cast<int64>(Value & 1); }
+	FORCEINLINE int64 ToTicks(double Seconds) { return FMath::RoundToInt64(Seconds * TicksPerSecond); }
+}
+
+// ====================================================================
+// FBeatReplayRecorder
+// ====================================================================
+
+FBeatReplayRecorder::~FBeatReplayRecorder()
+{
+	Stop();
+}
+
+bool FBeatReplayRecorder::Start(const FString& Filename, double ClockTime, float BPM, float CalibrationOffsetMs)
+{
+	Stop();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Filename));
+	FileSink.Reset(PlatformFile.OpenWrite(*Filename));
+	if (!FileSink)
+	{
+		return false;
+	}
+
+	MemorySink.Reset();
+	Open(ClockTime, BPM, CalibrationOffsetMs, DefaultCapacity);
+	return true;
+}
+
+void FBeatReplayRecorder::StartInMemory(double ClockTime, float BPM, float CalibrationOffsetMs)
+{
+	Stop();
+	MemorySink.Reset();
+	Open(ClockTime, BPM, CalibrationOffsetMs, DefaultCapacity);
+}
+
+void FBeatReplayRecorder::Open(double ClockTime, float BPM, float CalibrationOffsetMs, int32 Capacity)
+{
+	Ring.SetNumUninitialized(FMath::RoundUpToPowerOfTwo(Capacity));
+	RingMask = Ring.Num() - 1;
+	WritePosition = 0;
+	FlushedPosition.store(0, std::memory_order_relaxed);
+	FlushRequestedPosition = 0;
+	NamePalette.Reset(BeatReplay::InlineNameLimit);
+	StartClockTime = ClockTime;
+	LastChartTicks = 0;
+	LastClockTicks = 0;
+	NumDroppedEvents = 0;
+	bRecording = true;
+
+	// Same layout FBeatReplayReader reads with FArchive operators
+	uint8 Header[16];
+	const uint32 Magic = BeatReplay::Magic;
+	const uint16 Version = BeatReplay::Version;
+	const uint16 Flags = 0;
+	FMemory::Memcpy(Header + 0, &Magic, sizeof(Magic));
+	FMemory::Memcpy(Header + 4, &Version, sizeof(Version));
+	FMemory::Memcpy(Header + 6, &Flags, sizeof(Flags));
+	FMemory::Memcpy(Header + 8, &BPM, sizeof(BPM));
+	FMemory::Memcpy(Header + 12, &CalibrationOffsetMs, sizeof(CalibrationOffsetMs));
+	Append(Header, sizeof(Header));
+}
+
+void FBeatReplayRecorder::Stop()
+{
+	if (!bRecording)
+	{
+		return;
+	}
+
+	FlushTask.Wait();
+	WriteToSink(FlushedPosition.load(std::memory_order_acquire), WritePosition);
+	FlushedPosition.store(WritePosition, std::memory_order_release);
+
+	if (FileSink)
+	{
+		FileSink->Flush();
+		FileSink.Reset();
+	}
+	Ring.Empty();
+	bRecording = false;
+}
+
+void FBeatReplayRecorder::RecordNamed(EBeatReplayEventType Type, FName Name, double Seconds, int64& LastTicks)
+{
+	if (!bRecording)
+	{
+		return;
+	}
+
+	int32 NameIndex = NamePalette.IndexOfByKey(Name);
+	if (NameIndex == INDEX_NONE)
+	{
+		// First use of a name: define it in the stream (once per tag or label, not per input)
+		TStringBuilder<NAME_SIZE> NameString;
+		Name.AppendString(NameString);
+		const FTCHARToUTF8 Utf8(NameString.ToString(), NameString.Len());
+
+		uint8 Definition[1 + 10];
+		Definition[0] = BeatReplay::ControlKind | (BeatReplay::DefineNameCode << 2);
+		const int32 DefinitionBytes = 1 + BeatReplay::WriteVarint(Definition + 1, Utf8.Length());
+
+		const uint64 Needed = DefinitionBytes + Utf8.Length() + BeatReplay::MaxEventBytes;
+		if (WritePosition + Needed - FlushedPosition.load(std::memory_order_acquire) > static_cast<uint64>(Ring.Num()))
+		{
+			++NumDroppedEvents;
+			return;
+		}
+		Append(Definition, DefinitionBytes);
+		Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		NameIndex = NamePalette.Add(Name);
+	}
+
+	uint8 Bytes[BeatReplay::MaxEventBytes];
+	int32 NumBytes = 0;
+	Bytes[NumBytes++] = static_cast<uint8>(Type) | (static_cast<uint8>(FMath::Min(NameIndex, BeatReplay::InlineNameLimit)) << 2);
+	if (NameIndex >= BeatReplay::InlineNameLimit)
+	{
+		NumBytes += BeatReplay::WriteVarint(Bytes + NumBytes, NameIndex);
+	}
+
+	const int64 Ticks = BeatReplay::ToTicks(Seconds);
+	NumBytes += BeatReplay::WriteVarint(Bytes + NumBytes, BeatReplay::ZigZag(Ticks - LastTicks));
+	if (Append(Bytes, NumBytes))
+	{
+		LastTicks = Ticks;
+	}
+}
+
+void FBeatReplayRecorder::RecordControl(EBeatReplayEventType Type, double ClockTime, const float* Value)
+{
+	if (!bRecording)
+	{
+		return;
+	}
+
+	const uint8 Code = static_cast<uint8>(Type) - static_cast<uint8>(EBeatReplayEventType::PassStart);
+
+	uint8 Bytes[BeatReplay::MaxEventBytes];
+	int32 NumBytes = 0;
+	Bytes[NumBytes++] = BeatReplay::ControlKind | (Code << 2);
+
+	const int64 Ticks = BeatReplay::ToTicks(ClockTime - StartClockTime);
+	NumBytes += BeatReplay::WriteVarint(Bytes + NumBytes, BeatReplay::ZigZag(Ticks - LastClockTicks));
+	if (Value)
+	{
+		FMemory::Memcpy(Bytes + NumBytes, Value, sizeof(float));
+		NumBytes += sizeof(float);
+	}
+
+	if (Append(Bytes, NumBytes))
+	{
+		LastClockTicks = Ticks;
+	}
+}
+
+bool FBeatReplayRecorder::Append(const uint8* Bytes, int32 NumBytes)
+{
+	// Never overwrite bytes the flusher has not written out yet
+	const uint64 Capacity = Ring.Num();
+	if (WritePosition + NumBytes - FlushedPosition.load(std::memory_order_acquire) > Capacity)
+	{
+		++NumDroppedEvents;
+		return false;
+	}
+
+	const int32 Offset = static_cast<int32>(WritePosition & RingMask);
+	const int32 FirstPart = FMath::Min(NumBytes, static_cast<int32>(Capacity) - Offset);
+	FMemory::Memcpy(Ring.GetData() + Offset, Bytes, FirstPart);
+	FMemory::Memcpy(Ring.GetData(), Bytes + FirstPart, NumBytes - FirstPart);
+	WritePosition += NumBytes;
+
+	if (WritePosition - FlushRequestedPosition >= FlushThreshold)
+	{
+		KickFlush();
+	}
+	return true;
+}
+
+void FBeatReplayRecorder::KickFlush()
+{
+	if (!FlushTask.IsCompleted())
+	{
+		return;
+	}
+
+	const uint64 Begin = FlushRequestedPosition;
+	const uint64 End = WritePosition;
+	FlushRequestedPosition = End;
+	FlushTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, Begin, End]()
+	{
+		WriteToSink(Begin, End);
+		FlushedPosition.store(End, std::memory_order_release);
+	}, LowLevelTasks::ETaskPriority::BackgroundNormal);
+}
+
+void FBeatReplayRecorder::WriteToSink(uint64 Begin, uint64 End)
+{
+	while (Begin < End)
+	{
+		// At most two runs: up to the end of the ring, then from its start
+		const int32 Offset = static_cast<int32>(Begin & RingMask);
+		const int32 RunBytes = static_cast<int32>(FMath::Min<uint64>(End - Begin, Ring.Num() - Offset));
+		if (FileSink)
+		{
+			FileSink->Write(Ring.GetData() + Offset, RunBytes);
+		}
+		else
+		{
+			MemorySink.Append(Ring.GetData() + Offset, RunBytes);
+		}
+		Begin += RunBytes;
+	}
+}
+
+// ====================================================================
+// FBeatReplayReader
+// ====================================================================
+
+FBeatReplayReader::FBeatReplayReader(FArchive& InArchive)
+	: Archive(InArchive)
+{
+	uint32 FileMagic = 0;
+	uint16 FileVersion = 0;
+	uint16 Flags = 0;
+	Archive << FileMagic << FileVersion << Flags << StartBPM << StartCalibrationOffsetMs;
+	bValid = !Archive.IsError() && FileMagic == BeatReplay::Magic && FileVersion == BeatReplay::Version;
+	CurrentBPM = StartBPM;
+	CurrentCalibrationOffsetMs = StartCalibrationOffsetMs;
+}
+
+bool FBeatReplayReader::ReadVarint(uint64& OutValue)
+{
+	OutValue = 0;
+	for (int32 Shift = 0; Shift < 64; Shift += 7)
+	{
+		uint8 Byte = 0;
+		Archive << Byte;
+		if (Archive.IsError())
+		{
+			return false;
+		}
+		OutValue |= static_cast<uint64>(Byte & 0x7F) << Shift;
+		if ((Byte & 0x80) == 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FBeatReplayReader::ReadSignedDelta(int64& InOutTicks)
+{
+	uint64 Encoded = 0;
+	if (!ReadVarint(Encoded))
+	{
+		return false;
+	}
+	InOutTicks += BeatReplay::UnZigZag(Encoded);
+	return true;
+}
+
+bool FBeatReplayReader::ReadEvent(FBeatReplayEvent& OutEvent)
+{
+	if (PendingEvent.IsSet())
+	{
+		OutEvent = PendingEvent.GetValue();
+		PendingEvent.Reset();
+		return true;
+	}
+
+	while (bValid && !Archive.AtEnd())
+	{
+		uint8 Header = 0;
+		Archive << Header;
+		const uint8 Kind = Header & 0x03;
+		uint64 Code = Header >> 2;
+
+		if (Kind == BeatReplay::ControlKind)
+		{
+			if (Code == BeatReplay::DefineNameCode)
+			{
+				uint64 NumBytes = 0;
+				if (!ReadVarint(NumBytes) || NumBytes > BeatReplay::MaxNameBytes)
+				{
+					bValid = false;
+					break;
+				}
+
+				TArray<ANSICHAR, TInlineAllocator<256>> Utf8;
+				Utf8.SetNumUninitialized(static_cast<int32>(NumBytes));
+				Archive.Serialize(Utf8.GetData(), Utf8.Num());
+				const FUTF8ToTCHAR Converted(Utf8.GetData(), Utf8.Num());
+				const FName Name(Converted.Length(), Converted.Get());
+				NamePalette.Add(Name);
+				TagPalette.Add(FGameplayTag::RequestGameplayTag(Name, false));
+				continue;
+			}
+
+			if (Code > static_cast<uint8>(EBeatReplayEventType::CalibrationChange) - static_cast<uint8>(EBeatReplayEventType::PassStart)
+				|| !ReadSignedDelta(LastClockTicks))
+			{
+				bValid = false;
+				break;
+			}
+
+			OutEvent.Type = static_cast<EBeatReplayEventType>(static_cast<uint8>(EBeatReplayEventType::PassStart) + Code);
+			OutEvent.Time = LastClockTicks / BeatReplay::TicksPerSecond;
+			OutEvent.Name = NAME_None;
+			OutEvent.Value = 0.0f;
+			if (OutEvent.Type == EBeatReplayEventType::TempoChange)
+			{
+				Archive << OutEvent.Value;
+				CurrentBPM = OutEvent.Value;
+			}
+			else if (OutEvent.Type == EBeatReplayEventType::CalibrationChange)
+			{
+				Archive << OutEvent.Value;
+				CurrentCalibrationOffsetMs = OutEvent.Value;
+			}
+			bValid = !Archive.IsError();
+			return bValid;
+		}
+
+		if (Code == BeatReplay::InlineNameLimit && !ReadVarint(Code))
+		{
+			bValid = false;
+			break;
+		}
+		const EBeatReplayEventType Type = static_cast<EBeatReplayEventType>(Kind);
+		if (!NamePalette.IsValidIndex(static_cast<int32>(Code))
+			|| !ReadSignedDelta(Type == EBeatReplayEventType::BeatCheck ? LastClockTicks : LastChartTicks))
+		{
+			bValid = false;
+			break;
+		}
+
+		LastNameIndex = static_cast<int32>(Code);
+		OutEvent.Type = Type;
+		OutEvent.Time = (Type == EBeatReplayEventType::BeatCheck ? LastClockTicks : LastChartTicks) / BeatReplay::TicksPerSecond;
+		OutEvent.Name = NamePalette[LastNameIndex];
+		OutEvent.Value = 0.0f;
+		return true;
+	}
+
+	return false;
+}
+
+bool FBeatReplayReader::ReadPass(TArray<FBeatInputEvent>& OutInputs)
+{
+	OutInputs.Reset();
+
+	bool bInPass = false;
+	FBeatReplayEvent Event;
+	while (ReadEvent(Event))
+	{
+		switch (Event.Type)
+		{
+		case EBeatReplayEventType::PassStart:
+			if (bInPass)
+			{
+				// Belongs to the next pass
+				PendingEvent = Event;
+				return true;
+			}
+			bInPass = true;
+			break;
+
+		case EBeatReplayEventType::Press:
+		case EBeatReplayEventType::Release:
+			OutInputs.Emplace(TagPalette[LastNameIndex], Event.Time, Event.Type == EBeatReplayEventType::Release);
+			bInPass = true;
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	return bInPass;
+}
@@ -0,0 +1,62 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BeatSession.h"
+#include "Algo/StableSort.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+void FBeatSession::SetChart(const TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe>& InChart)
+{
+	Chart = InChart;
+	if (Chart)
+	{
+		State.Init(*Chart);
+		NoteAssets = Chart->NoteAssets;
+	}
+	else
+	{
+		State.Empty();
+		NoteAssets.Empty();
+	}
+}
+
+void FBeatSession::Evaluate()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FBeatSession::Evaluate);
+
+	// Swap so the queue keeps its allocation for the next frame
+	Swap(JudgedInputs, PendingInputs);
+	PendingInputs.Reset();
+
+	Results.Reset(JudgedInputs.Num());
+	Results.AddDefaulted(JudgedInputs.Num());
+	NumHits = 0;
+
+	if (!Chart || JudgedInputs.Num() == 0)
+	{
+		return;
+	}
+
+	// Network inputs can arrive out of order; judge them in the order they happened
+	TArray<int32, TInlineAllocator<64>> Order;
+	Order.SetNumUninitialized(JudgedInputs.Num());
+	bool bSorted = true;
+	for (int32 InputIndex = 0; InputIndex < JudgedInputs.Num(); ++InputIndex)
+	{
+		Order[InputIndex] = InputIndex;
+		bSorted &= InputIndex == 0 || JudgedInputs[InputIndex - 1].Timestamp <= JudgedInputs[InputIndex].Timestamp;
+	}
+	if (!bSorted)
+	{
+		Algo::StableSortBy(Order, [this](int32 InputIndex) { return JudgedInputs[InputIndex].Timestamp; });
+	}
+
+	for (const int32 InputIndex : Order)
+	{
+		const FBeatInputEvent& Input = JudgedInputs[InputIndex];
+		const double ChartTime = Input.Timestamp - CalibrationOffsetSeconds;
+		Results[InputIndex] = Input.bIsRelease
+			? NoteJudgement::JudgeRelease(*Chart, State, Input.InputTag, ChartTime)
+			: NoteJudgement::JudgeInput(*Chart, State, Input.InputTag, ChartTime);
+		NumHits += Results[InputIndex].IsHit() ? 1 : 0;
+	}
+}
@@ -0,0 +1,210 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BeatSimulation.h"
+#include "CookedSongChart.h"
+#include "SongConfiguration.h"
+#include "LevelSequence.h"
+#include "Algo/IsSorted.h"
+#include "Algo/StableSort.h"
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+namespace
+{
+	/** Standard normal sample (Box-Muller), two draws from the stream */
+	float StandardNormal(const FRandomStream& Random)
+	{
+		const float U1 = FMath::Max(Random.GetFraction(), UE_SMALL_NUMBER);
+		const float U2 = Random.GetFraction();
+		return FMath::Sqrt(-2.0f * FMath::Loge(U1)) * FMath::Cos(UE_TWO_PI * U2);
+	}
+
+	void TallyJudgement(const FNoteJudgement& Judgement, FBeatSimulationSummary& Summary)
+	{
+		if (Judgement.bHoldEnd)
+		{
+			Summary.NumHoldsCompleted += Judgement.IsHit() ? 1 : 0;
+			Summary.NumHoldsDropped += Judgement.bDropped ? 1 : 0;
+		}
+		else if (Judgement.IsHit())
+		{
+			++Summary.NumHits;
+			Summary.AccuracySum += Judgement.Accuracy;
+		}
+	}
+}
+
+void FBeatSimulation::Run()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FBeatSimulation::Run);
+
+	Summary = FBeatSimulationSummary();
+	Summary.NumInputs = Inputs.Num();
+	Results.Reset(Inputs.Num());
+	Results.AddDefaulted(Inputs.Num());
+	CompletedHolds.Reset();
+
+	if (!Chart)
+	{
+		State.Empty();
+		return;
+	}
+	State.Init(*Chart);
+
+	// Recorded streams are already in order; only generated or merged ones need the sort
+	if (!Algo::IsSortedBy(Inputs, &FBeatInputEvent::Timestamp))
+	{
+		Algo::StableSortBy(Inputs, &FBeatInputEvent::Timestamp);
+	}
+
+	for (int32 InputIndex = 0; InputIndex < Inputs.Num(); ++InputIndex)
+	{
+		const FBeatInputEvent& Input = Inputs[InputIndex];
+		if (!Input.InputTag.IsValid())
+		{
+			continue;
+		}
+
+		// The clock jumps to the input: what a frame of live play would have settled by then goes first
+		const double ChartTime = Input.Timestamp - CalibrationOffsetSeconds;
+		NoteJudgement::CompleteHolds(*Chart, State, ChartTime, &CompletedHolds);
+		NoteJudgement::SweepMisses(*Chart, State, ChartTime);
+
+		Results[InputIndex] = Input.bIsRelease
+			? NoteJudgement::JudgeRelease(*Chart, State, Input.InputTag, ChartTime)
+			: NoteJudgement::JudgeInput(*Chart, State, Input.InputTag, ChartTime);
+		TallyJudgement(Results[InputIndex], Summary);
+	}
+
+	// Play out the rest of the chart, as the end of a pass does
+	NoteJudgement::CompleteHolds(*Chart, State, TNumericLimits<double>::Max(), &CompletedHolds);
+	NoteJudgement::SweepMisses(*Chart, State, TNumericLimits<double>::Max());
+
+	for (const FNoteJudgement& Completed : CompletedHolds)
+	{
+		TallyJudgement(Completed, Summary);
+	}
+	Summary.NumMissed = State.NumMissed;
+}
+
+void FBeatSimulation::GetValidationResults(TArray<FNoteValidationResult>& OutResults) const
+{
+	OutResults.Reset(Inputs.Num());
+	for (int32 InputIndex = 0; InputIndex < Inputs.Num(); ++InputIndex)
+	{
+		const FBeatInputEvent& Input = Inputs[InputIndex];
+
+		// Same fields, in the same order, as CheckBeatTimingBatch fills them
+		FNoteValidationResult& Result = OutResults.AddDefaulted_GetRef();
+		Result.NoteTag = Input.InputTag;
+		Result.InputTimestamp = Input.Timestamp;
+		if (Chart && Input.InputTag.IsValid() && Results.IsValidIndex(InputIndex))
+		{
+			NoteJudgement::FillValidationResult(*Chart, Results[InputIndex], Result);
+		}
+	}
+}
+
+namespace BeatSimulation
+{
+	void MakeAutoplayInputs(const FCompiledNoteChart& Chart, const FBeatAutoplayPolicy& Policy, TArray<FBeatInputEvent>& OutInputs)
+	{
+		OutInputs.Reset(Chart.Num());
+
+		FRandomStream Random(Policy.Seed);
+		for (int32 NoteIndex = 0; NoteIndex < Chart.Num(); ++NoteIndex)
+		{
+			// Every note draws the same numbers, so changing one chance does not reshuffle the others
+			const float MissRoll = Random.GetFraction();
+			const float DropRoll = Random.GetFraction();
+			const float DropPoint = Random.GetFraction();
+			const float TimingError = Policy.TimingBiasSeconds + Policy.TimingErrorSeconds * StandardNormal(Random);
+
+			if (MissRoll < Policy.MissChance)
+			{
+				continue;
+			}
+
+			const FGameplayTag& NoteTag = Chart.GetNoteTag(NoteIndex);
+			const double InputTime = Chart.NoteSeconds[NoteIndex] + TimingError;
+			if (Chart.GetInteractionType(NoteIndex) == ENoteInteractionType::Release)
+			{
+				OutInputs.Emplace(NoteTag, InputTime, true);
+				continue;
+			}
+
+			OutInputs.Emplace(NoteTag, InputTime);
+
+			// Completed holds need no release: the sustain end completes them
+			if (Chart.IsSustained(NoteIndex) && DropRoll < Policy.DropHoldChance)
+			{
+				const double Sustain = Chart.NoteEndSeconds[NoteIndex] - Chart.NoteSeconds[NoteIndex];
+				OutInputs.Emplace(NoteTag, InputTime + Sustain * 0.5 * DropPoint, true);
+			}
+		}
+
+		Algo::StableSortBy(OutInputs, &FBeatInputEvent::Timestamp);
+	}
+
+	void RunBatch(TArrayView<FBeatSimulation> Simulations)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(BeatSimulation::RunBatch);
+
+		// Each simulation writes only itself; charts are read-only
+		ParallelFor(Simulations.Num(), [Simulations](int32 SimulationIndex)
+		{
+			Simulations[SimulationIndex].Run();
+		}, Simulations.Num() < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	}
+
+	int32 CompileSongCharts(USongConfiguration& Song, float BPM, TArray<TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe>>& OutTrackCharts)
+	{
+		check(IsInGameThread());
+
+		OutTrackCharts.Reset(Song.Tracks.Num());
+		OutTrackCharts.SetNum(Song.Tracks.Num());
+
+		int32 NumCompiled = 0;
+		TSharedPtr<const FCookedSongChart, ESPMode::ThreadSafe> CookedChart = Song.GetCookedChart();
+		for (int32 TrackIndex = 0; TrackIndex < Song.Tracks.Num(); ++TrackIndex)
+		{
+			TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> Chart;
+			bool bNeedsBake = true;
+			if (CookedChart.IsValid() && CookedChart->Tracks.IsValidIndex(TrackIndex))
+			{
+				// A cooked chart may be live at another BPM or read by other runs: share it only when
+				// its windows already fit, otherwise bake a copy instead of retargeting it
+				const TSharedRef<FCompiledNoteChart, ESPMode::ThreadSafe>& CookedTrack = CookedChart->Tracks[TrackIndex].Chart;
+				if (CookedTrack->BakedBPM > 0.0f && (CookedTrack->HasTempoMap() || CookedTrack->BakedBPM == BPM))
+				{
+					Chart = CookedTrack;
+					bNeedsBake = false;
+				}
+				else
+				{
+					Chart = MakeShared<FCompiledNoteChart, ESPMode::ThreadSafe>(*CookedTrack);
+				}
+			}
+			else if (ULevelSequence* Sequence = Song.Tracks[TrackIndex].TrackSequence.LoadSynchronous())
+			{
+				Chart = MakeShared<FCompiledNoteChart, ESPMode::ThreadSafe>();
+				Chart->CompileFromSequence(Sequence);
+			}
+
+			if (!Chart || Chart->IsEmpty())
+			{
+				continue;
+			}
+
+			if (bNeedsBake)
+			{
+				Chart->BakeWindows(BPM);
+			}
+			OutTrackCharts[TrackIndex] = Chart;
+			++NumCompiled;
+		}
+
+		return NumCompiled;
+	}
+}
@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BeatTimingStats.h"
+
+FBeatTimingHistogram::FBeatTimingHistogram(float InMinMs, float InMaxMs)
+	: MinMs(InMinMs)
+	, MaxMs(FMath::Max(InMaxMs, InMinMs + UE_KINDA_SMALL_NUMBER))
+{
+	BinsPerMs = NumBins / (MaxMs - MinMs);
+	Reset();
+}
+
+void FBeatTimingHistogram::Reset()
+{
+	for (uint32& Count : Bins)
+	{
+		Count = 0;
+	}
+	NumSamples = 0;
+	SumMs = 0.0;
+	MinSampleMs = TNumericLimits<float>::Max();
+	MaxSampleMs = TNumericLimits<float>::Lowest();
+}
+
+float FBeatTimingHistogram::GetPercentile(float Percentile) const
+{
+	if (NumSamples == 0)
+	{
+		return 0.0f;
+	}
+
+	const double Target = FMath::Clamp(Percentile, 0.0f, 100.0f) * 0.01 * NumSamples;
+	double Accumulated = 0.0;
+	for (int32 Bin = 0; Bin < NumBins; ++Bin)
+	{
+		if (Bins[Bin] == 0 || Accumulated + Bins[Bin] < Target)
+		{
+			Accumulated += Bins[Bin];
+			continue;
+		}
+
+		// Spread the bin's samples evenly across its width
+		const double Alpha = (Target - Accumulated) / Bins[Bin];
+		const float Value = MinMs + (Bin + static_cast<float>(Alpha)) / BinsPerMs;
+		return FMath::Clamp(Value, MinSampleMs, MaxSampleMs);
+	}
+	return MaxSampleMs;
+}
+
+void FBeatTimingStats::Reset()
+{
+	TickJitter.Reset();
+	InputLatency.Reset();
+	JudgementOffset.Reset();
+	NumBeatTicks = 0;
+	NumTimingChecks = 0;
+	NumNoteHits = 0;
+	NumNotesMissed = 0;
+}
+
+FString FBeatTimingStats::ToString() const
+{
+	auto Describe = [](const TCHAR* Name, const FBeatTimingHistogram& Histogram)
+	{
+		return FString::Printf(TEXT("%s: n=%u mean=%.3fms p50=%.3fms p95=%.3fms p99=%.3fms min=%.3fms max=%.3fms\n"),
+			Name, Histogram.Num(), Histogram.GetMean(),
+			Histogram.GetPercentile(50.0f), Histogram.GetPercentile(95.0f), Histogram.GetPercentile(99.0f),
+			Histogram.GetMin(), Histogram.GetMax());
+	};
+
+	FString Summary;
+	Summary += FString::Printf(TEXT("Beat ticks=%u, timing checks=%u, note hits=%u, notes missed=%u\n"),
+		NumBeatTicks, NumTimingChecks, NumNoteHits, NumNotesMissed);
+	Summary += Describe(TEXT("Beat tick jitter"), TickJitter);
+	Summary += Describe(TEXT("Input latency"), InputLatency);
+	Summary += Describe(TEXT("Judgement offset"), JudgementOffset);
+	return Summary;
+}
@@ -0,0 +1,577 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CompiledNoteChart.h"
+#include "NoteDataAsset.h"
+#include "LevelSequence.h"
+#include "MovieScene.h"
+#include "MovieSceneNoteChartTrack.h"
+#include "MovieSceneNoteChartSection.h"
+#include "Curves/CurveFloat.h"
+#include "Algo/BinarySearch.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+bool FCompiledNoteChart::CompileFromSequence(const ULevelSequence* Sequence)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCompiledNoteChart::CompileFromSequence);
+
+	Reset();
+	AddSequence(Sequence);
+	Finalize();
+	return !IsEmpty();
+}
+
+void FCompiledNoteChart::AddSequence(const ULevelSequence* Sequence)
+{
+	const UMovieScene* MovieScene = Sequence ? Sequence->GetMovieScene() : nullptr;
+	if (!MovieScene)
+	{
+		return;
+	}
+
+	// Channel keys are stored in tick resolution, not display rate
+	const FFrameRate TickResolution = MovieScene->GetTickResolution();
+
+	for (const UMovieSceneTrack* Track : MovieScene->GetTracks())
+	{
+		const UMovieSceneNoteChartTrack* NoteTrack = Cast<UMovieSceneNoteChartTrack>(Track);
+		if (!NoteTrack || NoteTrack->IsEvalDisabled())
+		{
+			continue;
+		}
+
+		NoteTrack->AppendTempoKeys(TickResolution, TempoMap);
+
+		for (const UMovieSceneSection* Section : NoteTrack->GetAllSections())
+		{
+			const UMovieSceneNoteChartSection* NoteSection = Cast<UMovieSceneNoteChartSection>(Section);
+			if (NoteSection && NoteSection->IsActive())
+			{
+				AddSection(*NoteSection, TickResolution);
+			}
+		}
+	}
+}
+
+void FCompiledNoteChart::AddSection(const UMovieSceneNoteChartSection& Section, FFrameRate TickResolution)
+{
+	TMovieSceneChannelData<const FNoteChannelValue> ChannelData = Section.GetNoteChannel().GetData();
+	TArrayView<const FFrameNumber> KeyTimes = ChannelData.GetTimes();
+	TArrayView<const FNoteChannelValue> KeyValues = ChannelData.GetValues();
+
+	const TRange<FFrameNumber> SectionRange = Section.GetRange();
+
+	NoteSeconds.Reserve(NoteSeconds.Num() + KeyTimes.Num());
+	NoteFrames.Reserve(NoteFrames.Num() + KeyTimes.Num());
+	NoteLanes.Reserve(NoteLanes.Num() + KeyTimes.Num());
+	NoteAssetIndices.Reserve(NoteAssetIndices.Num() + KeyTimes.Num());
+	NoteWindows.Reserve(NoteWindows.Num() + KeyTimes.Num());
+	NoteEndSeconds.Reserve(NoteEndSeconds.Num() + KeyTimes.Num());
+
+	for (int32 KeyIndex = 0; KeyIndex < KeyTimes.Num(); ++KeyIndex)
+	{
+		UNoteDataAsset* NoteData = KeyValues[KeyIndex].NoteData;
+		if (!NoteData || !NoteData->GetNoteTag().IsValid() || !SectionRange.Contains(KeyTimes[KeyIndex]))
+		{
+			continue;
+		}
+
+		int32 LaneIndex = Lanes.Find(NoteData->GetNoteTag());
+		if (LaneIndex == INDEX_NONE)
+		{
+			if (Lanes.Num() > MAX_uint16)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("FCompiledNoteChart: Lane limit reached, skipping tag '%s'"), *NoteData->GetNoteTag().ToString());
+				continue;
+			}
+			LaneIndex = Lanes.Add(NoteData->GetNoteTag());
+		}
+
+		// Palettes are small (a handful of note types per chart), a linear search beats hashing
+		int32 AssetIndex = NoteAssets.Find(NoteData);
+		if (AssetIndex == INDEX_NONE)
+		{
+			if (NoteAssets.Num() > MAX_uint16)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("FCompiledNoteChart: Note asset limit reached, skipping '%s'"), *NoteData->GetName());
+				continue;
+			}
+			AssetIndex = NoteAssets.Add(NoteData);
+			AssetInteractionTypes.Add(NoteData->GetInteractionType());
+			AddAccuracyCurve(NoteData);
+		}
+
+		NoteSeconds.Add(TickResolution.AsSeconds(KeyTimes[KeyIndex]));
+		NoteFrames.Add(KeyTimes[KeyIndex]);
+		NoteLanes.Add(static_cast<uint16>(LaneIndex));
+		NoteAssetIndices.Add(static_cast<uint16>(AssetIndex));
+		NoteWindows.Add(static_cast<uint8>(NoteData->GetPreTiming()) | (static_cast<uint8>(NoteData->GetPostTiming()) << 4));
+
+		const FFrameNumber HoldDuration = NoteData->GetInteractionType() == ENoteInteractionType::Hold
+			? FMath::Max(KeyValues[KeyIndex].HoldDuration, FFrameNumber(0))
+			: FFrameNumber(0);
+		NoteEndSeconds.Add(TickResolution.AsSeconds(KeyTimes[KeyIndex] + HoldDuration));
+	}
+}
+
+void FCompiledNoteChart::Finalize()
+{
+	const int32 NumNotes = NoteSeconds.Num();
+
+	// Sort a permutation by (time, lane) and apply it to every per-note array
+	TArray<int32> Order;
+	Order.SetNumUninitialized(NumNotes);
+	for (int32 Index = 0; Index < NumNotes; ++Index)
+	{
+		Order[Index] = Index;
+	}
+
+	Order.StableSort([this](int32 A, int32 B)
+	{
+		return NoteSeconds[A] < NoteSeconds[B] || (NoteSeconds[A] == NoteSeconds[B] && NoteLanes[A] < NoteLanes[B]);
+	});
+
+	auto ApplyOrder = [&Order, NumNotes](auto& Array)
+	{
+		TArray<typename TRemoveReference<decltype(Array)>::Type::ElementType> Sorted;
+		Sorted.SetNumUninitialized(NumNotes);
+		for (int32 Index = 0; Index < NumNotes; ++Index)
+		{
+			Sorted[Index] = Array[Order[Index]];
+		}
+		Array = MoveTemp(Sorted);
+	};
+
+	ApplyOrder(NoteSeconds);
+	ApplyOrder(NoteFrames);
+	ApplyOrder(NoteLanes);
+	ApplyOrder(NoteAssetIndices);
+	ApplyOrder(NoteWindows);
+	ApplyOrder(NoteEndSeconds);
+
+	BuildLanes();
+	TempoMap.Finalize();
+}
+
+void FCompiledNoteChart::Merge(TConstArrayView<FCompiledNoteChartLayer> Layers)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCompiledNoteChart::Merge);
+
+	Reset();
+
+	/** Position of one layer in its flattened (pass, note) sequence */
+	struct FLayerCursor
+	{
+		const FCompiledNoteChart* Source = nullptr;
+		int32 Layer = 0;
+		int32 Pass = 0;
+		int32 NumPasses = 1;
+		int32 Note = 0;
+		int32 Begin = 0;
+		int32 End = 0;
+		double PassSeconds = 0.0;
+
+		/** Shift from source time to merged time for the first pass */
+		double Shift = 0.0;
+
+		double GetShift() const { return Shift + Pass * PassSeconds; }
+	};
+
+	TArray<FLayerCursor> Cursors;
+	TArray<TArray<uint16>> LaneRemaps;
+	TArray<TArray<uint16>> AssetRemaps;
+	Cursors.Reserve(Layers.Num());
+	LaneRemaps.SetNum(Layers.Num());
+	AssetRemaps.SetNum(Layers.Num());
+
+	int32 NumNotes = 0;
+	for (int32 LayerIndex = 0; LayerIndex < Layers.Num(); ++LayerIndex)
+	{
+		const FCompiledNoteChartLayer& Layer = Layers[LayerIndex];
+		const FCompiledNoteChart* Source = Layer.Chart;
+		check(Source != this);
+		if (!Source || Source->IsEmpty())
+		{
+			continue;
+		}
+
+		// Palettes are a handful of entries, linear searches as in AddSection
+		for (const FGameplayTag& Lane : Source->Lanes)
+		{
+			LaneRemaps[LayerIndex].Add(static_cast<uint16>(Lanes.AddUnique(Lane)));
+		}
+		for (int32 AssetIndex = 0; AssetIndex < Source->NoteAssets.Num(); ++AssetIndex)
+		{
+			int32 MergedAsset = NoteAssets.Find(Source->NoteAssets[AssetIndex]);
+			if (MergedAsset == INDEX_NONE)
+			{
+				MergedAsset = NoteAssets.Add(Source->NoteAssets[AssetIndex]);
+				AssetInteractionTypes.Add(Source->AssetInteractionTypes[AssetIndex]);
+				const int16 CurveIndex = Source->AssetAccuracyCurves[AssetIndex];
+				AssetAccuracyCurves.Add(CurveIndex != INDEX_NONE ? static_cast<int16>(AccuracyCurves.Add(Source->AccuracyCurves[CurveIndex])) : INDEX_NONE);
+			}
+			AssetRemaps[LayerIndex].Add(static_cast<uint16>(MergedAsset));
+		}
+
+		if (TempoMap.IsEmpty() && Source->HasTempoMap())
+		{
+			const FTempoMap& SourceTempo = Source->TempoMap;
+			const int32 NumPasses = Layer.PassSeconds > 0.0 ? FMath::Max(Layer.NumPasses, 1) : 1;
+			for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+			{
+				// Each pass restarts at the tempo of the range start
+				const double PassStart = Layer.OffsetSeconds + Pass * Layer.PassSeconds;
+				const int32 FirstSegment = SourceTempo.FindSegment(Layer.RangeStartSeconds);
+				TempoMap.AddKey(PassStart, SourceTempo.GetBPM(FirstSegment), SourceTempo.SegmentBeatsPerBar[FirstSegment], SourceTempo.SegmentBeatUnit[FirstSegment]);
+				for (int32 Segment = FirstSegment + 1; Segment < SourceTempo.Num(); ++Segment)
+				{
+					const double Local = SourceTempo.SegmentSeconds[Segment] - Layer.RangeStartSeconds;
+					if (Layer.PassSeconds > 0.0 && Local >= Layer.PassSeconds)
+					{
+						break;
+					}
+					TempoMap.AddKey(PassStart + Local, SourceTempo.GetBPM(Segment), SourceTempo.SegmentBeatsPerBar[Segment], SourceTempo.SegmentBeatUnit[Segment]);
+				}
+			}
+		}
+
+		FLayerCursor& Cursor = Cursors.AddDefaulted_GetRef();
+		Cursor.Source = Source;
+		Cursor.Layer = LayerIndex;
+		if (Layer.PassSeconds > 0.0)
+		{
+			Cursor.Begin = Algo::LowerBound(Source->NoteSeconds, Layer.RangeStartSeconds);
+			Cursor.End = Algo::LowerBound(Source->NoteSeconds, Layer.RangeStartSeconds + Layer.PassSeconds);
+			Cursor.NumPasses = FMath::Max(Layer.NumPasses, 1);
+			Cursor.PassSeconds = Layer.PassSeconds;
+		}
+		else
+		{
+			Cursor.End = Source->Num();
+		}
+		Cursor.Note = Cursor.Begin;
+		Cursor.Shift = Layer.OffsetSeconds - Layer.RangeStartSeconds;
+
+		if (Cursor.Begin == Cursor.End)
+		{
+			Cursors.Pop();
+			continue;
+		}
+		NumNotes += (Cursor.End - Cursor.Begin) * Cursor.NumPasses;
+	}
+
+	NoteSeconds.Reserve(NumNotes);
+	NoteFrames.Reserve(NumNotes);
+	NoteLanes.Reserve(NumNotes);
+	NoteAssetIndices.Reserve(NumNotes);
+	NoteWindows.Reserve(NumNotes);
+	NoteEndSeconds.Reserve(NumNotes);
+
+	// Same (time, lane) order as Finalize, ties between layers in layer order
+	auto HeadSeconds = [&Cursors](int32 CursorIndex)
+	{
+		const FLayerCursor& Cursor = Cursors[CursorIndex];
+		return Cursor.Source->NoteSeconds[Cursor.Note] + Cursor.GetShift();
+	};
+	auto HeadLane = [&Cursors, &LaneRemaps](int32 CursorIndex)
+	{
+		const FLayerCursor& Cursor = Cursors[CursorIndex];
+		return LaneRemaps[Cursor.Layer][Cursor.Source->NoteLanes[Cursor.Note]];
+	};
+	auto HeadLess = [&HeadSeconds, &HeadLane](int32 A, int32 B)
+	{
+		const double SecondsA = HeadSeconds(A);
+		const double SecondsB = HeadSeconds(B);
+		if (SecondsA != SecondsB)
+		{
+			return SecondsA < SecondsB;
+		}
+		const uint16 LaneA = HeadLane(A);
+		const uint16 LaneB = HeadLane(B);
+		return LaneA != LaneB ? LaneA < LaneB : A < B;
+	};
+
+	TArray<int32, TInlineAllocator<8>> Heap;
+	for (int32 CursorIndex = 0; CursorIndex < Cursors.Num(); ++CursorIndex)
+	{
+		Heap.Add(CursorIndex);
+	}
+	Heap.Heapify(HeadLess);
+
+	while (Heap.Num() > 0)
+	{
+		int32 CursorIndex = INDEX_NONE;
+		Heap.HeapPop(CursorIndex, HeadLess);
+
+		FLayerCursor& Cursor = Cursors[CursorIndex];
+		const FCompiledNoteChart& Source = *Cursor.Source;
+		const int32 Note = Cursor.Note;
+		const double Shift = Cursor.GetShift();
+
+		NoteSeconds.Add(Source.NoteSeconds[Note] + Shift);
+		NoteFrames.Add(Source.NoteFrames[Note]);
+		NoteLanes.Add(LaneRemaps[Cursor.Layer][Source.NoteLanes[Note]]);
+		NoteAssetIndices.Add(AssetRemaps[Cursor.Layer][Source.NoteAssetIndices[Note]]);
+		NoteWindows.Add(Source.NoteWindows[Note]);
+		NoteEndSeconds.Add(Source.NoteEndSeconds[Note] + Shift);
+
+		if (++Cursor.Note == Cursor.End)
+		{
+			if (++Cursor.Pass == Cursor.NumPasses)
+			{
+				continue;
+			}
+			Cursor.Note = Cursor.Begin;
+		}
+		Heap.HeapPush(CursorIndex, HeadLess);
+	}
+
+	BuildLanes();
+	TempoMap.Finalize();
+}
+
+void FCompiledNoteChart::BuildLanes()
+{
+	const int32 NumNotes = NoteSeconds.Num();
+
+	// Counting sort by lane; notes are already in time order so each lane stays sorted
+	const int32 NumLanes = Lanes.Num();
+	LaneOffsets.Init(0, NumLanes + 1);
+	for (int32 NoteIndex = 0; NoteIndex < NumNotes; ++NoteIndex)
+	{
+		++LaneOffsets[NoteLanes[NoteIndex] + 1];
+	}
+	for (int32 LaneIndex = 0; LaneIndex < NumLanes; ++LaneIndex)
+	{
+		LaneOffsets[LaneIndex + 1] += LaneOffsets[LaneIndex];
+	}
+
+	TArray<int32> LaneFill(LaneOffsets.GetData(), NumLanes);
+	LaneNoteIndices.SetNumUninitialized(NumNotes);
+	LaneNoteSeconds.SetNumUninitialized(NumNotes);
+	for (int32 NoteIndex = 0; NoteIndex < NumNotes; ++NoteIndex)
+	{
+		const int32 LaneEntry = LaneFill[NoteLanes[NoteIndex]]++;
+		LaneNoteIndices[LaneEntry] = NoteIndex;
+		LaneNoteSeconds[LaneEntry] = NoteSeconds[NoteIndex];
+	}
+
+	LaneWindowStart.Reset();
+	LaneWindowEnd.Reset();
+	LaneMaxPreWindow.Reset();
+	LaneMaxPostWindow.Reset();
+	BakedBPM = 0.0f;
+}
+
+void FCompiledNoteChart::BakeWindows(float BPM)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCompiledNoteChart::BakeWindows);
+
+	const int32 NumLanes = Lanes.Num();
+	const int32 NumEntries = LaneNoteIndices.Num();
+
+	LaneWindowStart.SetNumUninitialized(NumEntries);
+	LaneWindowEnd.SetNumUninitialized(NumEntries);
+	LaneMaxPreWindow.Init(0.0f, NumLanes);
+	LaneMaxPostWindow.Init(0.0f, NumLanes);
+	NoteWindowEnd.SetNumUninitialized(NoteSeconds.Num());
+	WindowTable.SetBPM(BPM);
+
+	for (int32 LaneIndex = 0; LaneIndex < NumLanes; ++LaneIndex)
+	{
+		for (int32 LaneEntry = GetLaneBegin(LaneIndex); LaneEntry < GetLaneEnd(LaneIndex); ++LaneEntry)
+		{
+			float PreSeconds = 0.0f;
+			float PostSeconds = 0.0f;
+			if (HasTempoMap())
+			{
+				GetTempoMappedWindowSeconds(LaneNoteIndices[LaneEntry], PreSeconds, PostSeconds);
+			}
+			else
+			{
+				PreSeconds = WindowTable.GetSeconds(GetPreTiming(LaneNoteIndices[LaneEntry]));
+				PostSeconds = WindowTable.GetSeconds(GetPostTiming(LaneNoteIndices[LaneEntry]));
+			}
+
+			LaneWindowStart[LaneEntry] = LaneNoteSeconds[LaneEntry] - PreSeconds;
+			LaneWindowEnd[LaneEntry] = LaneNoteSeconds[LaneEntry] + PostSeconds;
+			NoteWindowEnd[LaneNoteIndices[LaneEntry]] = LaneWindowEnd[LaneEntry];
+			LaneMaxPreWindow[LaneIndex] = FMath::Max(LaneMaxPreWindow[LaneIndex], PreSeconds);
+			LaneMaxPostWindow[LaneIndex] = FMath::Max(LaneMaxPostWindow[LaneIndex], PostSeconds);
+		}
+	}
+
+	BakedBPM = BPM;
+}
+
+void FCompiledNoteChart::Reset()
+{
+	NoteSeconds.Reset();
+	NoteFrames.Reset();
+	NoteLanes.Reset();
+	NoteAssetIndices.Reset();
+	NoteWindows.Reset();
+	NoteWindowEnd.Reset();
+	NoteEndSeconds.Reset();
+	Lanes.Reset();
+	LaneOffsets.Reset();
+	LaneNoteIndices.Reset();
+	LaneNoteSeconds.Reset();
+	LaneWindowStart.Reset();
+	LaneWindowEnd.Reset();
+	LaneMaxPreWindow.Reset();
+	LaneMaxPostWindow.Reset();
+	NoteAssets.Reset();
+	AssetInteractionTypes.Reset();
+	AssetAccuracyCurves.Reset();
+	AccuracyCurves.Reset();
+	TempoMap.Reset();
+	BakedBPM = 0.0f;
+}
+
+namespace CompiledNoteChart
+{
+	/** Serialize a trivially copyable array as one raw block */
+	template <typename ElementType>
+	void SerializeRawArray(FArchive& Ar, TArray<ElementType>& Array)
+	{
+		static_assert(std::is_trivially_copyable_v<ElementType>, "Raw array serialization requires trivially copyable elements");
+
+		int32 Num = Array.Num();
+		Ar << Num;
+		if (Ar.IsLoading())
+		{
+			if (Num < 0 || (int64)Num * sizeof(ElementType) > Ar.TotalSize() - Ar.Tell())
+			{
+				Ar.SetError();
+				Array.Reset();
+				return;
+			}
+			Array.SetNumUninitialized(Num);
+		}
+		if (Num > 0)
+		{
+			Ar.Serialize(Array.GetData(), (int64)Num * sizeof(ElementType));
+		}
+	}
+}
+
+void FCompiledNoteChart::SerializeArrays(FArchive& Ar)
+{
+	CompiledNoteChart::SerializeRawArray(Ar, NoteSeconds);
+	CompiledNoteChart::SerializeRawArray(Ar, NoteFrames);
+	CompiledNoteChart::SerializeRawArray(Ar, NoteLanes);
+	CompiledNoteChart::SerializeRawArray(Ar, NoteAssetIndices);
+	CompiledNoteChart::SerializeRawArray(Ar, NoteWindows);
+	CompiledNoteChart::SerializeRawArray(Ar, NoteEndSeconds);
+	CompiledNoteChart::SerializeRawArray(Ar, LaneOffsets);
+	CompiledNoteChart::SerializeRawArray(Ar, LaneNoteIndices);
+	CompiledNoteChart::SerializeRawArray(Ar, LaneNoteSeconds);
+	CompiledNoteChart::SerializeRawArray(Ar, TempoMap.SegmentSeconds);
+	CompiledNoteChart::SerializeRawArray(Ar, TempoMap.SegmentBeats);
+	CompiledNoteChart::SerializeRawArray(Ar, TempoMap.SegmentBars);
+	CompiledNoteChart::SerializeRawArray(Ar, TempoMap.SegmentSecondsPerBeat);
+	CompiledNoteChart::SerializeRawArray(Ar, TempoMap.SegmentBeatsPerBar);
+	CompiledNoteChart::SerializeRawArray(Ar, TempoMap.SegmentBeatUnit);
+
+	if (Ar.IsLoading())
+	{
+		NoteWindowEnd.Reset();
+		LaneWindowStart.Reset();
+		LaneWindowEnd.Reset();
+		LaneMaxPreWindow.Reset();
+		LaneMaxPostWindow.Reset();
+		BakedBPM = 0.0f;
+	}
+}
+
+void FCompiledNoteChart::BindPalette(const TArray<FGameplayTag>& InLanes, const TArray<TObjectPtr<UNoteDataAsset>>& InNoteAssets)
+{
+	Lanes = InLanes;
+	NoteAssets = InNoteAssets;
+	BindAssetData();
+
+	// A palette shared between charts may hold lanes this chart has no notes in
+	const int32 LastOffset = LaneOffsets.Num() > 0 ? LaneOffsets.Last() : 0;
+	if (LaneOffsets.Num() == 0)
+	{
+		LaneOffsets.Add(0);
+	}
+	while (LaneOffsets.Num() < Lanes.Num() + 1)
+	{
+		LaneOffsets.Add(LastOffset);
+	}
+}
+
+void FCompiledNoteChart::BindAssetData()
+{
+	AssetInteractionTypes.Reset(NoteAssets.Num());
+	AssetAccuracyCurves.Reset(NoteAssets.Num());
+	AccuracyCurves.Reset();
+	for (const UNoteDataAsset* NoteData : NoteAssets)
+	{
+		AssetInteractionTypes.Add(NoteData ? NoteData->GetInteractionType() : ENoteInteractionType::Press);
+		AddAccuracyCurve(NoteData);
+	}
+}
+
+void FCompiledNoteChart::AddAccuracyCurve(const UNoteDataAsset* NoteData)
+{
+	const UCurveFloat* Curve = NoteData ? NoteData->GetAccuracyCurve() : nullptr;
+	if (!Curve || Curve->FloatCurve.GetNumKeys() == 0 || AccuracyCurves.Num() >= MAX_int16)
+	{
+		AssetAccuracyCurves.Add(INDEX_NONE);
+		return;
+	}
+
+	// Assets sharing a curve asset still get their own table; palettes are a handful of entries
+	AssetAccuracyCurves.Add(static_cast<int16>(AccuracyCurves.Num()));
+	if (AccuracyCurves.AddDefaulted_GetRef().Bake(Curve->FloatCurve) > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FCompiledNoteChart: Accuracy curve '%s' of note '%s' leaves [0, 1], clamped"), *Curve->GetName(), *NoteData->GetName());
+	}
+}
+
+void FCompiledNoteChart::GetTempoMappedWindowSeconds(int32 NoteIndex, float& OutPreSeconds, float& OutPostSeconds) const
+{
+	const double PreBeats = MusicalTiming::GetNoteValueBeats(GetPreTiming(NoteIndex));
+	const double PostBeats = MusicalTiming::GetNoteValueBeats(GetPostTiming(NoteIndex));
+
+	// Walk the window in beats so it stretches across tempo changes around the note
+	const double NoteTime = NoteSeconds[NoteIndex];
+	const double NoteBeat = TempoMap.SecondsToBeats(NoteTime);
+	OutPreSeconds = static_cast<float>(NoteTime - TempoMap.BeatsToSeconds(NoteBeat - PreBeats));
+	OutPostSeconds = static_cast<float>(TempoMap.BeatsToSeconds(NoteBeat + PostBeats) - NoteTime);
+}
+
+int32 FCompiledNoteChart::GetSustainTicks(int32 NoteIndex, double Seconds) const
+{
+	const double StartBeat = SecondsToChartBeats(NoteSeconds[NoteIndex]);
+	const double HeldBeat = SecondsToChartBeats(FMath::Clamp(Seconds, NoteSeconds[NoteIndex], NoteEndSeconds[NoteIndex]));
+
+	// Nudge so a release exactly on a tick boundary is not lost to rounding
+	return FMath::FloorToInt32((HeldBeat - StartBeat) * SustainTicksPerBeat + UE_KINDA_SMALL_NUMBER);
+}
+
+SIZE_T FCompiledNoteChart::GetAllocatedSize() const
+{
+	return NoteSeconds.GetAllocatedSize()
+		+ NoteFrames.GetAllocatedSize()
+		+ NoteLanes.GetAllocatedSize()
+		+ NoteAssetIndices.GetAllocatedSize()
+		+ NoteWindows.GetAllocatedSize()
+		+ NoteWindowEnd.GetAllocatedSize()
+		+ NoteEndSeconds.GetAllocatedSize()
+		+ Lanes.GetAllocatedSize()
+		+ LaneOffsets.GetAllocatedSize()
+		+ LaneNoteIndices.GetAllocatedSize()
+		+ LaneNoteSeconds.GetAllocatedSize()
+		+ LaneWindowStart.GetAllocatedSize()
+		+ LaneWindowEnd.GetAllocatedSize()
+		+ LaneMaxPreWindow.GetAllocatedSize()
+		+ LaneMaxPostWindow.GetAllocatedSize()
+		+ NoteAssets.GetAllocatedSize()
+		+ AssetInteractionTypes.GetAllocatedSize()
+		+ AssetAccuracyCurves.GetAllocatedSize()
+		+ AccuracyCurves.GetAllocatedSize()
+		+ TempoMap.GetAllocatedSize();
+}
@@ -0,0 +1,111 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CookedSongChart.h"
+#include "SongConfiguration.h"
+#include "LevelSequence.h"
+#include "Serialization/MemoryReader.h"
+
+void FCookedSongChart::Serialize(FArchive& Ar)
+{
+	uint32 Magic = BlobMagic;
+	uint32 Version = BlobVersion;
+	Ar << Magic;
+	Ar << Version;
+
+	if (Ar.IsLoading() && (Magic != BlobMagic || Version != BlobVersion))
+	{
+		Ar.SetError();
+		Tracks.Reset();
+		return;
+	}
+
+	int32 NumTracks = Tracks.Num();
+	Ar << NumTracks;
+	if (Ar.IsLoading())
+	{
+		if (NumTracks < 0 || NumTracks > MAX_uint16)
+		{
+			Ar.SetError();
+			Tracks.Reset();
+			return;
+		}
+		Tracks.Reset(NumTracks);
+		Tracks.AddDefaulted(NumTracks);
+	}
+
+	for (FTrack& Track : Tracks)
+	{
+		Ar << Track.DelayOffset;
+		Ar << Track.LoopCount;
+		Track.Chart->SerializeArrays(Ar);
+		if (Ar.IsError())
+		{
+			Tracks.Reset();
+			return;
+		}
+	}
+}
+
+bool FCookedSongChart::LoadFromBytes(TConstArrayView<uint8> Bytes, const TArray<FGameplayTag>& Lanes, const TArray<TObjectPtr<UNoteDataAsset>>& NoteAssets)
+{
+	Tracks.Reset();
+	if (Bytes.Num() == 0)
+	{
+		return false;
+	}
+
+	// Read in place; each chart array is a single raw copy out of the blob
+	FMemoryReaderView Reader(Bytes, /*bIsPersistent*/ true);
+	Serialize(Reader);
+
+	if (Reader.IsError())
+	{
+		Tracks.Reset();
+		return false;
+	}
+
+	for (FTrack& Track : Tracks)
+	{
+		Track.Chart->BindPalette(Lanes, NoteAssets);
+	}
+
+	return true;
+}
+
+#if WITH_EDITOR
+bool FCookedSongChart::BuildFromSong(const USongConfiguration& Song, TArray<FGameplayTag>& OutLanes, TArray<TObjectPtr<UNoteDataAsset>>& OutNoteAssets)
+{
+	Tracks.Reset();
+	OutLanes.Reset();
+	OutNoteAssets.Reset();
+
+	bool bAnyNotes = false;
+	for (const FNoteTrackEntry& Entry : Song.Tracks)
+	{
+		FTrack& Track = Tracks.AddDefaulted_GetRef();
+		Track.DelayOffset = Entry.DelayOffset;
+		Track.LoopCount = Entry.LoopCount;
+
+		// Seed with the palette so far so every track indexes the same song-wide arrays
+		FCompiledNoteChart& Chart = *Track.Chart;
+		Chart.Lanes = OutLanes;
+		Chart.NoteAssets = OutNoteAssets;
+		Chart.BindAssetData();
+
+		Chart.AddSequence(Entry.TrackSequence.LoadSynchronous());
+		Chart.Finalize();
+
+		OutLanes = Chart.Lanes;
+		OutNoteAssets = Chart.NoteAssets;
+		bAnyNotes |= !Chart.IsEmpty();
+	}
+
+	// Earlier tracks were compiled against a smaller palette
+	for (FTrack& Track : Tracks)
+	{
+		Track.Chart->BindPalette(OutLanes, OutNoteAssets);
+	}
+
+	return bAnyNotes;
+}
+#endif
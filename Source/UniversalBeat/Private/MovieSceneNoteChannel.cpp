@@ -3,10 +3,53 @@
 #include "MovieSceneNoteChannel.h"
 #include "Channels/MovieSceneChannelProxy.h"
 #include "MovieSceneFrameMigration.h"
+#include "Algo/BinarySearch.h"
 
 void FMovieSceneNoteChannel::GetKeys(const TRange<FFrameNumber>& WithinRange, TArray<FFrameNumber>* OutKeyTimes, TArray<FKeyHandle>* OutKeyHandles)
 {
-	GetData().GetKeys(WithinRange, OutKeyTimes, OutKeyHandles);
+	// Sequencer asks for the visible range on every paint: binary search it rather than visiting every key
+	const TRangeBound<FFrameNumber> LowerBound = WithinRange.GetLowerBound();
+	const TRangeBound<FFrameNumber> UpperBound = WithinRange.GetUpperBound();
+
+	int32 FirstIndex = 0;
+	if (LowerBound.IsInclusive())
+	{
+		FirstIndex = Algo::LowerBound(KeyTimes, LowerBound.GetValue());
+	}
+	else if (LowerBound.IsExclusive())
+	{
+		FirstIndex = Algo::UpperBound(KeyTimes, LowerBound.GetValue());
+	}
+
+	int32 EndIndex = KeyTimes.Num();
+	if (UpperBound.IsInclusive())
+	{
+		EndIndex = Algo::UpperBound(KeyTimes, UpperBound.GetValue());
+	}
+	else if (UpperBound.IsExclusive())
+	{
+		EndIndex = Algo::LowerBound(KeyTimes, UpperBound.GetValue());
+	}
+
+	if (EndIndex <= FirstIndex)
+	{
+		return;
+	}
+
+	if (OutKeyTimes)
+	{
+		OutKeyTimes->Append(&KeyTimes[FirstIndex], EndIndex - FirstIndex);
+	}
+
+	if (OutKeyHandles)
+	{
+		TMovieSceneChannelData<FNoteChannelValue> ChannelData = GetData();
+		OutKeyHandles->Reserve(OutKeyHandles->Num() + EndIndex - FirstIndex);
+		for (int32 Index = FirstIndex; Index < EndIndex; ++Index)
+		{
+			OutKeyHandles->Add(ChannelData.GetHandle(Index));
+		}
+	}
 }
 
 void FMovieSceneNoteChannel::GetKeyTimes(TArrayView<const FKeyHandle> InHandles, TArrayView<FFrameNumber> OutKeyTimes)
@@ -59,6 +102,35 @@ void FMovieSceneNoteChannel::DeleteKeysFrom(FFrameNumber InTime, bool bDeleteKey
 	}
 }
 
+int32 FMovieSceneNoteChannel::DeleteKeysInRange(FFrameNumber StartFrame, FFrameNumber EndFrame)
+{
+	const int32 FirstIndexToDelete = Algo::LowerBound(KeyTimes, StartFrame);
+	const int32 NumToDelete = Algo::UpperBound(KeyTimes, EndFrame) - FirstIndexToDelete;
+
+	if (NumToDelete > 0)
+	{
+		KeyTimes.RemoveAt(FirstIndexToDelete, NumToDelete);
+		KeyValues.RemoveAt(FirstIndexToDelete, NumToDelete);
+		KeyHandles.Reset();
+		return NumToDelete;
+	}
+	return 0;
+}
+
+int32 FMovieSceneNoteChannel::RemapKeyTimes(TFunctionRef<FFrameNumber(FFrameNumber)> Remap)
+{
+	int32 NumMoved = 0;
+	for (int32 Index = 0; Index < KeyTimes.Num(); ++Index)
+	{
+		const FFrameNumber NewTime = Remap(KeyTimes[Index]);
+		NumMoved += NewTime != KeyTimes[Index] ? 1 : 0;
+		KeyTimes[Index] = NewTime;
+
+		checkSlow(Index == 0 || KeyTimes[Index - 1] <= NewTime);
+	}
+	return NumMoved;
+}
+
 void FMovieSceneNoteChannel::ChangeFrameResolution(FFrameRate SourceRate, FFrameRate DestinationRate)
 {
 	check(KeyTimes.Num() == KeyValues.Num());
@@ -2,8 +2,14 @@
 
 #include "MovieSceneNoteChartSection.h"
 #include "NoteDataAsset.h"
+#include "MovieSceneNoteChartSystem.h"
+#include "TempoMap.h"
+#include "MusicalTiming.h"
 #include "UniversalBeatSubsystem.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
 #include "Channels/MovieSceneChannelProxy.h"
+#include "EntitySystem/BuiltInComponentTypes.h"
 #include "EntitySystem/MovieSceneEntityBuilder.h"
 #include "EntitySystem/MovieSceneEntitySystemLinker.h"
 #include "Evaluation/MovieSceneEvaluationField.h"
@@ -61,88 +67,79 @@ void UMovieSceneNoteChartSection::PostLoad()
 
 bool UMovieSceneNoteChartSection::PopulateEvaluationFieldImpl(const TRange<FFrameNumber>& EffectiveRange, const FMovieSceneEvaluationFieldEntityMetaData& InMetaData, FMovieSceneEntityComponentFieldBuilder* OutFieldBuilder)
 {
-	// Get channel data to access key indices
-	TMovieSceneChannelData<const FNoteChannelValue> ChannelData = NoteChannel.GetData();
-	TArrayView<const FFrameNumber> AllKeyTimes = ChannelData.GetTimes();
-	TArrayView<const FNoteChannelValue> AllKeyValues = ChannelData.GetValues();
-	
-	if (AllKeyTimes.Num() == 0)
+	if (NoteChannel.GetNumKeys() == 0)
 	{
 		return false;
 	}
-	
-	// Create one-shot entity for each note in the effective range
+
+	// One entity for the whole section; the note chart system walks the keys with a cursor,
+	// so the field does not grow with the chart
 	const int32 MetaDataIndex = OutFieldBuilder->AddMetaData(InMetaData);
-	bool bAddedAnyEntities = false;
-	
-	for (int32 KeyIndex = 0; KeyIndex < AllKeyTimes.Num(); ++KeyIndex)
-	{
-		const FFrameNumber NoteTime = AllKeyTimes[KeyIndex];
-		
-		// Only add entities within the effective range
-		if (EffectiveRange.Contains(NoteTime))
-		{
-			// Pass actual key index so ImportEntityImpl can retrieve the correct note
-			OutFieldBuilder->AddOneShotEntity(TRange<FFrameNumber>(NoteTime), this, KeyIndex, MetaDataIndex);
-			bAddedAnyEntities = true;
-		}
-	}
-	
-	return bAddedAnyEntities;
+	OutFieldBuilder->AddPersistentEntity(EffectiveRange, this, 0, MetaDataIndex);
+	return true;
 }
 
 void UMovieSceneNoteChartSection::ImportEntityImpl(UMovieSceneEntitySystemLinker* EntityLinker, const FEntityImportParams& Params, FImportedEntity* OutImportedEntity)
 {
-	// Entity index corresponds to key index in channel
-	const int32 KeyIndex = Params.EntityID;
-	
-	// Retrieve note data from channel
+	using namespace UE::MovieScene;
+
+	const FBuiltInComponentTypes* BuiltInComponents = FBuiltInComponentTypes::Get();
+	const FNoteChartComponentTypes* NoteChartComponents = FNoteChartComponentTypes::Get();
+
+	FNoteChartEvaluationComponent Evaluation;
+	Evaluation.Section = this;
+
+	OutImportedEntity->AddBuilder(
+		FEntityBuilder()
+		.AddDefaulted(BuiltInComponents->EvalTime)
+		.Add(NoteChartComponents->NoteChart, MoveTemp(Evaluation))
+	);
+}
+
+int32 UMovieSceneNoteChartSection::TriggerNotes(FFrameNumber AfterFrame, FFrameNumber ToFrame, int32& InOutCursor, UUniversalBeatSubsystem* Subsystem) const
+{
 	TMovieSceneChannelData<const FNoteChannelValue> ChannelData = NoteChannel.GetData();
-	TArrayView<const FNoteChannelValue> KeyValues = ChannelData.GetValues();
 	TArrayView<const FFrameNumber> KeyTimes = ChannelData.GetTimes();
-	
-	if (!KeyValues.IsValidIndex(KeyIndex) || !KeyTimes.IsValidIndex(KeyIndex))
-	{
-		UE_LOG(LogTemp, Warning, TEXT("MovieSceneNoteChartSection::ImportEntityImpl: Invalid key index %d"), KeyIndex);
-		return;
-	}
-	
-	const FNoteChannelValue& NoteValue = KeyValues[KeyIndex];
-	const FFrameNumber NoteTime = KeyTimes[KeyIndex];
-	
-	if (!NoteValue.NoteData)
+	TArrayView<const FNoteChannelValue> KeyValues = ChannelData.GetValues();
+
+	// The cursor is only trusted if it still sits right after AfterFrame (keys may have been edited)
+	const bool bCursorValid = InOutCursor >= 0 && InOutCursor <= KeyTimes.Num()
+		&& (InOutCursor == 0 || KeyTimes[InOutCursor - 1] <= AfterFrame)
+		&& (InOutCursor == KeyTimes.Num() || KeyTimes[InOutCursor] > AfterFrame);
+	if (!bCursorValid)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("MovieSceneNoteChartSection::ImportEntityImpl: Note at index %d has no assigned NoteDataAsset"), KeyIndex);
-		return;
+		InOutCursor = Algo::UpperBound(KeyTimes, AfterFrame);
 	}
-	
-	// Add note to runtime notes array (existing AddNote behavior)
-	// The UniversalBeatSubsystem will query this array
-	FNoteInstance RuntimeNote(NoteTime, NoteValue.NoteData);
-	RuntimeNotes.Add(RuntimeNote);
-	
-	// Broadcast OnNoteBeat event to subsystem
-	// Get world from the EntityLinker instead of GetWorld() which doesn't work in this context
-	if (EntityLinker)
+
+	const int32 FirstKey = InOutCursor;
+	for (; InOutCursor < KeyTimes.Num() && KeyTimes[InOutCursor] <= ToFrame; ++InOutCursor)
 	{
-		UWorld* World = EntityLinker->GetWorld();
-		if (World && World->GetGameInstance())
+		const FNoteChannelValue& NoteValue = KeyValues[InOutCursor];
+		const FFrameNumber NoteTime = KeyTimes[InOutCursor];
+
+		if (!NoteValue.NoteData)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("MovieSceneNoteChartSection::TriggerNotes: Note at index %d has no assigned NoteDataAsset"), InOutCursor);
+			continue;
+		}
+
+		// Read straight from the channel keys; the subsystem validates against its compiled chart,
+		// so nothing is cached here and looping playback does not grow any array
+		if (Subsystem)
 		{
-			
-			if (UUniversalBeatSubsystem* Subsystem = World->GetSubsystem<UUniversalBeatSubsystem>())
+			Subsystem->EnqueueBeatEvent(FBeatEvent::MakeNote(FNoteInstance(NoteTime, NoteValue.NoteData), NoteValue.NoteData->NoteTag));
+
+			if (Subsystem->IsDebugLoggingEnabled())
 			{
-				Subsystem->OnNoteBeat.Broadcast(RuntimeNote);
-					
-				if (Subsystem->IsDebugLoggingEnabled())
-				{
-					UE_LOG(LogTemp, Log, TEXT("MovieSceneNoteChartSection::ImportEntityImpl: Broadcasted OnNoteBeat for note at frame %d"), NoteTime.Value);
-				}
+				UE_LOG(LogTemp, Log, TEXT("MovieSceneNoteChartSection::TriggerNotes: Queued OnNoteBeat for note at frame %d"), NoteTime.Value);
 			}
 		}
+
+		UE_LOG(LogTemp, Verbose, TEXT("MovieSceneNoteChartSection::TriggerNotes: Note triggered at frame %d with data %s"),
+			NoteTime.Value, *NoteValue.NoteData->GetName());
 	}
-	
-	UE_LOG(LogTemp, Verbose, TEXT("MovieSceneNoteChartSection::ImportEntityImpl: Note triggered at frame %d with data %s"), 
-		NoteTime.Value, *NoteValue.NoteData->GetName());
+
+	return InOutCursor - FirstKey;
 }
 
 TOptional<TRange<FFrameNumber>> UMovieSceneNoteChartSection::GetAutoSizeRange() const
@@ -171,10 +168,6 @@ FKeyHandle UMovieSceneNoteChartSection::AddNote(FFrameNumber Timestamp, UNoteDat
 	int32 KeyIndex = ChannelData.AddKey(Timestamp, MoveTemp(Value));
 	FKeyHandle Handle = ChannelData.GetHandle(KeyIndex);
 	
-	// Also add to runtime notes for immediate queries
-	FNoteInstance RuntimeNote(Timestamp, NoteData);
-	RuntimeNotes.Add(RuntimeNote);
-	
 	// Expand section range if needed
 	TRange<FFrameNumber> CurrentRange = GetRange();
 	if (!CurrentRange.Contains(Timestamp))
@@ -196,9 +189,6 @@ bool UMovieSceneNoteChartSection::RemoveNote(FKeyHandle Handle)
 	if (Index != INDEX_NONE)
 	{
 		ChannelData.RemoveKey(Index);
-		
-		// Rebuild runtime notes
-		RuntimeNotes.Empty();
 		return true;
 	}
 	
@@ -207,45 +197,27 @@ bool UMovieSceneNoteChartSection::RemoveNote(FKeyHandle Handle)
 
 int32 UMovieSceneNoteChartSection::RemoveNotesInRange(FFrameNumber StartFrame, FFrameNumber EndFrame)
 {
-	TMovieSceneChannelData<FNoteChannelValue> ChannelData = NoteChannel.GetData();
-	TArrayView<const FFrameNumber> KeyTimes = ChannelData.GetTimes();
-	
-	TArray<FKeyHandle> HandlesToDelete;
-	
-	for (int32 Idx = 0; Idx < KeyTimes.Num(); ++Idx)
-	{
-		if (KeyTimes[Idx] >= StartFrame && KeyTimes[Idx] <= EndFrame)
-		{
-			HandlesToDelete.Add(ChannelData.GetHandle(Idx));
-		}
-	}
-	
-	int32 NumRemoved = HandlesToDelete.Num();
-	
-	for (FKeyHandle Handle : HandlesToDelete)
-	{
-		RemoveNote(Handle);
-	}
-	
-	return NumRemoved;
+	return NoteChannel.DeleteKeysInRange(StartFrame, EndFrame);
 }
 
 void UMovieSceneNoteChartSection::GetNotesInRange(FFrameNumber StartFrame, FFrameNumber EndFrame, TArray<FNoteInstance>& OutNotes) const
 {
-	OutNotes.Empty();
+	OutNotes.Reset();
 	
 	TMovieSceneChannelData<const FNoteChannelValue> ChannelData = NoteChannel.GetData();
 	TArrayView<const FFrameNumber> KeyTimes = ChannelData.GetTimes();
 	TArrayView<const FNoteChannelValue> KeyValues = ChannelData.GetValues();
 	
-	for (int32 Idx = 0; Idx < KeyTimes.Num(); ++Idx)
+	// Keys are kept sorted by time
+	const int32 FirstIndex = Algo::LowerBound(KeyTimes, StartFrame);
+	const int32 EndIndex = Algo::UpperBound(KeyTimes, EndFrame);
+	OutNotes.Reserve(FMath::Max(EndIndex - FirstIndex, 0));
+	
+	for (int32 Idx = FirstIndex; Idx < EndIndex; ++Idx)
 	{
-		if (KeyTimes[Idx] >= StartFrame && KeyTimes[Idx] <= EndFrame)
+		if (KeyValues[Idx].NoteData)
 		{
-			if (KeyValues[Idx].NoteData)
-			{
-				OutNotes.Add(FNoteInstance(KeyTimes[Idx], KeyValues[Idx].NoteData));
-			}
+			OutNotes.Add(FNoteInstance(KeyTimes[Idx], KeyValues[Idx].NoteData));
 		}
 	}
 }
@@ -272,6 +244,68 @@ void UMovieSceneNoteChartSection::GetNotesByTag(FGameplayTag Tag, TArray<FNoteIn
 	}
 }
 
+int32 UMovieSceneNoteChartSection::QuantizeNotes(EMusicalNoteValue Grid, float Strength, FFrameRate TickResolution, const FTempoMap& TempoMap, float BPM)
+{
+	const double Alpha = FMath::Clamp(Strength, 0.0f, 1.0f);
+	if (Alpha <= 0.0 || BPM <= 0.0f)
+	{
+		return 0;
+	}
+
+	const double GridBeats = MusicalTiming::GetNoteValueBeats(Grid);
+	const double SecondsPerBeat = 60.0 / BPM;
+	const bool bUseTempoMap = !TempoMap.IsEmpty();
+
+	// Beat position, rounding and the blend are all non-decreasing, so the keys stay sorted in place
+	return NoteChannel.RemapKeyTimes([&](FFrameNumber Frame)
+	{
+		const double Seconds = TickResolution.AsSeconds(Frame);
+		const double Beat = bUseTempoMap ? TempoMap.SecondsToBeats(Seconds) : Seconds / SecondsPerBeat;
+		const double GridBeat = FMath::RoundToDouble(Beat / GridBeats) * GridBeats;
+		const double GridSeconds = bUseTempoMap ? TempoMap.BeatsToSeconds(GridBeat) : GridBeat * SecondsPerBeat;
+		return TickResolution.AsFrameTime(FMath::Lerp(Seconds, GridSeconds, Alpha)).RoundToFrame();
+	});
+}
+
+int32 UMovieSceneNoteChartSection::MirrorNoteLanes()
+{
+	TMovieSceneChannelData<FNoteChannelValue> ChannelData = NoteChannel.GetData();
+	TArrayView<FNoteChannelValue> KeyValues = ChannelData.GetValues();
+
+	// A chart uses a handful of note types, so a small array beats a map here
+	TArray<UNoteDataAsset*, TInlineAllocator<16>> Lanes;
+	for (const FNoteChannelValue& Value : KeyValues)
+	{
+		if (Value.NoteData)
+		{
+			Lanes.AddUnique(Value.NoteData);
+		}
+	}
+
+	if (Lanes.Num() < 2)
+	{
+		return 0;
+	}
+
+	Algo::Sort(Lanes, [](const UNoteDataAsset* A, const UNoteDataAsset* B)
+	{
+		return A->NoteTag.GetTagName().LexicalLess(B->NoteTag.GetTagName());
+	});
+
+	int32 NumChanged = 0;
+	for (FNoteChannelValue& Value : KeyValues)
+	{
+		const int32 Lane = Value.NoteData ? Lanes.Find(Value.NoteData) : INDEX_NONE;
+		const int32 MirroredLane = Lanes.Num() - 1 - Lane;
+		if (Lane != INDEX_NONE && MirroredLane != Lane)
+		{
+			Value.NoteData = Lanes[MirroredLane];
+			++NumChanged;
+		}
+	}
+	return NumChanged;
+}
+
 #if WITH_EDITOR
 void UMovieSceneNoteChartSection::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
@@ -0,0 +1,117 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MovieSceneNoteChartSystem.h"
+#include "MovieSceneNoteChartSection.h"
+#include "UniversalBeatSubsystem.h"
+#include "EntitySystem/BuiltInComponentTypes.h"
+#include "EntitySystem/MovieSceneEntitySystemLinker.h"
+#include "EntitySystem/MovieSceneEntitySystemTask.h"
+#include "EntitySystem/MovieSceneEvalTimeSystem.h"
+#include "EntitySystem/MovieSceneInstanceRegistry.h"
+#include "Engine/World.h"
+
+namespace
+{
+	TUniquePtr<FNoteChartComponentTypes> GNoteChartComponentTypes;
+	bool bNoteChartComponentTypesDestroyed = false;
+}
+
+FNoteChartComponentTypes* FNoteChartComponentTypes::Get()
+{
+	if (!GNoteChartComponentTypes.IsValid())
+	{
+		check(!bNoteChartComponentTypesDestroyed);
+		GNoteChartComponentTypes.Reset(new FNoteChartComponentTypes);
+	}
+	return GNoteChartComponentTypes.Get();
+}
+
+void FNoteChartComponentTypes::Destroy()
+{
+	GNoteChartComponentTypes.Reset();
+	bNoteChartComponentTypesDestroyed = true;
+}
+
+FNoteChartComponentTypes::FNoteChartComponentTypes()
+{
+	UE::MovieScene::FComponentRegistry* ComponentRegistry = UMovieSceneEntitySystemLinker::GetComponents();
+	ComponentRegistry->NewComponentType(&NoteChart, TEXT("Note Chart"));
+}
+
+UMovieSceneNoteChartSystem::UMovieSceneNoteChartSystem(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	// Runs on the game thread once the frame has been evaluated, like event triggers
+	Phase = UE::MovieScene::ESystemPhase::Finalization;
+	RelevantComponent = FNoteChartComponentTypes::Get()->NoteChart;
+
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		DefineImplicitPrerequisite(UMovieSceneEvalTimeSystem::StaticClass(), GetClass());
+	}
+}
+
+void UMovieSceneNoteChartSystem::OnRun(FSystemTaskPrerequisites& InPrerequisites, FSystemSubsequentTasks& Subsequents)
+{
+	using namespace UE::MovieScene;
+
+	const FBuiltInComponentTypes* BuiltInComponents = FBuiltInComponentTypes::Get();
+	const FNoteChartComponentTypes* NoteChartComponents = FNoteChartComponentTypes::Get();
+	const FInstanceRegistry* InstanceRegistry = Linker->GetInstanceRegistry();
+
+	// The subsystem's chart clock already fires the notes it plays; only broadcast for free-running sequences.
+	// Cursors advance either way so nothing fires late when the chart clock stops.
+	UUniversalBeatSubsystem* Subsystem = nullptr;
+	UWorld* World = Linker->GetWorld();
+	if (World && World->GetGameInstance())
+	{
+		Subsystem = World->GetSubsystem<UUniversalBeatSubsystem>();
+		if (Subsystem && Subsystem->IsDrivingNoteEvents())
+		{
+			Subsystem = nullptr;
+		}
+	}
+
+	auto TriggerNotes = [InstanceRegistry, Subsystem](FInstanceHandle InstanceHandle, FFrameTime EvalTime, FNoteChartEvaluationComponent& Evaluation)
+	{
+		if (!Evaluation.Section)
+		{
+			return;
+		}
+
+		const FMovieSceneContext& Context = InstanceRegistry->GetContext(InstanceHandle);
+		const FFrameNumber Frame = EvalTime.FloorToFrame();
+
+		// Scrubbing, jumps and reverse playback move the cursor without firing what they skip
+		if (Context.HasJumped() || Context.IsSilent() || Context.GetDirection() != EPlayDirection::Forwards
+			|| (Evaluation.LastFrame.IsSet() && Frame < Evaluation.LastFrame.GetValue()))
+		{
+			Evaluation.LastFrame = Frame;
+			Evaluation.Cursor = INDEX_NONE;
+			return;
+		}
+
+		// First evaluation covers this frame's whole range, so a note on the frame the section was entered still fires
+		FFrameNumber AfterFrame;
+		if (Evaluation.LastFrame.IsSet())
+		{
+			AfterFrame = Evaluation.LastFrame.GetValue();
+		}
+		else
+		{
+			const TRange<FFrameTime> Range = Context.GetRange();
+			const FFrameTime Delta = Range.HasLowerBound() ? Context.GetTime() - Range.GetLowerBoundValue() : FFrameTime(0);
+			AfterFrame = (EvalTime - Delta).FloorToFrame() - 1;
+		}
+
+		Evaluation.Section->TriggerNotes(AfterFrame, Frame, Evaluation.Cursor, Subsystem);
+		Evaluation.LastFrame = Frame;
+	};
+
+	FEntityTaskBuilder()
+		.Read(BuiltInComponents->InstanceHandle)
+		.Read(BuiltInComponents->EvalTime)
+		.Write(NoteChartComponents->NoteChart)
+		.FilterNone({ BuiltInComponents->Tags.Ignored })
+		.Iterate_PerEntity(&Linker->EntityManager, TriggerNotes);
+}
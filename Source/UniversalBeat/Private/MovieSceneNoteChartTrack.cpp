@@ -2,6 +2,7 @@
 
 #include "MovieSceneNoteChartTrack.h"
 #include "MovieSceneNoteChartSection.h"
+#include "TempoMap.h"
 
 #define LOCTEXT_NAMESPACE "MovieSceneNoteChartTrack"
 
@@ -61,6 +62,14 @@ bool UMovieSceneNoteChartTrack::IsEmpty() const
 	return NoteChartSections.Num() == 0;
 }
 
+void UMovieSceneNoteChartTrack::AppendTempoKeys(FFrameRate TickResolution, FTempoMap& OutTempoMap) const
+{
+	for (const FNoteChartTempoKey& TempoKey : TempoKeys)
+	{
+		OutTempoMap.AddKey(TickResolution.AsSeconds(TempoKey.Frame), TempoKey.BPM, TempoKey.BeatsPerBar, TempoKey.BeatUnit);
+	}
+}
+
 #if WITH_EDITORONLY_DATA
 FText UMovieSceneNoteChartTrack::GetDisplayName() const
 {
@@ -0,0 +1,325 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "NoteJudgement.h"
+#include "CompiledNoteChart.h"
+#include "NoteDataAsset.h"
+#include "Algo/BinarySearch.h"
+
+void FNoteJudgementState::Init(const FCompiledNoteChart& Chart)
+{
+	ConsumedNotes.Init(false, Chart.Num());
+	MissedNotes.Init(false, Chart.Num());
+	LaneCursors.Reset(Chart.NumLanes());
+	LaneCursors.Append(Chart.LaneOffsets.GetData(), Chart.NumLanes());
+	MissCursor = 0;
+	NumMissed = 0;
+	ActiveHolds.Reset();
+	NextHoldEnd = TNumericLimits<double>::Max();
+}
+
+void FNoteJudgementState::Rewind(const FCompiledNoteChart& Chart)
+{
+	if (!IsValidFor(Chart))
+	{
+		Init(Chart);
+		return;
+	}
+
+	// Word-wise clear, no reallocation
+	if (ConsumedNotes.Num() > 0)
+	{
+		ConsumedNotes.SetRange(0, ConsumedNotes.Num(), false);
+		MissedNotes.SetRange(0, MissedNotes.Num(), false);
+	}
+	for (int32 LaneIndex = 0; LaneIndex < LaneCursors.Num(); ++LaneIndex)
+	{
+		LaneCursors[LaneIndex] = Chart.GetLaneBegin(LaneIndex);
+	}
+	MissCursor = 0;
+	NumMissed = 0;
+	ActiveHolds.Reset();
+	NextHoldEnd = TNumericLimits<double>::Max();
+}
+
+void FNoteJudgementState::Empty()
+{
+	ConsumedNotes.Empty();
+	MissedNotes.Empty();
+	LaneCursors.Empty();
+	MissCursor = 0;
+	NumMissed = 0;
+	ActiveHolds.Reset();
+	NextHoldEnd = TNumericLimits<double>::Max();
+}
+
+bool FNoteJudgementState::IsValidFor(const FCompiledNoteChart& Chart) const
+{
+	return ConsumedNotes.Num() == Chart.Num() && MissedNotes.Num() == Chart.Num() && LaneCursors.Num() == Chart.NumLanes();
+}
+
+int32 FNoteJudgementState::FindActiveHold(const FCompiledNoteChart& Chart, int32 LaneIndex) const
+{
+	for (int32 HoldIndex = 0; HoldIndex < ActiveHolds.Num(); ++HoldIndex)
+	{
+		if (Chart.NoteLanes[ActiveHolds[HoldIndex].NoteIndex] == LaneIndex)
+		{
+			return HoldIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+namespace NoteJudgement
+{
+	static ENoteTimingDirection GetTimingDirection(float TimingOffset)
+	{
+		if (FMath::Abs(TimingOffset) < 0.001f) // Within 1ms = perfect
+		{
+			return ENoteTimingDirection::OnTime;
+		}
+		return TimingOffset < 0.0f ? ENoteTimingDirection::Early : ENoteTimingDirection::Late;
+	}
+
+	/** Offset, direction and accuracy of an input against an open note's head */
+	static FNoteJudgement JudgeTiming(const FCompiledNoteChart& Chart, int32 NoteIndex, int32 LaneEntry, double ChartTime)
+	{
+		FNoteJudgement Judgement;
+		const double NoteSeconds = Chart.NoteSeconds[NoteIndex];
+		Judgement.NoteIndex = NoteIndex;
+		Judgement.InteractionType = Chart.GetInteractionType(NoteIndex);
+		Judgement.TimingOffset = static_cast<float>(ChartTime - NoteSeconds);
+		Judgement.TimingDirection = GetTimingDirection(Judgement.TimingOffset);
+
+		// Accuracy = 1.0 - (|offset| / window on that side), windows as baked into the chart.
+		// Reading the baked bounds (not the live BPM) keeps the result a function of the chart alone.
+		const double MaxTimingWindow = (Judgement.TimingOffset < 0.0f)
+			? NoteSeconds - Chart.LaneWindowStart[LaneEntry]
+			: Chart.LaneWindowEnd[LaneEntry] - NoteSeconds;
+		const float LinearAccuracy = MaxTimingWindow > 0.0
+			? FMath::Clamp(1.0f - static_cast<float>(FMath::Abs(ChartTime - NoteSeconds) / MaxTimingWindow), 0.0f, 1.0f)
+			: 1.0f;
+		Judgement.Accuracy = Chart.ApplyAccuracyCurve(NoteIndex, LinearAccuracy);
+		return Judgement;
+	}
+
+	/**
+	 * End an active hold at a chart time and remove it from the state.
+	 * Ending within the head's pre-window of the sustain end completes the hold, earlier drops it.
+	 */
+	static FNoteJudgement EndHold(const FCompiledNoteChart& Chart, FNoteJudgementState& State, int32 HoldIndex, double ChartTime)
+	{
+		const FNoteJudgementState::FActiveHold Hold = State.ActiveHolds[HoldIndex];
+		const int32 NoteIndex = Hold.NoteIndex;
+		const double EndSeconds = Chart.NoteEndSeconds[NoteIndex];
+		const double PreWindow = Chart.NoteSeconds[NoteIndex] - Chart.LaneWindowStart[Hold.LaneEntry];
+		const int32 TotalTicks = Chart.GetSustainTicks(NoteIndex, EndSeconds);
+
+		FNoteJudgement Judgement;
+		Judgement.NoteIndex = NoteIndex;
+		Judgement.InteractionType = ENoteInteractionType::Hold;
+		Judgement.bHoldEnd = true;
+		Judgement.TimingOffset = static_cast<float>(ChartTime - EndSeconds);
+		Judgement.TimingDirection = GetTimingDirection(Judgement.TimingOffset);
+		Judgement.bDropped = ChartTime < EndSeconds - PreWindow;
+
+		// A completed hold is worth every tick; a dropped one the ticks sustained up to the release
+		Judgement.SustainTicks = Judgement.bDropped ? Chart.GetSustainTicks(NoteIndex, ChartTime) : TotalTicks;
+		Judgement.SustainRatio = !Judgement.bDropped ? 1.0f : (TotalTicks > 0 ? static_cast<float>(Judgement.SustainTicks) / TotalTicks : 0.0f);
+		Judgement.Accuracy = Judgement.bDropped ? 0.0f : Hold.PressAccuracy;
+
+		State.ActiveHolds.RemoveAtSwap(HoldIndex);
+		State.NextHoldEnd = TNumericLimits<double>::Max();
+		for (const FNoteJudgementState::FActiveHold& ActiveHold : State.ActiveHolds)
+		{
+			State.NextHoldEnd = FMath::Min(State.NextHoldEnd, Chart.NoteEndSeconds[ActiveHold.NoteIndex]);
+		}
+		return Judgement;
+	}
+
+	int32 FindOpenNote(const FCompiledNoteChart& Chart, FNoteJudgementState& State, int32 LaneIndex, double ChartTime, int32* OutLaneEntry, bool bReleaseInput)
+	{
+		// Binary search this lane for the first note whose window can still be open.
+		// No note earlier than (ChartTime - MaxPostWindow) can contain ChartTime.
+		int32& Cursor = State.LaneCursors[LaneIndex];
+		const int32 LaneEnd = Chart.GetLaneEnd(LaneIndex);
+		const int32 SearchBegin = Cursor;
+		const TArrayView<const double> LaneSeconds = MakeArrayView(Chart.LaneNoteSeconds).Slice(SearchBegin, LaneEnd - SearchBegin);
+		const int32 FirstCandidate = SearchBegin + Algo::LowerBound(LaneSeconds, ChartTime - Chart.LaneMaxPostWindow[LaneIndex]);
+
+		// The cursor only passes resolved notes: a window closed for this input can still be
+		// open for an earlier one that arrives later, so the search start is not kept
+		const double SearchEnd = ChartTime + Chart.LaneMaxPreWindow[LaneIndex];
+		for (int32 LaneEntry = FirstCandidate; LaneEntry < LaneEnd; ++LaneEntry)
+		{
+			// Past the widest pre-window: no later note in this lane can be open yet
+			if (Chart.LaneNoteSeconds[LaneEntry] > SearchEnd)
+			{
+				break;
+			}
+
+			if (ChartTime < Chart.LaneWindowStart[LaneEntry] || ChartTime > Chart.LaneWindowEnd[LaneEntry])
+			{
+				continue;
+			}
+
+			const int32 NoteIndex = Chart.LaneNoteIndices[LaneEntry];
+			if (State.IsResolved(NoteIndex))
+			{
+				// Resolved notes at the front of the lane never need to be visited again
+				if (LaneEntry == Cursor)
+				{
+					++Cursor;
+				}
+				continue;
+			}
+
+			// Presses never hit Release notes and releases only hit them
+			if ((Chart.GetInteractionType(NoteIndex) == ENoteInteractionType::Release) != bReleaseInput)
+			{
+				continue;
+			}
+
+			if (OutLaneEntry)
+			{
+				*OutLaneEntry = LaneEntry;
+			}
+			return NoteIndex;
+		}
+
+		return INDEX_NONE;
+	}
+
+	FNoteJudgement JudgeInput(const FCompiledNoteChart& Chart, FNoteJudgementState& State, FGameplayTag InputTag, double ChartTime)
+	{
+		FNoteJudgement Judgement;
+
+		const int32 LaneIndex = InputTag.IsValid() ? Chart.FindLane(InputTag) : INDEX_NONE;
+		if (LaneIndex == INDEX_NONE)
+		{
+			return Judgement;
+		}
+
+		int32 LaneEntry = INDEX_NONE;
+		const int32 NoteIndex = FindOpenNote(Chart, State, LaneIndex, ChartTime, &LaneEntry);
+		if (NoteIndex == INDEX_NONE)
+		{
+			return Judgement;
+		}
+
+		Judgement = JudgeTiming(Chart, NoteIndex, LaneEntry, ChartTime);
+		State.ConsumedNotes[NoteIndex] = true;
+
+		// A full hold array still scores the head; the sustain just goes untracked
+		if (Chart.IsSustained(NoteIndex) && Judgement.InteractionType == ENoteInteractionType::Hold && State.ActiveHolds.Num() < FNoteJudgementState::MaxActiveHolds)
+		{
+			FNoteJudgementState::FActiveHold& Hold = State.ActiveHolds.AddDefaulted_GetRef();
+			Hold.NoteIndex = NoteIndex;
+			Hold.LaneEntry = LaneEntry;
+			Hold.PressTime = ChartTime;
+			Hold.PressAccuracy = Judgement.Accuracy;
+			State.NextHoldEnd = FMath::Min(State.NextHoldEnd, Chart.NoteEndSeconds[NoteIndex]);
+		}
+		return Judgement;
+	}
+
+	FNoteJudgement JudgeRelease(const FCompiledNoteChart& Chart, FNoteJudgementState& State, FGameplayTag InputTag, double ChartTime)
+	{
+		FNoteJudgement Judgement;
+
+		const int32 LaneIndex = InputTag.IsValid() ? Chart.FindLane(InputTag) : INDEX_NONE;
+		if (LaneIndex == INDEX_NONE)
+		{
+			return Judgement;
+		}
+
+		const int32 HoldIndex = State.FindActiveHold(Chart, LaneIndex);
+		if (HoldIndex != INDEX_NONE)
+		{
+			return EndHold(Chart, State, HoldIndex, ChartTime);
+		}
+
+		int32 LaneEntry = INDEX_NONE;
+		const int32 NoteIndex = FindOpenNote(Chart, State, LaneIndex, ChartTime, &LaneEntry, /*bReleaseInput=*/true);
+		if (NoteIndex == INDEX_NONE)
+		{
+			return Judgement;
+		}
+
+		Judgement = JudgeTiming(Chart, NoteIndex, LaneEntry, ChartTime);
+		State.ConsumedNotes[NoteIndex] = true;
+		return Judgement;
+	}
+
+	int32 CompleteHolds(const FCompiledNoteChart& Chart, FNoteJudgementState& State, double ChartTime, TArray<FNoteJudgement>* OutCompleted)
+	{
+		int32 NumCompleted = 0;
+		while (State.ActiveHolds.Num() > 0 && State.NextHoldEnd <= ChartTime)
+		{
+			const int32 HoldIndex = State.ActiveHolds.IndexOfByPredicate([&Chart, &State](const FNoteJudgementState::FActiveHold& Hold)
+			{
+				return Chart.NoteEndSeconds[Hold.NoteIndex] == State.NextHoldEnd;
+			});
+			check(HoldIndex != INDEX_NONE);
+
+			const FNoteJudgement Judgement = EndHold(Chart, State, HoldIndex, State.NextHoldEnd);
+			++NumCompleted;
+			if (OutCompleted)
+			{
+				OutCompleted->Add(Judgement);
+			}
+		}
+		return NumCompleted;
+	}
+
+	int32 SweepMisses(const FCompiledNoteChart& Chart, FNoteJudgementState& State, double ChartTime, TArray<int32>* OutMissed)
+	{
+		int32 NumSwept = 0;
+		while (State.MissCursor < Chart.Num() && Chart.NoteWindowEnd[State.MissCursor] < ChartTime)
+		{
+			const int32 NoteIndex = State.MissCursor++;
+			if (State.ConsumedNotes[NoteIndex])
+			{
+				continue;
+			}
+
+			State.MissedNotes[NoteIndex] = true;
+			++NumSwept;
+			if (OutMissed)
+			{
+				OutMissed->Add(NoteIndex);
+			}
+
+			// Keep the lane cursor moving through quiet lanes so the next input starts past this note
+			const int32 LaneIndex = Chart.NoteLanes[NoteIndex];
+			int32& LaneCursor = State.LaneCursors[LaneIndex];
+			const int32 LaneEnd = Chart.GetLaneEnd(LaneIndex);
+			while (LaneCursor < LaneEnd && State.IsResolved(Chart.LaneNoteIndices[LaneCursor]))
+			{
+				++LaneCursor;
+			}
+		}
+
+		State.NumMissed += NumSwept;
+		return NumSwept;
+	}
+
+	void FillValidationResult(const FCompiledNoteChart& Chart, const FNoteJudgement& Judgement, FNoteValidationResult& OutResult)
+	{
+		OutResult.bHit = Judgement.IsHit();
+		OutResult.Accuracy = Judgement.Accuracy;
+		OutResult.TimingDirection = Judgement.TimingDirection;
+		OutResult.TimingOffset = Judgement.TimingOffset;
+		if (Judgement.NoteIndex == INDEX_NONE)
+		{
+			return;
+		}
+
+		OutResult.NoteTag = Chart.GetNoteTag(Judgement.NoteIndex);
+		OutResult.NoteData = Chart.GetNoteAsset(Judgement.NoteIndex);
+		OutResult.NoteTimestamp = Chart.NoteSeconds[Judgement.NoteIndex];
+		OutResult.InteractionType = Judgement.InteractionType;
+		OutResult.bHoldEnd = Judgement.bHoldEnd;
+		OutResult.SustainTicks = Judgement.SustainTicks;
+		OutResult.SustainRatio = Judgement.SustainRatio;
+	}
+}
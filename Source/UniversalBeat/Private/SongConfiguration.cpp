@@ -1,7 +1,11 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "SongConfiguration.h"
+#include "CookedSongChart.h"
+#include "NoteDataAsset.h"
 #include "LevelSequence.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/ObjectSaveContext.h"
 
 USongConfiguration::USongConfiguration()
 {
@@ -23,6 +27,33 @@ TArray<FString> USongConfiguration::GetValidationErrors() const
 	return Errors;
 }
 
+TSharedPtr<const FCookedSongChart, ESPMode::ThreadSafe> USongConfiguration::GetCookedChart()
+{
+	// Editor data can change at any time; only trust the blob in cooked builds
+	if (!FPlatformProperties::RequiresCookedData())
+	{
+		return nullptr;
+	}
+
+	if (!CookedChart.IsValid() && CookedChartBlob.Num() > 0)
+	{
+		TSharedPtr<FCookedSongChart, ESPMode::ThreadSafe> LoadedChart = MakeShared<FCookedSongChart, ESPMode::ThreadSafe>();
+		if (LoadedChart->LoadFromBytes(CookedChartBlob, CookedChartLanes, CookedChartNoteAssets) && LoadedChart->Tracks.Num() == Tracks.Num())
+		{
+			CookedChart = LoadedChart;
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Song '%s': Cooked chart blob is invalid or out of date, falling back to track sequences"), *SongLabel);
+		}
+
+		// The parsed charts own their data now
+		CookedChartBlob.Empty();
+	}
+
+	return CookedChart;
+}
+
 void USongConfiguration::ValidateConfiguration(TArray<FString>& OutErrors) const
 {
 	OutErrors.Empty();
@@ -149,4 +180,34 @@ void USongConfiguration::PostEditChangeProperty(FPropertyChangedEvent& PropertyC
 		}
 	}
 }
+
+void USongConfiguration::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+	CookedChartBlob.Reset();
+	CookedChartLanes.Reset();
+	CookedChartNoteAssets.Reset();
+	CookedChart.Reset();
+
+	// Editor saves keep no blob; charts are compiled from live sequences there
+	if (!ObjectSaveContext.IsCooking())
+	{
+		return;
+	}
+
+	FCookedSongChart SongChart;
+	if (!SongChart.BuildFromSong(*this, CookedChartLanes, CookedChartNoteAssets))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Song '%s': No notes found in any track, no cooked chart written"), *SongLabel);
+		CookedChartLanes.Reset();
+		CookedChartNoteAssets.Reset();
+		return;
+	}
+
+	FMemoryWriter Writer(CookedChartBlob, /*bIsPersistent*/ true);
+	SongChart.Serialize(Writer);
+
+	UE_LOG(LogTemp, Log, TEXT("Song '%s': Cooked %d track chart(s) into %d bytes"), *SongLabel, SongChart.Tracks.Num(), CookedChartBlob.Num());
+}
 #endif
\ No newline at end of file
@@ -0,0 +1,148 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TempoMap.h"
+#include "Algo/BinarySearch.h"
+
+void FTempoMap::AddKey(double Seconds, float BPM, int32 BeatsPerBar, int32 BeatUnit)
+{
+	if (BPM <= 0.0f || !FMath::IsFinite(BPM))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FTempoMap: Ignoring tempo key at %.3fs with invalid BPM %.2f"), Seconds, BPM);
+		return;
+	}
+
+	SegmentSeconds.Add(Seconds);
+	SegmentSecondsPerBeat.Add(60.0 / BPM);
+	SegmentBeatsPerBar.Add(static_cast<uint8>(FMath::Clamp(BeatsPerBar, 1, 32)));
+	SegmentBeatUnit.Add(static_cast<uint8>(FMath::Clamp(BeatUnit, 1, 32)));
+}
+
+void FTempoMap::Finalize()
+{
+	const int32 NumKeys = SegmentSeconds.Num();
+
+	// Stable so the last key authored at a time wins below
+	TArray<int32> Order;
+	Order.SetNumUninitialized(NumKeys);
+	for (int32 Index = 0; Index < NumKeys; ++Index)
+	{
+		Order[Index] = Index;
+	}
+	Order.StableSort([this](int32 A, int32 B) { return SegmentSeconds[A] < SegmentSeconds[B]; });
+
+	TArray<double> SortedSeconds;
+	TArray<double> SortedSecondsPerBeat;
+	TArray<uint8> SortedBeatsPerBar;
+	TArray<uint8> SortedBeatUnit;
+	SortedSeconds.Reserve(NumKeys);
+	SortedSecondsPerBeat.Reserve(NumKeys);
+	SortedBeatsPerBar.Reserve(NumKeys);
+	SortedBeatUnit.Reserve(NumKeys);
+
+	for (const int32 KeyIndex : Order)
+	{
+		if (SortedSeconds.Num() > 0 && SortedSeconds.Last() == SegmentSeconds[KeyIndex])
+		{
+			SortedSecondsPerBeat.Last() = SegmentSecondsPerBeat[KeyIndex];
+			SortedBeatsPerBar.Last() = SegmentBeatsPerBar[KeyIndex];
+			SortedBeatUnit.Last() = SegmentBeatUnit[KeyIndex];
+			continue;
+		}
+		SortedSeconds.Add(SegmentSeconds[KeyIndex]);
+		SortedSecondsPerBeat.Add(SegmentSecondsPerBeat[KeyIndex]);
+		SortedBeatsPerBar.Add(SegmentBeatsPerBar[KeyIndex]);
+		SortedBeatUnit.Add(SegmentBeatUnit[KeyIndex]);
+	}
+
+	SegmentSeconds = MoveTemp(SortedSeconds);
+	SegmentSecondsPerBeat = MoveTemp(SortedSecondsPerBeat);
+	SegmentBeatsPerBar = MoveTemp(SortedBeatsPerBar);
+	SegmentBeatUnit = MoveTemp(SortedBeatUnit);
+
+	// Accumulate positions; the first tempo extends back to time 0
+	const int32 NumSegments = SegmentSeconds.Num();
+	SegmentBeats.SetNumUninitialized(NumSegments);
+	SegmentBars.SetNumUninitialized(NumSegments);
+	for (int32 Segment = 0; Segment < NumSegments; ++Segment)
+	{
+		if (Segment == 0)
+		{
+			SegmentBeats[0] = SegmentSeconds[0] / SegmentSecondsPerBeat[0];
+			SegmentBars[0] = SegmentBeats[0] / SegmentBeatsPerBar[0];
+			continue;
+		}
+
+		const double SegmentLengthBeats = (SegmentSeconds[Segment] - SegmentSeconds[Segment - 1]) / SegmentSecondsPerBeat[Segment - 1];
+		SegmentBeats[Segment] = SegmentBeats[Segment - 1] + SegmentLengthBeats;
+		SegmentBars[Segment] = SegmentBars[Segment - 1] + SegmentLengthBeats / SegmentBeatsPerBar[Segment - 1];
+	}
+}
+
+void FTempoMap::Reset()
+{
+	SegmentSeconds.Reset();
+	SegmentBeats.Reset();
+	SegmentBars.Reset();
+	SegmentSecondsPerBeat.Reset();
+	SegmentBeatsPerBar.Reset();
+	SegmentBeatUnit.Reset();
+}
+
+int32 FTempoMap::FindSegment(double Seconds) const
+{
+	if (IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+	return FMath::Max(Algo::UpperBound(SegmentSeconds, Seconds) - 1, 0);
+}
+
+int32 FTempoMap::FindSegmentByBeat(double Beat) const
+{
+	if (IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+	return FMath::Max(Algo::UpperBound(SegmentBeats, Beat) - 1, 0);
+}
+
+double FTempoMap::SecondsToBeats(double Seconds) const
+{
+	const int32 Segment = FindSegment(Seconds);
+	if (Segment == INDEX_NONE)
+	{
+		return 0.0;
+	}
+	return SegmentBeats[Segment] + (Seconds - SegmentSeconds[Segment]) / SegmentSecondsPerBeat[Segment];
+}
+
+double FTempoMap::BeatsToSeconds(double Beat) const
+{
+	const int32 Segment = FindSegmentByBeat(Beat);
+	if (Segment == INDEX_NONE)
+	{
+		return 0.0;
+	}
+	return SegmentSeconds[Segment] + (Beat - SegmentBeats[Segment]) * SegmentSecondsPerBeat[Segment];
+}
+
+double FTempoMap::SecondsToBars(double Seconds) const
+{
+	const int32 Segment = FindSegment(Seconds);
+	if (Segment == INDEX_NONE)
+	{
+		return 0.0;
+	}
+	const double BeatsIntoSegment = (Seconds - SegmentSeconds[Segment]) / SegmentSecondsPerBeat[Segment];
+	return SegmentBars[Segment] + BeatsIntoSegment / SegmentBeatsPerBar[Segment];
+}
+
+SIZE_T FTempoMap::GetAllocatedSize() const
+{
+	return SegmentSeconds.GetAllocatedSize()
+		+ SegmentBeats.GetAllocatedSize()
+		+ SegmentBars.GetAllocatedSize()
+		+ SegmentSecondsPerBeat.GetAllocatedSize()
+		+ SegmentBeatsPerBar.GetAllocatedSize()
+		+ SegmentBeatUnit.GetAllocatedSize();
+}
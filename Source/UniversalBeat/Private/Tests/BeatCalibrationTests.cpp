@@ -0,0 +1,119 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+ * BeatCalibrationTests.cpp
+ *
+ * Automated test suite for the streaming calibration estimator
+ *
+ * Tests verify:
+ * - A stray tap is rejected and does not move the estimate
+ * - Consistent taps converge within a handful of samples
+ * - Scattered taps do not converge early
+ * - The window follows a player whose offset drifts or jumps
+ */
+
+#include "BeatCalibrationEstimator.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include <limits>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define BEAT_CALIBRATION_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Verify outlier rejection, the trimmed mean and early convergence
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBeatCalibrationEstimateTest,
+	"UniversalBeat.Calibration.Estimate",
+	BEAT_CALIBRATION_TEST_FLAGS
+)
+
+bool FBeatCalibrationEstimateTest::RunTest(const FString& Parameters)
+{
+	FBeatCalibrationEstimator Estimator;
+	TestFalse(TEXT("Empty estimator is not converged"), Estimator.IsConverged(1, 100.0f));
+	TestEqual(TEXT("Empty estimate is 0"), Estimator.GetEstimateMs(), 0.0f);
+
+	// A player about 30ms late, tapping within a couple of milliseconds
+	const float Taps[] = { 31.0f, 29.0f, 30.5f, 28.5f, 30.0f };
+	for (const float Tap : Taps)
+	{
+		TestTrue(TEXT("Consistent tap accepted"), Estimator.AddSample(Tap));
+	}
+	TestEqual(TEXT("Median"), Estimator.GetMedianMs(), 30.0f, 1e-4f);
+	TestEqual(TEXT("Trimmed mean"), Estimator.GetEstimateMs(), 29.833f, 0.01f);
+	TestTrue(TEXT("Converged after five taps"), Estimator.IsConverged(4, 3.0f));
+
+	// One distracted tap is thrown away
+	TestFalse(TEXT("Stray tap rejected"), Estimator.AddSample(120.0f));
+	TestEqual(TEXT("Rejection counted"), Estimator.GetNumRejected(), 1);
+	TestEqual(TEXT("Window unchanged"), Estimator.Num(), 5);
+	TestEqual(TEXT("Estimate unchanged"), Estimator.GetEstimateMs(), 29.833f, 0.01f);
+
+	// Taps that are not on any beat are never samples
+	TestFalse(TEXT("Out of range rejected"), Estimator.AddSample(400.0f));
+	TestFalse(TEXT("NaN rejected"), Estimator.AddSample(std::numeric_limits<float>::quiet_NaN()));
+
+	// Before rejection kicks in, an outlier barely moves the trimmed mean
+	Estimator.Reset();
+	TestEqual(TEXT("Reset clears rejections"), Estimator.GetNumRejected(), 0);
+	const float EarlyTaps[] = { 20.0f, 22.0f, 90.0f, 21.0f, 19.0f };
+	for (const float Tap : EarlyTaps)
+	{
+		Estimator.AddSample(Tap);
+	}
+	TestEqual(TEXT("Median ignores the outlier"), Estimator.GetMedianMs(), 21.0f, 1e-4f);
+	TestEqual(TEXT("Trimmed mean ignores the outlier"), Estimator.GetEstimateMs(), 21.0f, 1e-4f);
+
+	// Scattered taps need many more samples before the error is small
+	Estimator.Reset();
+	FRandomStream Random(11);
+	for (int32 TapIndex = 0; TapIndex < 8; ++TapIndex)
+	{
+		Estimator.AddSample(Random.FRandRange(-40.0f, 40.0f));
+	}
+	TestFalse(TEXT("Scattered taps not converged"), Estimator.IsConverged(4, 3.0f));
+	TestTrue(TEXT("Scattered taps have a wide deviation"), Estimator.GetDeviationMs() > 10.0f);
+
+	return true;
+}
+
+/**
+ * Verify the window tracks drift and a change of offset
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBeatCalibrationTrackingTest,
+	"UniversalBeat.Calibration.Tracking",
+	BEAT_CALIBRATION_TEST_FLAGS
+)
+
+bool FBeatCalibrationTrackingTest::RunTest(const FString& Parameters)
+{
+	FBeatCalibrationEstimator Estimator;
+
+	// Slow drift from 0ms to 20ms over a long session
+	FRandomStream Random(5);
+	const int32 NumTaps = 4 * FBeatCalibrationEstimator::MaxSamples;
+	for (int32 TapIndex = 0; TapIndex < NumTaps; ++TapIndex)
+	{
+		const float Drift = 20.0f * TapIndex / (NumTaps - 1);
+		Estimator.AddSample(Drift + Random.FRandRange(-2.0f, 2.0f));
+	}
+	TestEqual(TEXT("Window is bounded"), Estimator.Num(), FBeatCalibrationEstimator::MaxSamples);
+	TestTrue(TEXT("Estimate follows the drift"), Estimator.GetEstimateMs() > 15.0f);
+
+	// New headphones: every tap is suddenly 60ms later
+	int32 NumAccepted = 0;
+	for (int32 TapIndex = 0; TapIndex < FBeatCalibrationEstimator::MaxSamples; ++TapIndex)
+	{
+		NumAccepted += Estimator.AddSample(80.0f + Random.FRandRange(-2.0f, 2.0f)) ? 1 : 0;
+	}
+	TestEqual(TEXT("A run of rejections is taken as a new offset"), NumAccepted, FBeatCalibrationEstimator::MaxSamples - FBeatCalibrationEstimator::MaxConsecutiveRejections);
+	TestEqual(TEXT("Estimate settles on the new offset"), Estimator.GetEstimateMs(), 80.0f, 2.0f);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+ * BeatClockTests.cpp
+ *
+ * Automated test suite for the analytic beat clock
+ *
+ * Tests verify:
+ * - Phase, tick and beat number derived from anchor + BPM
+ * - Calibration offset shifts phase without changing tempo
+ * - Tempo changes and pause/resume keep the beat position continuous
+ */
+
+#include "BeatClock.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define BEAT_CLOCK_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Verify phase/tick/beat number at known times for 120 BPM, 16 ticks per beat
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBeatClockPhaseTest,
+	"UniversalBeat.BeatClock.Phase",
+	BEAT_CLOCK_TEST_FLAGS
+)
+
+bool FBeatClockPhaseTest::RunTest(const FString& Parameters)
+{
+	FBeatClock Clock;
+	TestEqual(TEXT("Unstarted clock reports edge phase"), Clock.GetBeatPhase(0.0), -1.0f);
+	TestEqual(TEXT("Unstarted clock reports beat 0"), Clock.GetBeatNumber(5.0), 0);
+
+	// 120 BPM = 0.5s per beat, 16 ticks per beat = 31.25ms per tick
+	const double Anchor = 100.0;
+	Clock.Start(Anchor, 120.0f, 16);
+
+	TestEqual(TEXT("Seconds per tick"), Clock.GetSecondsPerTick(), 0.03125, 1e-9);
+	TestEqual(TEXT("Phase at tick start = +1"), Clock.GetBeatPhase(Anchor), 1.0f, 1e-4f);
+	TestEqual(TEXT("Phase at tick midpoint = 0"), Clock.GetBeatPhase(Anchor + 0.015625), 0.0f, 1e-4f);
+	TestEqual(TEXT("Phase near next tick ~ -1"), Clock.GetBeatPhase(Anchor + 0.0312), -1.0f, 0.01f);
+
+	TestEqual(TEXT("Tick after 1s = 32"), Clock.GetTick(Anchor + 1.0 + 1e-6), (int64)32);
+	TestEqual(TEXT("Beat number after 1.25s = 2"), Clock.GetBeatNumber(Anchor + 1.25), 2);
+	TestEqual(TEXT("Tick 32 fires 1s after anchor"), Clock.GetTickTime(32), Anchor + 1.0, 1e-9);
+
+	return true;
+}
+
+/**
+ * Verify calibration offset and tempo changes
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBeatClockContinuityTest,
+	"UniversalBeat.BeatClock.Continuity",
+	BEAT_CLOCK_TEST_FLAGS
+)
+
+bool FBeatClockContinuityTest::RunTest(const FString& Parameters)
+{
+	// Offset shifts phase, not rate
+	{
+		FBeatClock Clock;
+		Clock.Start(0.0, 60.0f, 16);
+		Clock.SetOffset(0.1);
+		TestEqual(TEXT("Offset delays beat position"), Clock.GetBeatPosition(1.1), 1.0, 1e-9);
+		TestEqual(TEXT("Offset does not change tempo"), Clock.GetSecondsPerBeat(), 1.0, 1e-9);
+	}
+
+	// Tempo change keeps beat position continuous
+	{
+		FBeatClock Clock;
+		Clock.Start(0.0, 60.0f, 16);
+		const double BeforeChange = Clock.GetBeatPosition(4.0);
+		Clock.SetBPM(4.0, 120.0f);
+		TestEqual(TEXT("No discontinuity at tempo change"), Clock.GetBeatPosition(4.0), BeforeChange, 1e-9);
+		TestEqual(TEXT("New tempo after change"), Clock.GetBeatPosition(5.0), 6.0, 1e-9);
+	}
+
+	// Pause freezes, resume continues
+	{
+		FBeatClock Clock;
+		Clock.Start(0.0, 60.0f, 16);
+		Clock.Pause(2.0);
+		TestEqual(TEXT("Paused clock is frozen"), Clock.GetBeatPosition(10.0), 2.0, 1e-9);
+		Clock.Resume(10.0);
+		TestEqual(TEXT("Resumed clock continues from pause point"), Clock.GetBeatPosition(11.0), 3.0, 1e-9);
+	}
+
+	// Rebase moves the clock to another time domain
+	{
+		FBeatClock Clock;
+		Clock.Start(50.0, 60.0f, 16);
+		const double Beat = Clock.GetBeatPosition(53.0);
+		Clock.Rebase(53.0, 3.0);
+		TestEqual(TEXT("Rebase preserves beat position"), Clock.GetBeatPosition(3.0), Beat, 1e-9);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
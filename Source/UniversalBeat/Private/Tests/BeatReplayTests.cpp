@@ -0,0 +1,223 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+ * BeatReplayTests.cpp
+ *
+ * Automated test suite for input replay recording
+ *
+ * Tests verify:
+ * - Events read back with their kind, name and microsecond timestamp, across a ring wrap
+ * - Passes split at pass starts and feed a simulation to the same judgements as the original inputs
+ * - A five-minute chart of presses records in a few KB; palettes past the inline limit still decode
+ */
+
+#include "BeatReplay.h"
+#include "BeatSimulation.h"
+#include "BeatTestCharts.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryReader.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define BEAT_REPLAY_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Verify events round-trip and passes split
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBeatReplayRoundTripTest,
+	"UniversalBeat.Replay.RoundTrip",
+	BEAT_REPLAY_TEST_FLAGS
+)
+
+bool FBeatReplayRoundTripTest::RunTest(const FString& Parameters)
+{
+	const FGameplayTag Left = FGameplayTag::RequestGameplayTag(FName("Input.Left"));
+	const FGameplayTag Right = FGameplayTag::RequestGameplayTag(FName("Input.Right"));
+
+	FBeatReplayRecorder Recorder;
+	Recorder.StartInMemory(100.0, 120.0f, 12.5f);
+	Recorder.RecordPassStart(100.5);
+	Recorder.RecordInput(Left, 1.000001, false);
+	Recorder.RecordInput(Right, 0.98, false);
+	Recorder.RecordInput(Left, 1.5, true);
+	Recorder.RecordTempoChange(102.0, 140.0f);
+	Recorder.RecordBeatCheck(FName("Jump"), 102.25);
+	Recorder.RecordPassStart(104.5);
+	Recorder.RecordInput(Left, 1.01, false);
+	Recorder.RecordCalibrationChange(106.0, -8.0f);
+	Recorder.Stop();
+	TestEqual(TEXT("Nothing dropped"), Recorder.GetNumDroppedEvents(), 0);
+
+	TArray<uint8> Bytes = Recorder.GetRecordedBytes();
+	TestEqual(TEXT("Everything reached the sink"), static_cast<uint64>(Bytes.Num()), Recorder.GetNumBytesRecorded());
+
+	{
+		FMemoryReader Archive(Bytes);
+		FBeatReplayReader Reader(Archive);
+		TestTrue(TEXT("Header read"), Reader.IsValid());
+		TestEqual(TEXT("Start BPM"), Reader.GetStartBPM(), 120.0f);
+		TestEqual(TEXT("Start calibration"), Reader.GetStartCalibrationOffsetMs(), 12.5f);
+
+		FBeatReplayEvent Event;
+		TestTrue(TEXT("Pass start"), Reader.ReadEvent(Event) && Event.Type == EBeatReplayEventType::PassStart);
+		TestEqual(TEXT("Clock time is relative to the start"), Event.Time, 0.5, 1e-9);
+		TestTrue(TEXT("Press"), Reader.ReadEvent(Event) && Event.Type == EBeatReplayEventType::Press);
+		TestEqual(TEXT("Press tag"), Event.Name, Left.GetTagName());
+		TestEqual(TEXT("Microsecond timestamp"), Event.Time, 1.000001, 1e-9);
+		TestTrue(TEXT("Earlier press"), Reader.ReadEvent(Event) && Event.Name == Right.GetTagName());
+		TestEqual(TEXT("Negative delta"), Event.Time, 0.98, 1e-9);
+		TestTrue(TEXT("Release"), Reader.ReadEvent(Event) && Event.Type == EBeatReplayEventType::Release);
+		TestTrue(TEXT("Tempo"), Reader.ReadEvent(Event) && Event.Type == EBeatReplayEventType::TempoChange);
+		TestEqual(TEXT("Tempo value"), Event.Value, 140.0f);
+		TestEqual(TEXT("Current BPM follows"), Reader.GetCurrentBPM(), 140.0f);
+		TestTrue(TEXT("Beat check"), Reader.ReadEvent(Event) && Event.Type == EBeatReplayEventType::BeatCheck);
+		TestEqual(TEXT("Beat check label"), Event.Name, FName("Jump"));
+		TestEqual(TEXT("Beat check clock time"), Event.Time, 2.25, 1e-9);
+	}
+
+	{
+		FMemoryReader Archive(Bytes);
+		FBeatReplayReader Reader(Archive);
+		TArray<FBeatInputEvent> Pass;
+		TestTrue(TEXT("First pass"), Reader.ReadPass(Pass));
+		TestEqual(TEXT("First pass inputs"), Pass.Num(), 3);
+		TestTrue(TEXT("Release flag"), Pass.Num() == 3 && Pass[2].bIsRelease && Pass[2].InputTag == Left);
+		TestTrue(TEXT("Second pass"), Reader.ReadPass(Pass));
+		TestEqual(TEXT("Second pass inputs"), Pass.Num(), 1);
+		TestEqual(TEXT("Calibration read along the way"), Reader.GetCurrentCalibrationOffsetMs(), -8.0f);
+		TestFalse(TEXT("No third pass"), Reader.ReadPass(Pass));
+	}
+
+	// More names than the header byte holds, and enough bytes to wrap the ring several times
+	Recorder.StartInMemory(0.0, 120.0f, 0.0f);
+	for (int32 EventIndex = 0; EventIndex < 60000; ++EventIndex)
+	{
+		Recorder.RecordBeatCheck(FName(TEXT("Label"), EventIndex % 100), EventIndex * 0.01);
+	}
+	Recorder.Stop();
+	TestTrue(TEXT("Ring wrapped"), Recorder.GetNumBytesRecorded() > FBeatReplayRecorder::DefaultCapacity * 2);
+
+	Bytes = Recorder.GetRecordedBytes();
+	FMemoryReader Archive(Bytes);
+	FBeatReplayReader Reader(Archive);
+	int32 NumRead = 0;
+	bool bAllMatch = true;
+	FBeatReplayEvent Event;
+	while (Reader.ReadEvent(Event))
+	{
+		const int32 Expected = NumRead++;
+		bAllMatch &= Event.Name == FName(TEXT("Label"), Expected % 100) && FMath::IsNearlyEqual(Event.Time, Expected * 0.01, 1e-6);
+	}
+	// A slow sink may drop whole events, never part of one
+	TestEqual(TEXT("Every event read back or counted as dropped"), NumRead + Recorder.GetNumDroppedEvents(), 60000);
+	TestTrue(TEXT("Stream stays decodable"), Reader.IsValid());
+	if (Recorder.GetNumDroppedEvents() == 0)
+	{
+		TestTrue(TEXT("Escaped palette indices decode"), bAllMatch);
+	}
+
+	return true;
+}
+
+/**
+ * Verify a recorded pass replays to the same judgements in a compact stream
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBeatReplaySimulationTest,
+	"UniversalBeat.Replay.Simulation",
+	BEAT_REPLAY_TEST_FLAGS
+)
+
+bool FBeatReplaySimulationTest::RunTest(const FString& Parameters)
+{
+	// Five minutes of alternating left/right presses, four per second, quarter windows at 120 BPM
+	const TCHAR* TagNames[] = { TEXT("Input.Left"), TEXT("Input.Right") };
+	UNoteDataAsset* NoteAssets[2];
+	for (int32 NoteType = 0; NoteType < 2; ++NoteType)
+	{
+		NoteAssets[NoteType] = BeatTestCharts::MakeNote(TagNames[NoteType], ENoteInteractionType::Press, EMusicalNoteValue::Sixteenth, EMusicalNoteValue::Sixteenth);
+	}
+
+	UMovieSceneNoteChartSection* Section = BeatTestCharts::MakeSection();
+	TMovieSceneChannelData<FNoteChannelValue> ChannelData = Section->GetNoteChannel().GetData();
+	for (int32 NoteIndex = 0; NoteIndex < 5 * 60 * 4; ++NoteIndex)
+	{
+		ChannelData.AddKey(FFrameNumber(NoteIndex * 6000), FNoteChannelValue(NoteAssets[NoteIndex % 2]));
+	}
+
+	TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> Chart = BeatTestCharts::MakeSharedChart(*Section);
+
+	FBeatSimulation Original;
+	Original.Chart = Chart;
+	FBeatAutoplayPolicy Policy;
+	Policy.TimingErrorSeconds = 0.03f;
+	Policy.MissChance = 0.05f;
+	Policy.Seed = 11;
+	BeatSimulation::MakeAutoplayInputs(*Chart, Policy, Original.Inputs);
+
+	// The stream keeps whole microseconds, so the original pass plays from timestamps the
+	// replay can reproduce bit for bit
+	for (FBeatInputEvent& Input : Original.Inputs)
+	{
+		Input.Timestamp = FMath::RoundToInt64(Input.Timestamp * BeatReplay::TicksPerSecond) / BeatReplay::TicksPerSecond;
+	}
+	Original.Run();
+
+	FBeatReplayRecorder Recorder;
+	Recorder.StartInMemory(0.0, 120.0f, 0.0f);
+	Recorder.RecordPassStart(0.0);
+	for (const FBeatInputEvent& Input : Original.Inputs)
+	{
+		Recorder.RecordInput(Input.InputTag, Input.Timestamp, Input.bIsRelease);
+	}
+	Recorder.Stop();
+
+	const TArray<uint8>& Bytes = Recorder.GetRecordedBytes();
+	AddInfo(FString::Printf(TEXT("%d inputs recorded in %d bytes"), Original.Inputs.Num(), Bytes.Num()));
+	TestTrue(TEXT("A few KB for five minutes"), Bytes.Num() < 6 * 1024);
+
+	FMemoryReader Archive(Bytes);
+	FBeatReplayReader Reader(Archive);
+	FBeatSimulation Replayed;
+	Replayed.Chart = Chart;
+	TestTrue(TEXT("Pass read"), Reader.ReadPass(Replayed.Inputs));
+	TestEqual(TEXT("Every input read"), Replayed.Inputs.Num(), Original.Inputs.Num());
+	Replayed.Run();
+
+	int32 FirstInputMismatch = INDEX_NONE;
+	for (int32 InputIndex = 0; InputIndex < FMath::Min(Replayed.Inputs.Num(), Original.Inputs.Num()); ++InputIndex)
+	{
+		const FBeatInputEvent& A = Replayed.Inputs[InputIndex];
+		const FBeatInputEvent& B = Original.Inputs[InputIndex];
+		if (A.InputTag != B.InputTag || A.Timestamp != B.Timestamp || A.bIsRelease != B.bIsRelease)
+		{
+			FirstInputMismatch = InputIndex;
+			break;
+		}
+	}
+	TestEqual(TEXT("Every input has its exact tag and timestamp"), FirstInputMismatch, INDEX_NONE);
+
+	TestEqual(TEXT("One judgement per input"), Replayed.Results.Num(), Original.Results.Num());
+	int32 FirstJudgementMismatch = INDEX_NONE;
+	for (int32 ResultIndex = 0; ResultIndex < FMath::Min(Replayed.Results.Num(), Original.Results.Num()); ++ResultIndex)
+	{
+		const FNoteJudgement& A = Replayed.Results[ResultIndex];
+		const FNoteJudgement& B = Original.Results[ResultIndex];
+		if (A.NoteIndex != B.NoteIndex || A.Accuracy != B.Accuracy || A.TimingOffset != B.TimingOffset
+			|| A.TimingDirection != B.TimingDirection)
+		{
+			FirstJudgementMismatch = ResultIndex;
+			break;
+		}
+	}
+	TestEqual(TEXT("Every judgement identical"), FirstJudgementMismatch, INDEX_NONE);
+
+	TestEqual(TEXT("Same hits"), Replayed.Summary.NumHits, Original.Summary.NumHits);
+	TestEqual(TEXT("Same misses"), Replayed.Summary.NumMissed, Original.Summary.NumMissed);
+	TestEqual(TEXT("Same accuracy sum"), Replayed.Summary.AccuracySum, Original.Summary.AccuracySum);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,182 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+ * BeatSimulationTests.cpp
+ *
+ * Automated test suite for headless chart simulation and autoplay
+ *
+ * Tests verify:
+ * - A perfect autoplay bot hits every note, completes every hold and misses nothing
+ * - Autoplay inputs are reproducible from the policy seed; skipped notes are swept as misses
+ * - Simulations judge like sessions and report the same Blueprint-facing results
+ * - Batched parallel runs match single runs
+ */
+
+#include "BeatSimulation.h"
+#include "BeatSession.h"
+#include "BeatTestCharts.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define BEAT_SIMULATION_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace BeatSimulationTests
+{
+	/**
+	 * Left presses at 1s and 2s, right press at 1s, up hold from 3s to 4s, down release at 5s,
+	 * eighth-note windows baked at 120 BPM (0.25s)
+	 */
+	TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> BuildChart()
+	{
+		UNoteDataAsset* HoldNote = BeatTestCharts::MakeNote(TEXT("Input.Up"), ENoteInteractionType::Hold);
+		UNoteDataAsset* ReleaseNote = BeatTestCharts::MakeNote(TEXT("Input.Down"), ENoteInteractionType::Release);
+
+		UMovieSceneNoteChartSection* Section = BeatTestCharts::MakeChordSection();
+		TMovieSceneChannelData<FNoteChannelValue> ChannelData = Section->GetNoteChannel().GetData();
+		ChannelData.AddKey(FFrameNumber(72000), FNoteChannelValue(HoldNote, FFrameNumber(24000)));
+		ChannelData.AddKey(FFrameNumber(120000), FNoteChannelValue(ReleaseNote));
+
+		return BeatTestCharts::MakeSharedChart(*Section);
+	}
+}
+
+/**
+ * Verify a perfect bot clears the chart and skipped notes are missed
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBeatSimulationAutoplayTest,
+	"UniversalBeat.Simulation.Autoplay",
+	BEAT_SIMULATION_TEST_FLAGS
+)
+
+bool FBeatSimulationAutoplayTest::RunTest(const FString& Parameters)
+{
+	FBeatSimulation Simulation;
+	Simulation.Chart = BeatSimulationTests::BuildChart();
+
+	FBeatAutoplayPolicy Perfect;
+	BeatSimulation::MakeAutoplayInputs(*Simulation.Chart, Perfect, Simulation.Inputs);
+	TestEqual(TEXT("One input per note"), Simulation.Inputs.Num(), 5);
+	TestTrue(TEXT("Release note gets a release"), Simulation.Inputs.Last().bIsRelease);
+
+	Simulation.Run();
+	TestEqual(TEXT("Every note hit"), Simulation.Summary.NumHits, 5);
+	TestEqual(TEXT("Nothing missed"), Simulation.Summary.NumMissed, 0);
+	TestEqual(TEXT("Hold completed at its end"), Simulation.Summary.NumHoldsCompleted, 1);
+	TestEqual(TEXT("Completion reported"), Simulation.CompletedHolds.Num(), 1);
+	TestEqual(TEXT("Perfect accuracy"), Simulation.Summary.GetMeanAccuracy(), 1.0f, 1e-4f);
+
+	// The same seed reproduces the same stream
+	FBeatAutoplayPolicy Sloppy;
+	Sloppy.TimingErrorSeconds = 0.05f;
+	Sloppy.Seed = 7;
+	TArray<FBeatInputEvent> First;
+	TArray<FBeatInputEvent> Second;
+	BeatSimulation::MakeAutoplayInputs(*Simulation.Chart, Sloppy, First);
+	BeatSimulation::MakeAutoplayInputs(*Simulation.Chart, Sloppy, Second);
+	TestEqual(TEXT("Same input count"), First.Num(), Second.Num());
+	for (int32 InputIndex = 0; InputIndex < FMath::Min(First.Num(), Second.Num()); ++InputIndex)
+	{
+		TestEqual(TEXT("Same timestamps"), First[InputIndex].Timestamp, Second[InputIndex].Timestamp);
+	}
+
+	// A bot that never plays misses the whole chart once it is played out
+	FBeatAutoplayPolicy Absent;
+	Absent.MissChance = 1.0f;
+	BeatSimulation::MakeAutoplayInputs(*Simulation.Chart, Absent, Simulation.Inputs);
+	TestEqual(TEXT("No inputs"), Simulation.Inputs.Num(), 0);
+	Simulation.Run();
+	TestEqual(TEXT("Every note missed"), Simulation.Summary.NumMissed, 5);
+	TestEqual(TEXT("No holds completed"), Simulation.Summary.NumHoldsCompleted, 0);
+
+	// Letting go early drops the hold
+	FBeatAutoplayPolicy Dropper;
+	Dropper.DropHoldChance = 1.0f;
+	BeatSimulation::MakeAutoplayInputs(*Simulation.Chart, Dropper, Simulation.Inputs);
+	Simulation.Run();
+	TestEqual(TEXT("Hold dropped"), Simulation.Summary.NumHoldsDropped, 1);
+	TestEqual(TEXT("Dropped hold not completed"), Simulation.Summary.NumHoldsCompleted, 0);
+
+	return true;
+}
+
+/**
+ * Verify simulations judge like sessions and batches match single runs
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBeatSimulationParityTest,
+	"UniversalBeat.Simulation.Parity",
+	BEAT_SIMULATION_TEST_FLAGS
+)
+
+bool FBeatSimulationParityTest::RunTest(const FString& Parameters)
+{
+	const TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> Chart = BeatSimulationTests::BuildChart();
+
+	FBeatAutoplayPolicy Policy;
+	Policy.TimingErrorSeconds = 0.04f;
+	Policy.TimingBiasSeconds = 0.01f;
+	Policy.MissChance = 0.2f;
+	Policy.Seed = 3;
+
+	FBeatSimulation Simulation;
+	Simulation.Chart = Chart;
+	Simulation.CalibrationOffsetSeconds = 0.01;
+	BeatSimulation::MakeAutoplayInputs(*Chart, Policy, Simulation.Inputs);
+	Simulation.Inputs.Emplace(FGameplayTag::RequestGameplayTag(FName("Input.Jump")), 1.5);
+	Simulation.Run();
+
+	FBeatSession Session;
+	Session.SetChart(Chart);
+	Session.CalibrationOffsetSeconds = 0.01;
+	Session.PendingInputs = Simulation.Inputs;
+	Session.Evaluate();
+
+	TestEqual(TEXT("Same result count"), Simulation.Results.Num(), Session.Results.Num());
+	for (int32 InputIndex = 0; InputIndex < FMath::Min(Simulation.Results.Num(), Session.Results.Num()); ++InputIndex)
+	{
+		TestEqual(TEXT("Same note"), Simulation.Results[InputIndex].NoteIndex, Session.Results[InputIndex].NoteIndex);
+		TestEqual(TEXT("Same accuracy"), Simulation.Results[InputIndex].Accuracy, Session.Results[InputIndex].Accuracy);
+	}
+
+	TArray<FNoteValidationResult> ValidationResults;
+	Simulation.GetValidationResults(ValidationResults);
+	TestEqual(TEXT("One result per input"), ValidationResults.Num(), Simulation.Inputs.Num());
+	for (int32 InputIndex = 0; InputIndex < ValidationResults.Num(); ++InputIndex)
+	{
+		const FNoteJudgement& Judgement = Simulation.Results[InputIndex];
+		TestEqual(TEXT("Hit flag"), ValidationResults[InputIndex].bHit, Judgement.IsHit());
+		TestEqual(TEXT("Input timestamp"), ValidationResults[InputIndex].InputTimestamp, Simulation.Inputs[InputIndex].Timestamp);
+		if (Judgement.NoteIndex != INDEX_NONE)
+		{
+			TestEqual(TEXT("Note asset"), ValidationResults[InputIndex].NoteData.Get(), static_cast<const UNoteDataAsset*>(Chart->GetNoteAsset(Judgement.NoteIndex)));
+		}
+	}
+
+	// Many bots over one shared chart at once
+	TArray<FBeatSimulation> Batch;
+	for (int32 Seed = 0; Seed < 32; ++Seed)
+	{
+		FBeatSimulation& Bot = Batch.AddDefaulted_GetRef();
+		Bot.Chart = Chart;
+		Policy.Seed = Seed;
+		BeatSimulation::MakeAutoplayInputs(*Chart, Policy, Bot.Inputs);
+	}
+	BeatSimulation::RunBatch(Batch);
+
+	for (FBeatSimulation& Bot : Batch)
+	{
+		FBeatSimulation Single;
+		Single.Chart = Chart;
+		Single.Inputs = Bot.Inputs;
+		Single.Run();
+		TestEqual(TEXT("Batched hits match"), Bot.Summary.NumHits, Single.Summary.NumHits);
+		TestEqual(TEXT("Batched misses match"), Bot.Summary.NumMissed, Single.Summary.NumMissed);
+		TestEqual(TEXT("Batched accuracy matches"), Bot.Summary.AccuracySum, Single.Summary.AccuracySum);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
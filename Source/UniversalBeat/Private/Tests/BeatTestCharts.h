@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CompiledNoteChart.h"
+#include "MovieSceneNoteChartSection.h"
+#include "NoteDataAsset.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Chart fixtures shared by the UniversalBeat test suites
+ *
+ * Sections are keyed at 24000 ticks per second and charts are baked at 120 BPM,
+ * so frame 24000 is a note at 1s and an eighth-note window is 0.25s.
+ */
+namespace BeatTestCharts
+{
+	/** Tick resolution test sections are keyed at */
+	inline FFrameRate GetTickResolution() { return FFrameRate(24000, 1); }
+
+	/** Tempo test charts are baked at (one beat is 0.5s) */
+	inline constexpr float BakeBPM = 120.0f;
+
+	/** Transient note asset for a lane */
+	inline UNoteDataAsset* MakeNote(
+		FGameplayTag Tag,
+		ENoteInteractionType InteractionType = ENoteInteractionType::Press,
+		EMusicalNoteValue PreTiming = EMusicalNoteValue::Eighth,
+		EMusicalNoteValue PostTiming = EMusicalNoteValue::Eighth)
+	{
+		UNoteDataAsset* NoteData = NewObject<UNoteDataAsset>(GetTransientPackage());
+		NoteData->NoteTag = Tag;
+		NoteData->PreTiming = PreTiming;
+		NoteData->PostTiming = PostTiming;
+		NoteData->InteractionType = InteractionType;
+		return NoteData;
+	}
+
+	inline UNoteDataAsset* MakeNote(
+		const TCHAR* Tag,
+		ENoteInteractionType InteractionType = ENoteInteractionType::Press,
+		EMusicalNoteValue PreTiming = EMusicalNoteValue::Eighth,
+		EMusicalNoteValue PostTiming = EMusicalNoteValue::Eighth)
+	{
+		return MakeNote(FGameplayTag::RequestGameplayTag(FName(Tag)), InteractionType, PreTiming, PostTiming);
+	}
+
+	/** Transient, unbounded section with no keys */
+	inline UMovieSceneNoteChartSection* MakeSection()
+	{
+		UMovieSceneNoteChartSection* Section = NewObject<UMovieSceneNoteChartSection>(GetTransientPackage());
+		Section->SetRange(TRange<FFrameNumber>::All());
+		return Section;
+	}
+
+	/** Left notes at 1s and 2s, right note at 1s, eighth-note windows */
+	inline UMovieSceneNoteChartSection* MakeChordSection()
+	{
+		UNoteDataAsset* LeftNote = MakeNote(TEXT("Input.Left"));
+		UNoteDataAsset* RightNote = MakeNote(TEXT("Input.Right"));
+
+		UMovieSceneNoteChartSection* Section = MakeSection();
+		TMovieSceneChannelData<FNoteChannelValue> ChannelData = Section->GetNoteChannel().GetData();
+		ChannelData.AddKey(FFrameNumber(24000), FNoteChannelValue(LeftNote));
+		ChannelData.AddKey(FFrameNumber(24000), FNoteChannelValue(RightNote));
+		ChannelData.AddKey(FFrameNumber(48000), FNoteChannelValue(LeftNote));
+		return Section;
+	}
+
+	/** Compile one section into a chart and bake its windows; a BPM of 0 leaves them unbaked */
+	inline void CompileChart(FCompiledNoteChart& Chart, const UMovieSceneNoteChartSection& Section, float BPM = BakeBPM)
+	{
+		Chart.AddSection(Section, GetTickResolution());
+		Chart.Finalize();
+		if (BPM > 0.0f)
+		{
+			Chart.BakeWindows(BPM);
+		}
+	}
+
+	/** Compile one section into a chart sessions can share */
+	inline TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> MakeSharedChart(const UMovieSceneNoteChartSection& Section, float BPM = BakeBPM)
+	{
+		TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> Chart = MakeShared<FCompiledNoteChart, ESPMode::ThreadSafe>();
+		CompileChart(*Chart, Section, BPM);
+		return Chart;
+	}
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+ * BeatTimingStatsTests.cpp
+ *
+ * Automated test suite for the timing histograms
+ *
+ * Tests verify:
+ * - Percentiles are accurate to one bin width and stay within the recorded samples
+ * - Out-of-range samples land in the edge bins but keep exact min, max and mean
+ */
+
+#include "BeatTimingStats.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define BEAT_TIMING_STATS_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Verify percentiles and range handling of FBeatTimingHistogram
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBeatTimingHistogramTest,
+	"UniversalBeat.TimingStats.Histogram",
+	BEAT_TIMING_STATS_TEST_FLAGS
+)
+
+bool FBeatTimingHistogramTest::RunTest(const FString& Parameters)
+{
+	FBeatTimingHistogram Histogram(0.0f, 64.0f);
+	TestEqual(TEXT("Empty percentile"), Histogram.GetPercentile(50.0f), 0.0f);
+	TestEqual(TEXT("One bin per ms"), Histogram.GetBinWidth(), 1.0f, 1e-6f);
+
+	// Uniform 0..63ms
+	for (int32 Ms = 0; Ms < 64; ++Ms)
+	{
+		Histogram.Record(Ms + 0.5f);
+	}
+	TestEqual(TEXT("Sample count"), Histogram.Num(), 64u);
+	TestEqual(TEXT("Mean"), Histogram.GetMean(), 32.0f, 1e-4f);
+	TestEqual(TEXT("Median within a bin"), Histogram.GetPercentile(50.0f), 32.0f, Histogram.GetBinWidth());
+	TestEqual(TEXT("p95 within a bin"), Histogram.GetPercentile(95.0f), 60.8f, Histogram.GetBinWidth());
+	TestEqual(TEXT("p0 is the minimum"), Histogram.GetPercentile(0.0f), 0.5f, 1e-6f);
+	TestEqual(TEXT("p100 is the maximum"), Histogram.GetPercentile(100.0f), 63.5f, 1e-6f);
+
+	// Outliers are clamped into the edge bins, the extremes stay exact
+	Histogram.Reset();
+	Histogram.Record(-10.0f);
+	Histogram.Record(500.0f);
+	TestEqual(TEXT("Low outlier in first bin"), Histogram.GetBinCount(0), 1u);
+	TestEqual(TEXT("High outlier in last bin"), Histogram.GetBinCount(FBeatTimingHistogram::NumBins - 1), 1u);
+	TestEqual(TEXT("Exact min"), Histogram.GetMin(), -10.0f);
+	TestEqual(TEXT("Exact max"), Histogram.GetMax(), 500.0f);
+	TestEqual(TEXT("Exact mean"), Histogram.GetMean(), 245.0f, 1e-4f);
+
+	FBeatTimingStats Stats;
+	Stats.JudgementOffset.Record(-12.0f);
+	++Stats.NumNoteHits;
+	Stats.Reset();
+	TestEqual(TEXT("Stats reset"), Stats.JudgementOffset.Num() + Stats.NumNoteHits, 0u);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
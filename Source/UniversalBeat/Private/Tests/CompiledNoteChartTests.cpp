@@ -0,0 +1,224 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+ * CompiledNoteChartTests.cpp
+ *
+ * Automated test suite for the structure-of-arrays note chart
+ *
+ * Tests verify:
+ * - Channel keys are converted with the tick resolution and sorted by time
+ * - Lanes are grouped per gameplay tag and stay time-ordered
+ * - Asset palette is deduplicated and windows are baked from packed timing values
+ * - Cooked song blobs round-trip and reject corrupt data
+ * - Merged charts interleave layers in time order, unify lanes and repeat looping layers
+ */
+
+#include "CompiledNoteChart.h"
+#include "CookedSongChart.h"
+#include "BeatTestCharts.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define COMPILED_CHART_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Verify compile order, lane grouping, palette and baked windows
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCompiledNoteChartLayoutTest,
+	"UniversalBeat.CompiledChart.Layout",
+	COMPILED_CHART_TEST_FLAGS
+)
+
+bool FCompiledNoteChartLayoutTest::RunTest(const FString& Parameters)
+{
+	UNoteDataAsset* LeftNote = BeatTestCharts::MakeNote(TEXT("Input.Left"), ENoteInteractionType::Press, EMusicalNoteValue::Sixteenth, EMusicalNoteValue::Eighth);
+	UNoteDataAsset* RightNote = BeatTestCharts::MakeNote(TEXT("Input.Right"), ENoteInteractionType::Press, EMusicalNoteValue::Eighth, EMusicalNoteValue::Sixteenth);
+
+	UMovieSceneNoteChartSection* Section = BeatTestCharts::MakeSection();
+
+	// Keys deliberately out of order, with a two-lane chord at 1s
+	TMovieSceneChannelData<FNoteChannelValue> ChannelData = Section->GetNoteChannel().GetData();
+	ChannelData.AddKey(FFrameNumber(48000), FNoteChannelValue(LeftNote));
+	ChannelData.AddKey(FFrameNumber(24000), FNoteChannelValue(RightNote));
+	ChannelData.AddKey(FFrameNumber(12000), FNoteChannelValue(RightNote));
+	ChannelData.AddKey(FFrameNumber(24000), FNoteChannelValue(LeftNote));
+
+	FCompiledNoteChart Chart;
+	BeatTestCharts::CompileChart(Chart, *Section);
+
+	TestEqual(TEXT("All keys compiled"), Chart.Num(), 4);
+	TestEqual(TEXT("Two lanes"), Chart.NumLanes(), 2);
+	TestEqual(TEXT("Palette is deduplicated"), Chart.NoteAssets.Num(), 2);
+
+	// Tick resolution conversion and time order
+	TestEqual(TEXT("First note at 0.5s"), Chart.NoteSeconds[0], 0.5, 1e-9);
+	TestEqual(TEXT("Last note at 2s"), Chart.NoteSeconds[3], 2.0, 1e-9);
+	for (int32 NoteIndex = 1; NoteIndex < Chart.Num(); ++NoteIndex)
+	{
+		TestTrue(TEXT("Notes are sorted by time"), Chart.NoteSeconds[NoteIndex - 1] <= Chart.NoteSeconds[NoteIndex]);
+	}
+
+	// Lane grouping
+	const int32 LeftLane = Chart.FindLane(LeftNote->NoteTag);
+	const int32 RightLane = Chart.FindLane(RightNote->NoteTag);
+	TestTrue(TEXT("Both lanes found"), LeftLane != INDEX_NONE && RightLane != INDEX_NONE);
+	TestEqual(TEXT("Left lane has two notes"), Chart.GetLaneEnd(LeftLane) - Chart.GetLaneBegin(LeftLane), 2);
+	TestEqual(TEXT("Left lane first note at 1s"), Chart.LaneNoteSeconds[Chart.GetLaneBegin(LeftLane)], 1.0, 1e-9);
+	TestEqual(TEXT("Right lane first note at 0.5s"), Chart.LaneNoteSeconds[Chart.GetLaneBegin(RightLane)], 0.5, 1e-9);
+
+	for (int32 LaneEntry = 0; LaneEntry < Chart.LaneNoteIndices.Num(); ++LaneEntry)
+	{
+		const int32 NoteIndex = Chart.LaneNoteIndices[LaneEntry];
+		TestEqual(TEXT("Lane seconds mirror note seconds"), Chart.LaneNoteSeconds[LaneEntry], Chart.NoteSeconds[NoteIndex]);
+	}
+
+	// Packed windows survive compile, baked at 120 BPM (1/16 = 0.125s, 1/8 = 0.25s)
+	const int32 LeftEntry = Chart.GetLaneBegin(LeftLane);
+	const int32 LeftNoteIndex = Chart.LaneNoteIndices[LeftEntry];
+	TestEqual(TEXT("Pre timing unpacked"), Chart.GetPreTiming(LeftNoteIndex), EMusicalNoteValue::Sixteenth);
+	TestEqual(TEXT("Post timing unpacked"), Chart.GetPostTiming(LeftNoteIndex), EMusicalNoteValue::Eighth);
+	TestTrue(TEXT("Note asset resolved from palette"), Chart.GetNoteAsset(LeftNoteIndex) == LeftNote);
+	TestEqual(TEXT("Window start baked"), Chart.LaneWindowStart[LeftEntry], 1.0 - 0.125, 1e-6);
+	TestEqual(TEXT("Window end baked"), Chart.LaneWindowEnd[LeftEntry], 1.0 + 0.25, 1e-6);
+	TestEqual(TEXT("Lane max pre window"), Chart.LaneMaxPreWindow[RightLane], 0.25f, 1e-6f);
+
+	// Re-bake at a new tempo
+	Chart.BakeWindows(60.0f);
+	TestEqual(TEXT("Window end rebaked at 60 BPM"), Chart.LaneWindowEnd[LeftEntry], 1.0 + 0.5, 1e-6);
+
+	return true;
+}
+
+/**
+ * Verify a cooked song blob reads back identical chart arrays
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCompiledNoteChartCookedBlobTest,
+	"UniversalBeat.CompiledChart.CookedBlob",
+	COMPILED_CHART_TEST_FLAGS
+)
+
+bool FCompiledNoteChartCookedBlobTest::RunTest(const FString& Parameters)
+{
+	UNoteDataAsset* NoteData = BeatTestCharts::MakeNote(TEXT("Input.Left"));
+
+	UMovieSceneNoteChartSection* Section = BeatTestCharts::MakeSection();
+	TMovieSceneChannelData<FNoteChannelValue> ChannelData = Section->GetNoteChannel().GetData();
+	for (int32 Beat = 0; Beat < 8; ++Beat)
+	{
+		ChannelData.AddKey(FFrameNumber(Beat * 12000), FNoteChannelValue(NoteData));
+	}
+
+	FCookedSongChart SongChart;
+	FCookedSongChart::FTrack& Track = SongChart.Tracks.AddDefaulted_GetRef();
+	Track.DelayOffset = 1.5f;
+	Track.LoopCount = 2;
+	BeatTestCharts::CompileChart(*Track.Chart, *Section, 0.0f);
+
+	TArray<uint8> Blob;
+	FMemoryWriter Writer(Blob, true);
+	SongChart.Serialize(Writer);
+
+	FCookedSongChart Loaded;
+	TestTrue(TEXT("Blob loads"), Loaded.LoadFromBytes(Blob, Track.Chart->Lanes, Track.Chart->NoteAssets));
+	TestEqual(TEXT("Track count"), Loaded.Tracks.Num(), 1);
+	if (Loaded.Tracks.Num() != 1)
+	{
+		return false;
+	}
+
+	const FCompiledNoteChart& Chart = *Loaded.Tracks[0].Chart;
+	TestEqual(TEXT("Delay preserved"), Loaded.Tracks[0].DelayOffset, 1.5f);
+	TestEqual(TEXT("Loop count preserved"), Loaded.Tracks[0].LoopCount, 2);
+	TestEqual(TEXT("Note count preserved"), Chart.Num(), 8);
+	TestEqual(TEXT("Note seconds preserved"), Chart.NoteSeconds[7], 3.5, 1e-9);
+	TestTrue(TEXT("Palette bound"), Chart.GetNoteAsset(0) == NoteData);
+	TestEqual(TEXT("Lane offsets cover palette"), Chart.LaneOffsets.Num(), Chart.NumLanes() + 1);
+
+	// Truncated and foreign blobs are rejected
+	TArray<uint8> Truncated(Blob.GetData(), Blob.Num() / 2);
+	TestFalse(TEXT("Truncated blob rejected"), Loaded.LoadFromBytes(Truncated, Track.Chart->Lanes, Track.Chart->NoteAssets));
+
+	TArray<uint8> Foreign = Blob;
+	Foreign[0] ^= 0xFF;
+	TestFalse(TEXT("Wrong magic rejected"), Loaded.LoadFromBytes(Foreign, Track.Chart->Lanes, Track.Chart->NoteAssets));
+
+	return true;
+}
+
+/**
+ * Verify layered charts merge into one time-ordered chart
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCompiledNoteChartMergeTest,
+	"UniversalBeat.CompiledChart.Merge",
+	COMPILED_CHART_TEST_FLAGS
+)
+
+bool FCompiledNoteChartMergeTest::RunTest(const FString& Parameters)
+{
+	UNoteDataAsset* LeftNote = BeatTestCharts::MakeNote(TEXT("Input.Left"));
+	UNoteDataAsset* RightNote = BeatTestCharts::MakeNote(TEXT("Input.Right"));
+
+	// Drums: left at 0.5s and 1s, plus a key at 2.5s past the 2s pass
+	UMovieSceneNoteChartSection* DrumSection = BeatTestCharts::MakeSection();
+	TMovieSceneChannelData<FNoteChannelValue> DrumKeys = DrumSection->GetNoteChannel().GetData();
+	DrumKeys.AddKey(FFrameNumber(12000), FNoteChannelValue(LeftNote));
+	DrumKeys.AddKey(FFrameNumber(24000), FNoteChannelValue(LeftNote));
+	DrumKeys.AddKey(FFrameNumber(60000), FNoteChannelValue(LeftNote));
+
+	// Bass: right at 0.25s, left at 0.75s, one-second loop
+	UMovieSceneNoteChartSection* BassSection = BeatTestCharts::MakeSection();
+	TMovieSceneChannelData<FNoteChannelValue> BassKeys = BassSection->GetNoteChannel().GetData();
+	BassKeys.AddKey(FFrameNumber(6000), FNoteChannelValue(RightNote));
+	BassKeys.AddKey(FFrameNumber(18000), FNoteChannelValue(LeftNote));
+
+	FCompiledNoteChart Drums;
+	BeatTestCharts::CompileChart(Drums, *DrumSection, 0.0f);
+
+	FCompiledNoteChart Bass;
+	BeatTestCharts::CompileChart(Bass, *BassSection, 0.0f);
+
+	FCompiledNoteChartLayer Layers[2];
+	Layers[0].Chart = &Drums;
+	Layers[0].PassSeconds = 2.0;
+	Layers[1].Chart = &Bass;
+	Layers[1].PassSeconds = 1.0;
+	Layers[1].OffsetSeconds = 0.5;
+	Layers[1].NumPasses = 2;
+
+	FCompiledNoteChart Merged;
+	Merged.Merge(Layers);
+	Merged.BakeWindows(120.0f);
+
+	// 0.5 L, 0.75 R, 1.0 L, 1.25 L, 1.75 R, 2.25 L
+	const double ExpectedSeconds[] = { 0.5, 0.75, 1.0, 1.25, 1.75, 2.25 };
+	TestEqual(TEXT("Notes outside a pass are left out, loops repeat"), Merged.Num(), 6);
+	for (int32 NoteIndex = 0; NoteIndex < FMath::Min(Merged.Num(), 6); ++NoteIndex)
+	{
+		TestEqual(TEXT("Merged note time"), Merged.NoteSeconds[NoteIndex], ExpectedSeconds[NoteIndex], 1e-9);
+	}
+	TestEqual(TEXT("Lanes unified by tag"), Merged.NumLanes(), 2);
+	TestEqual(TEXT("Assets unified"), Merged.NoteAssets.Num(), 2);
+	TestTrue(TEXT("Second note is the bass right"), Merged.Num() > 1 && Merged.GetNoteTag(1) == RightNote->NoteTag);
+	TestTrue(TEXT("Shared asset resolves"), Merged.Num() > 3 && Merged.GetNoteAsset(3) == LeftNote);
+	TestEqual(TEXT("Source frames kept"), Merged.Num() > 1 ? Merged.NoteFrames[1] : FFrameNumber(), FFrameNumber(6000));
+
+	const int32 LeftLane = Merged.FindLane(LeftNote->NoteTag);
+	TestEqual(TEXT("Left lane collects both layers"), Merged.GetLaneEnd(LeftLane) - Merged.GetLaneBegin(LeftLane), 4);
+	TestEqual(TEXT("Windows baked over the merged lanes"), Merged.LaneWindowEnd.Num(), Merged.Num());
+
+	// A single layer merges to the same chart it came from
+	FCompiledNoteChartLayer Single;
+	Single.Chart = &Drums;
+	Merged.Merge(MakeArrayView(&Single, 1));
+	TestEqual(TEXT("Whole chart when no pass is given"), Merged.Num(), Drums.Num());
+	TestEqual(TEXT("Times unchanged"), Merged.NoteSeconds.Last(), Drums.NoteSeconds.Last());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,182 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+ * MovieSceneNoteChartSectionTests.cpp
+ *
+ * Automated test suite for note chart section queries and evaluation
+ *
+ * Tests verify:
+ * - Range queries include both ends and return notes in time order
+ * - Bulk removal deletes exactly the keys in range
+ * - The trigger cursor fires each crossed key once and re-seeks after edits or jumps
+ * - Channel key queries honour inclusive and exclusive range bounds
+ * - Snapping, partial quantizing and lane mirroring edit the keys in place
+ */
+
+#include "MovieSceneNoteChartSection.h"
+#include "NoteDataAsset.h"
+#include "TempoMap.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define NOTE_CHART_SECTION_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace NoteChartSectionTests
+{
+	/** Section with one note every 100 frames from 0 to 900 */
+	UMovieSceneNoteChartSection* MakeSection(UNoteDataAsset* NoteData)
+	{
+		UMovieSceneNoteChartSection* Section = NewObject<UMovieSceneNoteChartSection>(GetTransientPackage());
+		Section->SetRange(TRange<FFrameNumber>::All());
+		for (int32 KeyIndex = 9; KeyIndex >= 0; --KeyIndex)
+		{
+			Section->AddNote(FFrameNumber(KeyIndex * 100), NoteData);
+		}
+		return Section;
+	}
+}
+
+/**
+ * Verify binary-searched range queries and one-pass bulk removal
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNoteChartSectionRangeTest,
+	"UniversalBeat.NoteChartSection.Range",
+	NOTE_CHART_SECTION_TEST_FLAGS
+)
+
+bool FNoteChartSectionRangeTest::RunTest(const FString& Parameters)
+{
+	UNoteDataAsset* NoteData = NewObject<UNoteDataAsset>(GetTransientPackage());
+	NoteData->NoteTag = FGameplayTag::RequestGameplayTag(FName("Input.Left"));
+	UMovieSceneNoteChartSection* Section = NoteChartSectionTests::MakeSection(NoteData);
+
+	TArray<FNoteInstance> Notes;
+	Section->GetNotesInRange(FFrameNumber(200), FFrameNumber(500), Notes);
+	TestEqual(TEXT("Both ends inclusive"), Notes.Num(), 4);
+	if (Notes.Num() == 4)
+	{
+		TestEqual(TEXT("First note"), Notes[0].Timestamp.Value, 200);
+		TestEqual(TEXT("Last note"), Notes[3].Timestamp.Value, 500);
+	}
+
+	Section->GetNotesInRange(FFrameNumber(910), FFrameNumber(2000), Notes);
+	TestEqual(TEXT("Past the last key"), Notes.Num(), 0);
+	Section->GetNotesInRange(FFrameNumber(-50), FFrameNumber(50), Notes);
+	TestEqual(TEXT("Straddling the first key"), Notes.Num(), 1);
+
+	TestEqual(TEXT("Bulk removal count"), Section->RemoveNotesInRange(FFrameNumber(150), FFrameNumber(400)), 3);
+	TestEqual(TEXT("Remaining notes"), Section->GetNoteCount(), 7);
+	Section->GetNotesInRange(FFrameNumber(100), FFrameNumber(500), Notes);
+	TestEqual(TEXT("Neighbours kept"), Notes.Num(), 2);
+	TestEqual(TEXT("Empty range removes nothing"), Section->RemoveNotesInRange(FFrameNumber(150), FFrameNumber(190)), 0);
+
+	// Keys left: 0, 100, 500 ... 900
+	TArray<FFrameNumber> KeyTimes;
+	TArray<FKeyHandle> KeyHandles;
+	Section->GetNoteChannel().GetKeys(TRange<FFrameNumber>(FFrameNumber(100), FFrameNumber(600)), &KeyTimes, &KeyHandles);
+	TestEqual(TEXT("Half-open range excludes its end"), KeyTimes.Num(), 2);
+	TestEqual(TEXT("A handle per key"), KeyHandles.Num(), 2);
+
+	KeyTimes.Reset();
+	Section->GetNoteChannel().GetKeys(TRange<FFrameNumber>(TRangeBound<FFrameNumber>::Exclusive(FFrameNumber(0)), TRangeBound<FFrameNumber>::Open()), &KeyTimes, nullptr);
+	TestEqual(TEXT("Exclusive lower bound, open upper bound"), KeyTimes.Num(), 6);
+
+	return true;
+}
+
+/**
+ * Verify one-pass snapping, quantizing and lane mirroring
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNoteChartSectionBulkEditTest,
+	"UniversalBeat.NoteChartSection.BulkEdit",
+	NOTE_CHART_SECTION_TEST_FLAGS
+)
+
+bool FNoteChartSectionBulkEditTest::RunTest(const FString& Parameters)
+{
+	UNoteDataAsset* LeftNote = NewObject<UNoteDataAsset>(GetTransientPackage());
+	LeftNote->NoteTag = FGameplayTag::RequestGameplayTag(FName("Input.Left"));
+	UNoteDataAsset* RightNote = NewObject<UNoteDataAsset>(GetTransientPackage());
+	RightNote->NoteTag = FGameplayTag::RequestGameplayTag(FName("Input.Right"));
+
+	UMovieSceneNoteChartSection* Section = NewObject<UMovieSceneNoteChartSection>(GetTransientPackage());
+	Section->SetRange(TRange<FFrameNumber>::All());
+	Section->SnapGridResolution = EMusicalNoteValue::Sixteenth;
+	Section->AddNote(FFrameNumber(3100), LeftNote);
+	Section->AddNote(FFrameNumber(5800), RightNote);
+	Section->AddNote(FFrameNumber(9000), LeftNote);
+
+	// 24000 ticks per second at 120 BPM: a sixteenth is 3000 ticks
+	const FFrameRate TickResolution(24000, 1);
+	const FTempoMap NoTempoMap;
+	TestEqual(TEXT("Quantize at 0 strength moves nothing"), Section->QuantizeNotes(EMusicalNoteValue::Sixteenth, 0.0f, TickResolution, NoTempoMap, 120.0f), 0);
+	TestEqual(TEXT("Half quantize moves the off-grid notes"), Section->QuantizeNotes(EMusicalNoteValue::Sixteenth, 0.5f, TickResolution, NoTempoMap, 120.0f), 2);
+
+	TArrayView<const FFrameNumber> KeyTimes = Section->GetNoteChannel().GetData().GetTimes();
+	TestEqual(TEXT("Halfway to the grid"), KeyTimes[0].Value, 3050);
+	TestEqual(TEXT("Halfway to the grid (late)"), KeyTimes[1].Value, 5900);
+
+	TestEqual(TEXT("Snap moves the remaining offsets"), Section->SnapNotesToGrid(TickResolution, NoTempoMap, 120.0f), 2);
+	KeyTimes = Section->GetNoteChannel().GetData().GetTimes();
+	TestEqual(TEXT("Snapped"), KeyTimes[0].Value, 3000);
+	TestEqual(TEXT("Snapped (late)"), KeyTimes[1].Value, 6000);
+	TestEqual(TEXT("On-grid note kept"), KeyTimes[2].Value, 9000);
+
+	// A tempo map puts the grid at the tempo of each segment: 60 BPM makes a sixteenth 6000 ticks
+	FTempoMap SlowTempoMap;
+	SlowTempoMap.AddKey(0.0, 60.0f);
+	SlowTempoMap.Finalize();
+	Section->SnapNotesToGrid(TickResolution, SlowTempoMap, 120.0f);
+	KeyTimes = Section->GetNoteChannel().GetData().GetTimes();
+	TestTrue(TEXT("Tempo map grid"), KeyTimes[0].Value % 6000 == 0 && KeyTimes[1].Value % 6000 == 0 && KeyTimes[2].Value % 6000 == 0);
+
+	TestEqual(TEXT("Mirror swaps both lanes"), Section->MirrorNoteLanes(), 3);
+	TArrayView<const FNoteChannelValue> KeyValues = Section->GetNoteChannel().GetData().GetValues();
+	TestTrue(TEXT("Left became right"), KeyValues[0].NoteData == RightNote && KeyValues[2].NoteData == RightNote);
+	TestTrue(TEXT("Right became left"), KeyValues[1].NoteData == LeftNote);
+
+	return true;
+}
+
+/**
+ * Verify the evaluation cursor fires each key once across frames
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNoteChartSectionCursorTest,
+	"UniversalBeat.NoteChartSection.Cursor",
+	NOTE_CHART_SECTION_TEST_FLAGS
+)
+
+bool FNoteChartSectionCursorTest::RunTest(const FString& Parameters)
+{
+	UNoteDataAsset* NoteData = NewObject<UNoteDataAsset>(GetTransientPackage());
+	NoteData->NoteTag = FGameplayTag::RequestGameplayTag(FName("Input.Left"));
+	UMovieSceneNoteChartSection* Section = NoteChartSectionTests::MakeSection(NoteData);
+
+	// Frames of 30 ticks from the start: every key is crossed exactly once
+	int32 Cursor = INDEX_NONE;
+	int32 NumTriggered = Section->TriggerNotes(FFrameNumber(-1), FFrameNumber(0), Cursor, nullptr);
+	for (int32 Frame = 30; Frame <= 990; Frame += 30)
+	{
+		NumTriggered += Section->TriggerNotes(FFrameNumber(Frame - 30), FFrameNumber(Frame), Cursor, nullptr);
+	}
+	TestEqual(TEXT("Every key fired once"), NumTriggered, 10);
+	TestEqual(TEXT("Cursor at the end"), Cursor, 10);
+
+	// A stale cursor (after a seek) is re-sought instead of replaying from where it was
+	Cursor = 0;
+	TestEqual(TEXT("Seek fires only the crossed key"), Section->TriggerNotes(FFrameNumber(450), FFrameNumber(520), Cursor, nullptr), 1);
+	TestEqual(TEXT("Cursor after 500"), Cursor, 6);
+
+	// Keys edited under the cursor
+	Section->RemoveNotesInRange(FFrameNumber(0), FFrameNumber(300));
+	TestEqual(TEXT("Edited keys re-sought"), Section->TriggerNotes(FFrameNumber(520), FFrameNumber(700), Cursor, nullptr), 2);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
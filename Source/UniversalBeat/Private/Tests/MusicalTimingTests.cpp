@@ -11,10 +11,12 @@
  * - Custom PreTiming acceptance (early input)
  * - Custom PostTiming acceptance (late input)
  * - Timing window constraints (Sixteenth to Whole)
+ * - Blueprint wrappers match the native constexpr tables, and the window table follows BPM changes
  */
 
 #include "UniversalBeatTypes.h"
 #include "UniversalBeatFunctionLibrary.h"
+#include "MusicalTiming.h"
 #include "Misc/AutomationTest.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
@@ -415,4 +417,54 @@ bool FTimingWindowIntegrationTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+// The native tables are evaluated at compile time
+static_assert(MusicalTiming::GetNoteValueBeats(EMusicalNoteValue::Sixteenth) == 0.25f, "Sixteenth is a quarter beat");
+static_assert(MusicalTiming::GetNoteValueBeats(EMusicalNoteValue::Whole) == 4.0f, "Whole note is four beats");
+static_assert(MusicalTiming::GetSubdivisionTicks(EBeatSubdivision::None) == 0, "None never broadcasts");
+static_assert(MusicalTiming::GetSubdivisionTicks(EBeatSubdivision::Quarter) * MusicalTiming::GetSubdivisionsPerBeat(EBeatSubdivision::Quarter) == MusicalTiming::TicksPerBeat, "Subdivisions tile a beat");
+
+/**
+ * Verify the Blueprint wrappers against the native tables and the cached window table
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMusicalTimingTablesTest,
+	"UniversalBeat.MusicalTiming.Tables",
+	MUSICAL_TIMING_TEST_FLAGS
+)
+
+bool FMusicalTimingTablesTest::RunTest(const FString& Parameters)
+{
+	// Wrappers keep the values the former switches returned
+	const int32 ExpectedTicks[] = { 0, 16, 8, 4, 2, 1 };
+	const int32 ExpectedMultipliers[] = { 1, 1, 2, 4, 8, 16 };
+	for (int32 Index = 0; Index < MusicalTiming::NumSubdivisions; ++Index)
+	{
+		const EBeatSubdivision Subdivision = static_cast<EBeatSubdivision>(Index);
+		TestEqual(FString::Printf(TEXT("Ticks for subdivision %d"), Index), UUniversalBeatFunctionLibrary::GetTicksForSubdivision(Subdivision), ExpectedTicks[Index]);
+		TestEqual(FString::Printf(TEXT("Multiplier for subdivision %d"), Index), UUniversalBeatFunctionLibrary::GetSubdivisionMultiplier(Subdivision), ExpectedMultipliers[Index]);
+	}
+
+	for (int32 Index = 0; Index < MusicalTiming::NumNoteValues; ++Index)
+	{
+		const EMusicalNoteValue NoteValue = static_cast<EMusicalNoteValue>(Index);
+		TestEqual(FString::Printf(TEXT("Multiplier for note value %d"), Index), UUniversalBeatFunctionLibrary::GetNoteValueMultiplier(NoteValue), MusicalTiming::NoteValueBeats[Index]);
+		TestEqual(FString::Printf(TEXT("Seconds for note value %d"), Index), UUniversalBeatFunctionLibrary::ConvertMusicalNoteToSeconds(NoteValue, 90.0f), MusicalTiming::NoteValueBeats[Index] * 60.0f / 90.0f, 1e-6f);
+	}
+
+	// Out-of-range values fall back like the switches did
+	TestEqual(TEXT("Invalid note value is a quarter"), MusicalTiming::GetNoteValueBeats(static_cast<EMusicalNoteValue>(200)), 1.0f);
+	TestEqual(TEXT("Invalid subdivision never broadcasts"), MusicalTiming::GetSubdivisionTicks(static_cast<EBeatSubdivision>(200)), 0);
+
+	// The window table matches direct conversion and is rebuilt on a BPM change
+	MusicalTiming::FNoteWindowTable WindowTable(120.0f);
+	TestEqual(TEXT("Eighth at 120 BPM"), WindowTable.GetSeconds(EMusicalNoteValue::Eighth), 0.25f, 1e-6f);
+	WindowTable.SetBPM(60.0f);
+	TestEqual(TEXT("Table follows the BPM"), WindowTable.GetBPM(), 60.0f);
+	TestEqual(TEXT("Eighth at 60 BPM"), WindowTable.GetSeconds(EMusicalNoteValue::Eighth), 0.5f, 1e-6f);
+	WindowTable.SetBPM(0.0f);
+	TestEqual(TEXT("No tempo, no window"), WindowTable.GetSeconds(EMusicalNoteValue::Whole), 0.0f);
+
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
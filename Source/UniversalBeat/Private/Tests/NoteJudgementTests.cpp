@@ -0,0 +1,413 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+ * NoteJudgementTests.cpp
+ *
+ * Automated test suite for the deterministic judgement functions
+ *
+ * Tests verify:
+ * - Hits, misses, accuracy and direction come from the chart's baked windows
+ * - Consumed notes are not hit twice; chords are judged per lane
+ * - A copied state replays the same inputs to identical results
+ * - The miss sweep marks only closed, unconsumed windows and missed notes cannot be hit
+ * - Baked timing curve tables match their source curves; note accuracy curves shape hits
+ * - Holds score sustain ticks from their press and release; Release notes only take releases
+ * - Sessions judge out-of-order inputs in time order and apply their calibration
+ * - Inputs arriving after later ones still hit notes open at their own timestamp
+ */
+
+#include "NoteJudgement.h"
+#include "BeatSession.h"
+#include "BeatTestCharts.h"
+#include "TimingCurveLUT.h"
+#include "Curves/CurveFloat.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define NOTE_JUDGEMENT_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+namespace NoteJudgementTests
+{
+	/** Left notes at 1s and 2s, right note at 1s, eighth-note windows baked at 120 BPM (0.25s) */
+	void BuildChart(FCompiledNoteChart& Chart)
+	{
+		BeatTestCharts::CompileChart(Chart, *BeatTestCharts::MakeChordSection());
+	}
+}
+
+/**
+ * Verify hit, miss, accuracy and consumption
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNoteJudgementHitMissTest,
+	"UniversalBeat.Judgement.HitMiss",
+	NOTE_JUDGEMENT_TEST_FLAGS
+)
+
+bool FNoteJudgementHitMissTest::RunTest(const FString& Parameters)
+{
+	FCompiledNoteChart Chart;
+	NoteJudgementTests::BuildChart(Chart);
+
+	const FGameplayTag Left = FGameplayTag::RequestGameplayTag(FName("Input.Left"));
+	const FGameplayTag Right = FGameplayTag::RequestGameplayTag(FName("Input.Right"));
+	const FGameplayTag Unused = FGameplayTag::RequestGameplayTag(FName("Input.Up"));
+
+	FNoteJudgementState State;
+	State.Init(Chart);
+	TestTrue(TEXT("State sized for chart"), State.IsValidFor(Chart));
+
+	// Outside every window
+	FNoteJudgement Judgement = NoteJudgement::JudgeInput(Chart, State, Left, 0.5);
+	TestFalse(TEXT("Too early is a miss"), Judgement.IsHit());
+	TestEqual(TEXT("Miss reports Late"), Judgement.TimingDirection, ENoteTimingDirection::Late);
+
+	// Half way into the pre-window
+	Judgement = NoteJudgement::JudgeInput(Chart, State, Left, 0.875);
+	TestTrue(TEXT("Early press hits"), Judgement.IsHit());
+	TestEqual(TEXT("Early direction"), Judgement.TimingDirection, ENoteTimingDirection::Early);
+	TestEqual(TEXT("Half window accuracy"), Judgement.Accuracy, 0.5f, 1e-4f);
+	TestEqual(TEXT("Offset"), Judgement.TimingOffset, -0.125f, 1e-5f);
+
+	// The left note at 1s is consumed, the chord's right note is not
+	TestFalse(TEXT("Consumed note is not hit again"), NoteJudgement::JudgeInput(Chart, State, Left, 1.0).IsHit());
+	Judgement = NoteJudgement::JudgeInput(Chart, State, Right, 1.0);
+	TestTrue(TEXT("Chord lane judged independently"), Judgement.IsHit());
+	TestEqual(TEXT("Perfect press"), Judgement.Accuracy, 1.0f, 1e-4f);
+	TestEqual(TEXT("On time"), Judgement.TimingDirection, ENoteTimingDirection::OnTime);
+
+	TestFalse(TEXT("Lane without notes misses"), NoteJudgement::JudgeInput(Chart, State, Unused, 1.0).IsHit());
+
+	// Rewind makes every note judgeable again
+	State.Rewind(Chart);
+	TestTrue(TEXT("Rewound note hits again"), NoteJudgement::JudgeInput(Chart, State, Left, 1.0).IsHit());
+
+	return true;
+}
+
+/**
+ * Verify a state snapshot replays inputs to identical results
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNoteJudgementReplayTest,
+	"UniversalBeat.Judgement.Replay",
+	NOTE_JUDGEMENT_TEST_FLAGS
+)
+
+bool FNoteJudgementReplayTest::RunTest(const FString& Parameters)
+{
+	FCompiledNoteChart Chart;
+	NoteJudgementTests::BuildChart(Chart);
+
+	const FGameplayTag Left = FGameplayTag::RequestGameplayTag(FName("Input.Left"));
+	const FGameplayTag Right = FGameplayTag::RequestGameplayTag(FName("Input.Right"));
+
+	FNoteJudgementState Live;
+	Live.Init(Chart);
+	NoteJudgement::JudgeInput(Chart, Live, Left, 1.05);
+
+	// Snapshot, then continue live
+	const FNoteJudgementState Snapshot = Live;
+	const FNoteJudgement LiveRight = NoteJudgement::JudgeInput(Chart, Live, Right, 1.1);
+	const FNoteJudgement LiveLeft = NoteJudgement::JudgeInput(Chart, Live, Left, 2.2);
+
+	// Roll back and re-simulate the same inputs
+	FNoteJudgementState Replay = Snapshot;
+	const FNoteJudgement ReplayRight = NoteJudgement::JudgeInput(Chart, Replay, Right, 1.1);
+	const FNoteJudgement ReplayLeft = NoteJudgement::JudgeInput(Chart, Replay, Left, 2.2);
+
+	TestEqual(TEXT("Same note hit"), ReplayRight.NoteIndex, LiveRight.NoteIndex);
+	TestEqual(TEXT("Same accuracy"), ReplayRight.Accuracy, LiveRight.Accuracy);
+	TestEqual(TEXT("Same second note"), ReplayLeft.NoteIndex, LiveLeft.NoteIndex);
+	TestEqual(TEXT("Same second accuracy"), ReplayLeft.Accuracy, LiveLeft.Accuracy);
+	TestTrue(TEXT("Same consumption"), Replay.ConsumedNotes == Live.ConsumedNotes);
+	TestTrue(TEXT("Same cursors"), Replay.LaneCursors == Live.LaneCursors);
+
+	// The snapshot itself is untouched
+	TestFalse(TEXT("Snapshot unaffected by replay"), Snapshot.IsConsumed(LiveRight.NoteIndex));
+
+	return true;
+}
+
+/**
+ * Verify a late-arriving earlier input is judged at its own timestamp
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNoteJudgementOutOfOrderTest,
+	"UniversalBeat.Judgement.OutOfOrder",
+	NOTE_JUDGEMENT_TEST_FLAGS
+)
+
+bool FNoteJudgementOutOfOrderTest::RunTest(const FString& Parameters)
+{
+	TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> Chart = MakeShared<FCompiledNoteChart, ESPMode::ThreadSafe>();
+	NoteJudgementTests::BuildChart(*Chart);
+
+	const FGameplayTag Left = FGameplayTag::RequestGameplayTag(FName("Input.Left"));
+
+	// As CheckBeatTimingByTagAtTime sees them: the 2s press is handled before the 1s one
+	FNoteJudgementState State;
+	State.Init(*Chart);
+	const FNoteJudgement Later = NoteJudgement::JudgeInput(*Chart, State, Left, 2.0);
+	const FNoteJudgement Earlier = NoteJudgement::JudgeInput(*Chart, State, Left, 1.0);
+	TestTrue(TEXT("Later press hits"), Later.IsHit());
+	TestTrue(TEXT("Earlier press still hits its note"), Earlier.IsHit());
+	TestEqual(TEXT("Earlier press takes the 1s note"), Chart->NoteSeconds[Earlier.NoteIndex], 1.0, 1e-9);
+	TestEqual(TEXT("Earlier press is on time"), Earlier.Accuracy, 1.0f, 1e-4f);
+
+	// Only resolved notes are passed: once the sweep has missed the note, it stays missed
+	State.Init(*Chart);
+	NoteJudgement::JudgeInput(*Chart, State, Left, 2.0);
+	NoteJudgement::SweepMisses(*Chart, State, 1.5);
+	TestFalse(TEXT("Swept note is not hit by a late input"), NoteJudgement::JudgeInput(*Chart, State, Left, 1.0).IsHit());
+
+	// Sessions sort within one evaluation; an input queued for a later evaluation is still judged at its time
+	FBeatSession Session;
+	Session.SetChart(Chart);
+	Session.PendingInputs.Emplace(Left, 2.0);
+	Session.Evaluate();
+	Session.PendingInputs.Emplace(Left, 1.0);
+	Session.Evaluate();
+	TestEqual(TEXT("Late evaluation hits"), Session.NumHits, 1);
+
+	return true;
+}
+
+/**
+ * Verify the miss sweep cursor, bulk marking and that missed notes stay missed
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNoteJudgementMissSweepTest,
+	"UniversalBeat.Judgement.MissSweep",
+	NOTE_JUDGEMENT_TEST_FLAGS
+)
+
+bool FNoteJudgementMissSweepTest::RunTest(const FString& Parameters)
+{
+	FCompiledNoteChart Chart;
+	NoteJudgementTests::BuildChart(Chart);
+
+	const FGameplayTag Left = FGameplayTag::RequestGameplayTag(FName("Input.Left"));
+	const FGameplayTag Right = FGameplayTag::RequestGameplayTag(FName("Input.Right"));
+
+	FNoteJudgementState State;
+	State.Init(Chart);
+
+	// Hit the chord's left note, let the right one run out
+	const FNoteJudgement LeftHit = NoteJudgement::JudgeInput(Chart, State, Left, 1.0);
+	TestTrue(TEXT("Left note hit"), LeftHit.IsHit());
+
+	TArray<int32> Missed;
+	TestEqual(TEXT("Nothing closed yet"), NoteJudgement::SweepMisses(Chart, State, 1.2, &Missed), 0);
+	TestEqual(TEXT("Cursor waits at the first open window"), State.MissCursor, 0);
+
+	TestEqual(TEXT("Right note missed"), NoteJudgement::SweepMisses(Chart, State, 1.3, &Missed), 1);
+	TestEqual(TEXT("One index reported"), Missed.Num(), 1);
+	if (Missed.Num() == 1)
+	{
+		TestEqual(TEXT("Missed note is the right lane"), Chart.GetNoteTag(Missed[0]), Right);
+		TestTrue(TEXT("Marked missed"), State.IsMissed(Missed[0]));
+		TestFalse(TEXT("Hit note not marked missed"), State.IsMissed(LeftHit.NoteIndex));
+		TestFalse(TEXT("Late input cannot hit a missed note"), NoteJudgement::JudgeInput(Chart, State, Right, 1.2).IsHit());
+	}
+	TestEqual(TEXT("Cursor past the chord"), State.MissCursor, 2);
+
+	// Sweeping again costs nothing and reports nothing
+	Missed.Reset();
+	TestEqual(TEXT("Repeat sweep is empty"), NoteJudgement::SweepMisses(Chart, State, 1.3, &Missed), 0);
+
+	// End of pass sweeps everything left
+	TestEqual(TEXT("Remaining note missed"), NoteJudgement::SweepMisses(Chart, State, TNumericLimits<double>::Max()), 1);
+	TestEqual(TEXT("Missed count"), State.NumMissed, 2);
+
+	State.Rewind(Chart);
+	TestEqual(TEXT("Rewind clears misses"), State.NumMissed, 0);
+	TestTrue(TEXT("Rewound note hits"), NoteJudgement::JudgeInput(Chart, State, Right, 1.0).IsHit());
+
+	return true;
+}
+
+/**
+ * Verify curve tables against the source curve and per-note accuracy shaping
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNoteJudgementAccuracyCurveTest,
+	"UniversalBeat.Judgement.AccuracyCurve",
+	NOTE_JUDGEMENT_TEST_FLAGS
+)
+
+bool FNoteJudgementAccuracyCurveTest::RunTest(const FString& Parameters)
+{
+	// Square-ish curve: full score for the better half of the window, then linear to 0
+	UCurveFloat* Curve = NewObject<UCurveFloat>(GetTransientPackage());
+	Curve->FloatCurve.AddKey(0.0f, 0.0f);
+	Curve->FloatCurve.AddKey(0.5f, 1.0f);
+	Curve->FloatCurve.AddKey(1.0f, 1.0f);
+
+	FTimingCurveLUT Table;
+	TestEqual(TEXT("Nothing clamped"), Table.Bake(Curve->FloatCurve), 0);
+	for (float X = 0.0f; X <= 1.0f; X += 0.0625f)
+	{
+		TestEqual(TEXT("Table matches curve"), Table.Evaluate(X), Curve->FloatCurve.Eval(X), 1e-3f);
+	}
+	TestEqual(TEXT("Input clamped low"), Table.Evaluate(-1.0f), 0.0f, 1e-6f);
+	TestEqual(TEXT("Input clamped high"), Table.Evaluate(2.0f), 1.0f, 1e-6f);
+
+	const float Inputs[] = { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f };
+	float Outputs[UE_ARRAY_COUNT(Inputs)];
+	Table.EvaluateBatch(Inputs, Outputs);
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(Inputs); ++Index)
+	{
+		TestEqual(TEXT("Batch matches single"), Outputs[Index], Table.Evaluate(Inputs[Index]));
+	}
+
+	FTimingCurveLUT Triangle;
+	Triangle.BakeTriangle();
+	TestEqual(TEXT("Triangle peak"), Triangle.Evaluate(0.5f), 1.0f, 1e-6f);
+	TestEqual(TEXT("Triangle slope"), Triangle.Evaluate(0.25f), 0.5f, 1e-6f);
+
+	// A note with the curve: a half-window press reports the shaped accuracy
+	UNoteDataAsset* NoteData = BeatTestCharts::MakeNote(TEXT("Input.Left"));
+	NoteData->AccuracyCurve = Curve;
+
+	UMovieSceneNoteChartSection* Section = BeatTestCharts::MakeSection();
+	Section->GetNoteChannel().GetData().AddKey(FFrameNumber(24000), FNoteChannelValue(NoteData));
+
+	FCompiledNoteChart Chart;
+	BeatTestCharts::CompileChart(Chart, *Section);
+	TestEqual(TEXT("Curve baked into the palette"), Chart.AccuracyCurves.Num(), 1);
+
+	FNoteJudgementState State;
+	State.Init(Chart);
+	const FNoteJudgement Judgement = NoteJudgement::JudgeInput(Chart, State, NoteData->NoteTag, 1.125);
+	TestTrue(TEXT("Half-window press hits"), Judgement.IsHit());
+	TestEqual(TEXT("Shaped accuracy"), Judgement.Accuracy, 1.0f, 1e-3f);
+
+	return true;
+}
+
+/**
+ * Verify hold sustain scoring, completion and Release notes
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNoteJudgementHoldTest,
+	"UniversalBeat.Judgement.Hold",
+	NOTE_JUDGEMENT_TEST_FLAGS
+)
+
+bool FNoteJudgementHoldTest::RunTest(const FString& Parameters)
+{
+	UNoteDataAsset* HoldNote = BeatTestCharts::MakeNote(TEXT("Input.Left"), ENoteInteractionType::Hold);
+	UNoteDataAsset* ReleaseNote = BeatTestCharts::MakeNote(TEXT("Input.Right"), ENoteInteractionType::Release);
+
+	// Hold from 1s to 2s (two beats = 8 ticks at 120 BPM), release note at 3s
+	UMovieSceneNoteChartSection* Section = BeatTestCharts::MakeSection();
+	TMovieSceneChannelData<FNoteChannelValue> ChannelData = Section->GetNoteChannel().GetData();
+	ChannelData.AddKey(FFrameNumber(24000), FNoteChannelValue(HoldNote, FFrameNumber(24000)));
+	ChannelData.AddKey(FFrameNumber(72000), FNoteChannelValue(ReleaseNote));
+
+	FCompiledNoteChart Chart;
+	BeatTestCharts::CompileChart(Chart, *Section);
+	TestTrue(TEXT("Hold is sustained"), Chart.IsSustained(0));
+	TestFalse(TEXT("Release note is not"), Chart.IsSustained(1));
+	TestEqual(TEXT("Total sustain ticks"), Chart.GetSustainTicks(0, 10.0), 8);
+
+	FNoteJudgementState Initial;
+	Initial.Init(Chart);
+
+	// Let go halfway: dropped, half the ticks
+	FNoteJudgementState State = Initial;
+	const FNoteJudgement Head = NoteJudgement::JudgeInput(Chart, State, HoldNote->NoteTag, 1.0);
+	TestTrue(TEXT("Head hit"), Head.IsHit());
+	TestEqual(TEXT("Head is a hold"), Head.InteractionType, ENoteInteractionType::Hold);
+	TestEqual(TEXT("Hold active"), State.ActiveHolds.Num(), 1);
+	TestEqual(TEXT("Nothing due mid-sustain"), NoteJudgement::CompleteHolds(Chart, State, 1.5), 0);
+
+	const FNoteJudgement Dropped = NoteJudgement::JudgeRelease(Chart, State, HoldNote->NoteTag, 1.5);
+	TestFalse(TEXT("Early release is not a hit"), Dropped.IsHit());
+	TestTrue(TEXT("Early release ends the hold"), Dropped.bHoldEnd && Dropped.bDropped);
+	TestEqual(TEXT("Ticks up to the release"), Dropped.SustainTicks, 4);
+	TestEqual(TEXT("Half sustained"), Dropped.SustainRatio, 0.5f, 1e-6f);
+	TestEqual(TEXT("Hold removed"), State.ActiveHolds.Num(), 0);
+
+	// Let go within the head's pre-window of the end: complete
+	State = Initial;
+	NoteJudgement::JudgeInput(Chart, State, HoldNote->NoteTag, 1.0);
+	const FNoteJudgement Completed = NoteJudgement::JudgeRelease(Chart, State, HoldNote->NoteTag, 1.9);
+	TestTrue(TEXT("Release near the end completes"), Completed.IsHit());
+	TestEqual(TEXT("All ticks"), Completed.SustainTicks, 8);
+	TestEqual(TEXT("Head accuracy carried"), Completed.Accuracy, Head.Accuracy, 1e-6f);
+
+	// Never released: completes on its own once the end passes
+	State = Initial;
+	NoteJudgement::JudgeInput(Chart, State, HoldNote->NoteTag, 1.0);
+	TArray<FNoteJudgement> AutoCompleted;
+	TestEqual(TEXT("Hold completed at its end"), NoteJudgement::CompleteHolds(Chart, State, 2.5, &AutoCompleted), 1);
+	TestEqual(TEXT("Completion reported"), AutoCompleted.Num(), 1);
+	if (AutoCompleted.Num() == 1)
+	{
+		TestEqual(TEXT("Completion is on time"), AutoCompleted[0].TimingDirection, ENoteTimingDirection::OnTime);
+		TestEqual(TEXT("Completion sustained fully"), AutoCompleted[0].SustainRatio, 1.0f, 1e-6f);
+	}
+	TestFalse(TEXT("Later release finds nothing"), NoteJudgement::JudgeRelease(Chart, State, HoldNote->NoteTag, 2.6).IsHit());
+
+	// Release notes ignore presses
+	TestFalse(TEXT("Press does not hit a release note"), NoteJudgement::JudgeInput(Chart, State, ReleaseNote->NoteTag, 3.0).IsHit());
+	const FNoteJudgement Release = NoteJudgement::JudgeRelease(Chart, State, ReleaseNote->NoteTag, 3.05);
+	TestTrue(TEXT("Release hits a release note"), Release.IsHit());
+	TestEqual(TEXT("Release type reported"), Release.InteractionType, ENoteInteractionType::Release);
+	TestTrue(TEXT("Release note consumed"), State.IsConsumed(Release.NoteIndex));
+
+	return true;
+}
+
+/**
+ * Verify session evaluation order, calibration and queue reuse
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FNoteJudgementSessionTest,
+	"UniversalBeat.Judgement.Session",
+	NOTE_JUDGEMENT_TEST_FLAGS
+)
+
+bool FNoteJudgementSessionTest::RunTest(const FString& Parameters)
+{
+	TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> Chart = MakeShared<FCompiledNoteChart, ESPMode::ThreadSafe>();
+	NoteJudgementTests::BuildChart(*Chart);
+
+	const FGameplayTag Left = FGameplayTag::RequestGameplayTag(FName("Input.Left"));
+
+	FBeatSession Session;
+	Session.SetChart(Chart);
+	Session.CalibrationOffsetSeconds = 0.1;
+
+	// Arrived out of order: the 2.1s press must not make the cursor skip the 1.1s note
+	Session.PendingInputs.Emplace(Left, 2.1);
+	Session.PendingInputs.Emplace(Left, 1.1);
+	Session.Evaluate();
+
+	TestEqual(TEXT("Both inputs judged"), Session.Results.Num(), 2);
+	TestEqual(TEXT("Both hit"), Session.NumHits, 2);
+	TestTrue(TEXT("Queue drained"), Session.PendingInputs.IsEmpty());
+	if (Session.Results.Num() == 2)
+	{
+		TestEqual(TEXT("Results keep queue order"), Chart->NoteSeconds[Session.Results[0].NoteIndex], 2.0, 1e-9);
+		TestEqual(TEXT("Calibration removes the player's lag"), Session.Results[1].Accuracy, 1.0f, 1e-4f);
+	}
+
+	// A second session on the same chart has its own consumption
+	FBeatSession Other;
+	Other.SetChart(Chart);
+	Other.PendingInputs.Emplace(Left, 1.0);
+	Other.Evaluate();
+	TestEqual(TEXT("Sessions are independent"), Other.NumHits, 1);
+
+	// Nothing queued: evaluation yields no results
+	Session.Evaluate();
+	TestEqual(TEXT("Empty evaluation"), Session.Results.Num(), 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,108 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+ * TempoMapTests.cpp
+ *
+ * Automated test suite for the piecewise-linear tempo map
+ *
+ * Tests verify:
+ * - Beat <-> seconds conversion is continuous across tempo changes and round-trips
+ * - Keys are sorted, duplicates replaced, and bars follow the time signature
+ * - Chart windows are baked at the tempo around each note
+ */
+
+#include "TempoMap.h"
+#include "BeatTestCharts.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define TEMPO_MAP_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Verify conversions for 120 BPM 4/4 switching to 60 BPM 3/4 at 2s
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FTempoMapConversionTest,
+	"UniversalBeat.TempoMap.Conversion",
+	TEMPO_MAP_TEST_FLAGS
+)
+
+bool FTempoMapConversionTest::RunTest(const FString& Parameters)
+{
+	FTempoMap TempoMap;
+	TestEqual(TEXT("Empty map has no segment"), TempoMap.FindSegment(1.0), INDEX_NONE);
+
+	// Out of order, with a replaced key at 2s
+	TempoMap.AddKey(2.0, 90.0f);
+	TempoMap.AddKey(0.0, 120.0f, 4, 4);
+	TempoMap.AddKey(2.0, 60.0f, 3, 4);
+	TempoMap.Finalize();
+
+	TestEqual(TEXT("Duplicate key replaced"), TempoMap.Num(), 2);
+	TestEqual(TEXT("Later key wins"), TempoMap.GetBPM(1), 60.0f, 1e-4f);
+
+	// 4 beats in the first 2s, then one beat per second
+	TestEqual(TEXT("Beat at 1s"), TempoMap.SecondsToBeats(1.0), 2.0, 1e-9);
+	TestEqual(TEXT("Beat at the change"), TempoMap.SecondsToBeats(2.0), 4.0, 1e-9);
+	TestEqual(TEXT("Beat after the change"), TempoMap.SecondsToBeats(3.5), 5.5, 1e-9);
+	TestEqual(TEXT("Seconds of beat 5"), TempoMap.BeatsToSeconds(5.0), 3.0, 1e-9);
+	TestEqual(TEXT("Seconds of beat 1"), TempoMap.BeatsToSeconds(1.0), 0.5, 1e-9);
+
+	for (double Seconds = 0.0; Seconds < 6.0; Seconds += 0.37)
+	{
+		TestEqual(TEXT("Round trip"), TempoMap.BeatsToSeconds(TempoMap.SecondsToBeats(Seconds)), Seconds, 1e-9);
+	}
+
+	// One 4/4 bar, then 3/4 bars
+	TestEqual(TEXT("Bar at the change"), TempoMap.SecondsToBars(2.0), 1.0, 1e-9);
+	TestEqual(TEXT("3/4 bar after the change"), TempoMap.SecondsToBars(5.0), 2.0, 1e-9);
+
+	// A map starting late extends its first tempo back to time 0
+	FTempoMap LateMap;
+	LateMap.AddKey(1.0, 60.0f);
+	LateMap.Finalize();
+	TestEqual(TEXT("Beat 0 at time 0"), LateMap.SecondsToBeats(0.0), 0.0, 1e-9);
+	TestEqual(TEXT("First tempo before its key"), LateMap.SecondsToBeats(0.5), 0.5, 1e-9);
+
+	return true;
+}
+
+/**
+ * Verify chart windows are baked from the tempo map instead of the subsystem BPM
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FTempoMapWindowTest,
+	"UniversalBeat.TempoMap.Windows",
+	TEMPO_MAP_TEST_FLAGS
+)
+
+bool FTempoMapWindowTest::RunTest(const FString& Parameters)
+{
+	UNoteDataAsset* NoteData = BeatTestCharts::MakeNote(TEXT("Input.Left"));
+
+	UMovieSceneNoteChartSection* Section = BeatTestCharts::MakeSection();
+	TMovieSceneChannelData<FNoteChannelValue> ChannelData = Section->GetNoteChannel().GetData();
+	ChannelData.AddKey(FFrameNumber(24000), FNoteChannelValue(NoteData)); // 1s, 120 BPM
+	ChannelData.AddKey(FFrameNumber(48000), FNoteChannelValue(NoteData)); // 2s, on the change
+	ChannelData.AddKey(FFrameNumber(96000), FNoteChannelValue(NoteData)); // 4s, 60 BPM
+
+	FCompiledNoteChart Chart;
+	Chart.TempoMap.AddKey(0.0, 120.0f);
+	Chart.TempoMap.AddKey(2.0, 60.0f);
+	BeatTestCharts::CompileChart(Chart, *Section, 200.0f);
+
+	TestTrue(TEXT("Chart has a tempo map"), Chart.HasTempoMap());
+
+	// Entries of the only lane are in time order; an eighth is 0.25s at 120 and 0.5s at 60 BPM
+	TestEqual(TEXT("120 BPM pre window"), Chart.LaneWindowStart[0], 1.0 - 0.25, 1e-6);
+	TestEqual(TEXT("120 BPM post window"), Chart.LaneWindowEnd[0], 1.0 + 0.25, 1e-6);
+	TestEqual(TEXT("Pre window before the change"), Chart.LaneWindowStart[1], 2.0 - 0.25, 1e-6);
+	TestEqual(TEXT("Post window after the change"), Chart.LaneWindowEnd[1], 2.0 + 0.5, 1e-6);
+	TestEqual(TEXT("60 BPM post window"), Chart.LaneWindowEnd[2], 4.0 + 0.5, 1e-6);
+	TestEqual(TEXT("Miss sweep bound matches"), Chart.NoteWindowEnd[2], 4.0 + 0.5, 1e-6);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,392 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+ * UniversalBeatBenchmarks.cpp
+ *
+ * Performance benchmarks for the timing and chart hot paths (PerfFilter, not run with the
+ * functional suites). Synthetic data comes from fixed seeds, every case is timed over several
+ * repetitions and the fastest is reported, so numbers are comparable between runs and builds.
+ *
+ * Benchmarks:
+ * - Note judgement throughput (the lookup behind CheckBeatTimingByTag) on 1k/100k/1M-note charts, 4 and 16 lanes
+ * - Chart compile time (the work of LoadNoteChartFromSequence) for the same charts
+ * - Beat tick + dispatch cost with 0-64 native listeners at every subdivision
+ * - UMovieSceneNoteChartSection::PopulateEvaluationFieldImpl on large sections
+ *
+ * Results are written to Saved/Automation/UniversalBeat/<Benchmark>.csv and .json.
+ */
+
+#include "UniversalBeatSubsystem.h"
+#include "BeatTestCharts.h"
+#include "NoteJudgement.h"
+#include "NativeGameplayTags.h"
+#include "Evaluation/MovieSceneEvaluationField.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "Algo/Sort.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define UNIVERSAL_BEAT_BENCHMARK_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+namespace UniversalBeatBenchmarks
+{
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane00, "UniversalBeat.Benchmark.Lane00");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane01, "UniversalBeat.Benchmark.Lane01");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane02, "UniversalBeat.Benchmark.Lane02");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane03, "UniversalBeat.Benchmark.Lane03");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane04, "UniversalBeat.Benchmark.Lane04");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane05, "UniversalBeat.Benchmark.Lane05");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane06, "UniversalBeat.Benchmark.Lane06");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane07, "UniversalBeat.Benchmark.Lane07");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane08, "UniversalBeat.Benchmark.Lane08");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane09, "UniversalBeat.Benchmark.Lane09");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane10, "UniversalBeat.Benchmark.Lane10");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane11, "UniversalBeat.Benchmark.Lane11");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane12, "UniversalBeat.Benchmark.Lane12");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane13, "UniversalBeat.Benchmark.Lane13");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane14, "UniversalBeat.Benchmark.Lane14");
+	UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_Lane15, "UniversalBeat.Benchmark.Lane15");
+
+	static constexpr int32 MaxLanes = 16;
+	static constexpr int32 NumRepetitions = 5;
+	static constexpr int32 RandomSeed = 0x5EED;
+
+	/** Note sizes and lane counts of the chart benchmarks */
+	static constexpr int32 ChartSizes[] = { 1000, 100000, 1000000 };
+	static constexpr int32 ChartLanes[] = { 4, 16 };
+
+	FGameplayTag GetLaneTag(int32 LaneIndex)
+	{
+		static const FGameplayTag* const Tags[MaxLanes] = {
+			&TAG_Lane00, &TAG_Lane01, &TAG_Lane02, &TAG_Lane03, &TAG_Lane04, &TAG_Lane05, &TAG_Lane06, &TAG_Lane07,
+			&TAG_Lane08, &TAG_Lane09, &TAG_Lane10, &TAG_Lane11, &TAG_Lane12, &TAG_Lane13, &TAG_Lane14, &TAG_Lane15 };
+		return *Tags[LaneIndex];
+	}
+
+	/** One measured case */
+	struct FBenchmarkRow
+	{
+		FString Case;
+		int64 Operations = 0;
+		double Seconds = 0.0;
+
+		double GetNanosecondsPerOperation() const { return Operations > 0 ? Seconds * 1e9 / Operations : 0.0; }
+	};
+
+	/** Rows of one benchmark, written as CSV and JSON */
+	struct FBenchmarkReport
+	{
+		FString Benchmark;
+		TArray<FBenchmarkRow> Rows;
+
+		explicit FBenchmarkReport(const TCHAR* InBenchmark) : Benchmark(InBenchmark) {}
+
+		void Add(FAutomationTestBase& Test, const FString& Case, int64 Operations, double Seconds)
+		{
+			FBenchmarkRow& Row = Rows.AddDefaulted_GetRef();
+			Row.Case = Case;
+			Row.Operations = Operations;
+			Row.Seconds = Seconds;
+			Test.AddInfo(FString::Printf(TEXT("%s [%s]: %lld ops in %.3f ms, %.1f ns/op"),
+				*Benchmark, *Case, Operations, Seconds * 1000.0, Row.GetNanosecondsPerOperation()));
+		}
+
+		void Write(FAutomationTestBase& Test) const
+		{
+			FString Csv = TEXT("benchmark,case,operations,total_ms,ns_per_op\n");
+			FString Json = FString::Printf(TEXT("{\n\t\"benchmark\": \"%s\",\n\t\"results\": [\n"), *Benchmark);
+			for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+			{
+				const FBenchmarkRow& Row = Rows[RowIndex];
+				Csv += FString::Printf(TEXT("%s,%s,%lld,%.6f,%.3f\n"),
+					*Benchmark, *Row.Case, Row.Operations, Row.Seconds * 1000.0, Row.GetNanosecondsPerOperation());
+				Json += FString::Printf(TEXT("\t\t{ \"case\": \"%s\", \"operations\": %lld, \"total_ms\": %.6f, \"ns_per_op\": %.3f }%s\n"),
+					*Row.Case, Row.Operations, Row.Seconds * 1000.0, Row.GetNanosecondsPerOperation(),
+					RowIndex + 1 < Rows.Num() ? TEXT(",") : TEXT(""));
+			}
+			Json += TEXT("\t]\n}\n");
+
+			const FString BasePath = FPaths::ProjectSavedDir() / TEXT("Automation") / TEXT("UniversalBeat") / Benchmark;
+			if (!FFileHelper::SaveStringToFile(Csv, *(BasePath + TEXT(".csv"))) || !FFileHelper::SaveStringToFile(Json, *(BasePath + TEXT(".json"))))
+			{
+				Test.AddWarning(FString::Printf(TEXT("Could not write benchmark results to %s"), *BasePath));
+			}
+		}
+	};
+
+	/** Fastest of NumRepetitions runs of Body (Setup runs untimed before each one) */
+	template <typename SetupType, typename BodyType>
+	double MeasureFastest(SetupType&& Setup, BodyType&& Body)
+	{
+		double Fastest = TNumericLimits<double>::Max();
+		for (int32 Repetition = 0; Repetition < NumRepetitions; ++Repetition)
+		{
+			Setup();
+			const double Start = FPlatformTime::Seconds();
+			Body();
+			Fastest = FMath::Min(Fastest, FPlatformTime::Seconds() - Start);
+		}
+		return Fastest;
+	}
+
+	/** One eighth-window note asset per lane */
+	void MakeLaneAssets(int32 NumLanes, TArray<UNoteDataAsset*>& OutAssets)
+	{
+		OutAssets.Reset(NumLanes);
+		for (int32 LaneIndex = 0; LaneIndex < NumLanes; ++LaneIndex)
+		{
+			OutAssets.Add(BeatTestCharts::MakeNote(GetLaneTag(LaneIndex)));
+		}
+	}
+
+	/**
+	 * Section of NumNotes keys, one every 50ms (a dense 300-notes-per-minute-per-lane chart
+	 * at 4 lanes), each in a random lane
+	 */
+	UMovieSceneNoteChartSection* MakeSection(int32 NumNotes, const TArray<UNoteDataAsset*>& LaneAssets)
+	{
+		UMovieSceneNoteChartSection* Section = BeatTestCharts::MakeSection();
+
+		FRandomStream Random(RandomSeed);
+		TMovieSceneChannelData<FNoteChannelValue> ChannelData = Section->GetNoteChannel().GetData();
+		for (int32 NoteIndex = 0; NoteIndex < NumNotes; ++NoteIndex)
+		{
+			ChannelData.AddKey(FFrameNumber(NoteIndex * 1200), FNoteChannelValue(LaneAssets[Random.RandHelper(LaneAssets.Num())]));
+		}
+		return Section;
+	}
+
+	FString DescribeChart(int32 NumNotes, int32 NumLanes)
+	{
+		return FString::Printf(TEXT("%d notes / %d lanes"), NumNotes, NumLanes);
+	}
+}
+
+/**
+ * Judgement throughput: every note pressed once within its window, plus 10% stray presses
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUniversalBeatJudgementBenchmark,
+	"UniversalBeat.Benchmark.Judgement",
+	UNIVERSAL_BEAT_BENCHMARK_FLAGS
+)
+
+bool FUniversalBeatJudgementBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace UniversalBeatBenchmarks;
+
+	FBenchmarkReport Report(TEXT("Judgement"));
+	for (const int32 NumLanes : ChartLanes)
+	{
+		TArray<UNoteDataAsset*> LaneAssets;
+		MakeLaneAssets(NumLanes, LaneAssets);
+
+		for (const int32 NumNotes : ChartSizes)
+		{
+			FCompiledNoteChart Chart;
+			BeatTestCharts::CompileChart(Chart, *MakeSection(NumNotes, LaneAssets));
+
+			// Presses up to 30ms off their note; strays go to a random lane between notes
+			FRandomStream Random(RandomSeed);
+			TArray<FBeatInputEvent> Inputs;
+			Inputs.Reserve(NumNotes + NumNotes / 10);
+			for (int32 NoteIndex = 0; NoteIndex < Chart.Num(); ++NoteIndex)
+			{
+				Inputs.Emplace(Chart.GetNoteTag(NoteIndex), Chart.NoteSeconds[NoteIndex] + Random.FRandRange(-0.03f, 0.03f));
+				if (Random.RandHelper(10) == 0)
+				{
+					Inputs.Emplace(GetLaneTag(Random.RandHelper(NumLanes)), Chart.NoteSeconds[NoteIndex] + 0.025);
+				}
+			}
+			Algo::SortBy(Inputs, &FBeatInputEvent::Timestamp);
+
+			FNoteJudgementState State;
+			int32 NumHits = 0;
+			const double Seconds = MeasureFastest(
+				[&]() { State.Init(Chart); NumHits = 0; },
+				[&]()
+				{
+					for (const FBeatInputEvent& Input : Inputs)
+					{
+						NumHits += NoteJudgement::JudgeInput(Chart, State, Input.InputTag, Input.Timestamp).IsHit() ? 1 : 0;
+					}
+				});
+
+			TestTrue(*FString::Printf(TEXT("Most presses hit (%s)"), *DescribeChart(NumNotes, NumLanes)), NumHits >= NumNotes * 9 / 10);
+			Report.Add(*this, DescribeChart(NumNotes, NumLanes), Inputs.Num(), Seconds);
+		}
+	}
+
+	Report.Write(*this);
+	return true;
+}
+
+/**
+ * Chart compile time: channel keys to a baked, judgement-ready chart
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUniversalBeatChartCompileBenchmark,
+	"UniversalBeat.Benchmark.ChartCompile",
+	UNIVERSAL_BEAT_BENCHMARK_FLAGS
+)
+
+bool FUniversalBeatChartCompileBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace UniversalBeatBenchmarks;
+
+	FBenchmarkReport Report(TEXT("ChartCompile"));
+	for (const int32 NumLanes : ChartLanes)
+	{
+		TArray<UNoteDataAsset*> LaneAssets;
+		MakeLaneAssets(NumLanes, LaneAssets);
+
+		for (const int32 NumNotes : ChartSizes)
+		{
+			const UMovieSceneNoteChartSection* Section = MakeSection(NumNotes, LaneAssets);
+
+			FCompiledNoteChart Chart;
+			const double Seconds = MeasureFastest(
+				[&]() { Chart.Reset(); },
+				[&]() { BeatTestCharts::CompileChart(Chart, *Section); });
+
+			TestEqual(*FString::Printf(TEXT("Every note compiled (%s)"), *DescribeChart(NumNotes, NumLanes)), Chart.Num(), NumNotes);
+			Report.Add(*this, DescribeChart(NumNotes, NumLanes), NumNotes, Seconds);
+		}
+	}
+
+	Report.Write(*this);
+	return true;
+}
+
+/**
+ * Beat tick delivery and event dispatch: one simulated minute at 60 FPS and 180 BPM per case
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUniversalBeatBroadcastBenchmark,
+	"UniversalBeat.Benchmark.BeatBroadcast",
+	UNIVERSAL_BEAT_BENCHMARK_FLAGS
+)
+
+bool FUniversalBeatBroadcastBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace UniversalBeatBenchmarks;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("UniversalBeatBenchmark"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	UUniversalBeatSubsystem* Subsystem = World->GetSubsystem<UUniversalBeatSubsystem>();
+	if (!TestNotNull(TEXT("Subsystem created for the benchmark world"), Subsystem))
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	// Game time is advanced below; the beat clock has to follow it
+	Subsystem->SetRespectTimeDilation(true);
+	Subsystem->SetBPM(180.0f);
+
+	const EBeatSubdivision Subdivisions[] = { EBeatSubdivision::Whole, EBeatSubdivision::Half, EBeatSubdivision::Quarter, EBeatSubdivision::Eighth, EBeatSubdivision::Sixteenth };
+	const int32 ListenerCounts[] = { 0, 1, 16, 64 };
+	const float DeltaTime = 1.0f / 60.0f;
+	const int32 NumFrames = 60 * 60;
+
+	FBenchmarkReport Report(TEXT("BeatBroadcast"));
+	for (const EBeatSubdivision Subdivision : Subdivisions)
+	{
+		for (const int32 NumListeners : ListenerCounts)
+		{
+			int64 NumDelivered = 0;
+			TArray<FDelegateHandle> Listeners;
+			for (int32 ListenerIndex = 0; ListenerIndex < NumListeners; ++ListenerIndex)
+			{
+				Listeners.Add(Subsystem->OnBeatEventNative().AddLambda([&NumDelivered](const FBeatEvent& Event) { ++NumDelivered; }));
+			}
+
+			Subsystem->EnableBeatBroadcasting(Subdivision);
+			uint32 NumBeatTicks = 0;
+			const double Seconds = MeasureFastest(
+				[&]() { Subsystem->ResetTimingStats(); NumDelivered = 0; },
+				[&]()
+				{
+					FTimerManager& TimerManager = World->GetTimerManager();
+					for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+					{
+						// The timer manager only ticks once per engine frame; ticks are found from world time
+						++GFrameCounter;
+						World->TimeSeconds += DeltaTime;
+						TimerManager.Tick(DeltaTime);
+						Subsystem->Tick(DeltaTime);
+					}
+				});
+			NumBeatTicks = Subsystem->GetTimingStats().NumBeatTicks;
+
+			for (const FDelegateHandle& Listener : Listeners)
+			{
+				Subsystem->OnBeatEventNative().Remove(Listener);
+			}
+
+			const FString Case = FString::Printf(TEXT("%s / %d listeners"), *UEnum::GetValueAsString(Subdivision), NumListeners);
+			TestTrue(*FString::Printf(TEXT("Ticks delivered (%s)"), *Case), NumBeatTicks > 0);
+			TestTrue(*FString::Printf(TEXT("Listeners called (%s)"), *Case), NumListeners == 0 || NumDelivered > 0);
+			Report.Add(*this, Case, NumBeatTicks, Seconds);
+		}
+	}
+
+	Subsystem->DisableBeatBroadcasting();
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	Report.Write(*this);
+	return true;
+}
+
+/**
+ * Evaluation field population of one large section over its whole range
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FUniversalBeatEvaluationFieldBenchmark,
+	"UniversalBeat.Benchmark.EvaluationField",
+	UNIVERSAL_BEAT_BENCHMARK_FLAGS
+)
+
+bool FUniversalBeatEvaluationFieldBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace UniversalBeatBenchmarks;
+
+	TArray<UNoteDataAsset*> LaneAssets;
+	MakeLaneAssets(4, LaneAssets);
+
+	FBenchmarkReport Report(TEXT("EvaluationField"));
+	for (const int32 NumNotes : ChartSizes)
+	{
+		UMovieSceneNoteChartSection* Section = MakeSection(NumNotes, LaneAssets);
+
+		TUniquePtr<FMovieSceneEntityComponentField> Field;
+		bool bPopulated = false;
+		const double Seconds = MeasureFastest(
+			[&]() { Field = MakeUnique<FMovieSceneEntityComponentField>(); },
+			[&]()
+			{
+				FMovieSceneEntityComponentFieldBuilder FieldBuilder(Field.Get());
+				bPopulated = Section->PopulateEvaluationFieldImpl(TRange<FFrameNumber>::All(), FMovieSceneEvaluationFieldEntityMetaData(), &FieldBuilder);
+			});
+
+		TestTrue(*FString::Printf(TEXT("Field populated (%d notes)"), NumNotes), bPopulated);
+		Report.Add(*this, FString::Printf(TEXT("%d notes"), NumNotes), NumNotes, Seconds);
+	}
+
+	Report.Write(*this);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
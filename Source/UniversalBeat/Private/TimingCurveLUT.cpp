@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TimingCurveLUT.h"
+#include "Curves/RichCurve.h"
+
+int32 FTimingCurveLUT::Bake(const FRichCurve& Curve)
+{
+	int32 NumClamped = 0;
+	for (int32 Index = 0; Index <= NumSamples; ++Index)
+	{
+		const float Value = Curve.Eval(static_cast<float>(Index) / NumSamples);
+		const float Clamped = FMath::Clamp(Value, 0.0f, 1.0f);
+		NumClamped += Clamped != Value ? 1 : 0;
+		Samples[Index] = Clamped;
+	}
+	return NumClamped;
+}
+
+void FTimingCurveLUT::BakeTriangle()
+{
+	// NumSamples is even, so the peak at 0.5 lands on a sample and the table is exact
+	for (int32 Index = 0; Index <= NumSamples; ++Index)
+	{
+		const float X = static_cast<float>(Index) / NumSamples;
+		Samples[Index] = X <= 0.5f ? X * 2.0f : (1.0f - X) * 2.0f;
+	}
+}
+
+void FTimingCurveLUT::BakeIdentity()
+{
+	for (int32 Index = 0; Index <= NumSamples; ++Index)
+	{
+		Samples[Index] = static_cast<float>(Index) / NumSamples;
+	}
+}
+
+void FTimingCurveLUT::EvaluateBatch(TConstArrayView<float> In, TArrayView<float> Out) const
+{
+	check(Out.Num() >= In.Num());
+
+	// Branch-free body: the compiler vectorizes the clamp/scale/lerp, only the table reads stay scalar
+	const float* RESTRICT Table = Samples.GetData();
+	for (int32 Index = 0; Index < In.Num(); ++Index)
+	{
+		const float Scaled = FMath::Clamp(In[Index], 0.0f, 1.0f) * NumSamples;
+		const int32 Sample = FMath::Min(static_cast<int32>(Scaled), NumSamples - 1);
+		const float Alpha = Scaled - static_cast<float>(Sample);
+		Out[Index] = Table[Sample] + (Table[Sample + 1] - Table[Sample]) * Alpha;
+	}
+}
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "UniversalBeat.h"
+#include "MovieSceneNoteChartSystem.h"
 
 #define LOCTEXT_NAMESPACE "FUniversalBeatModule"
 
@@ -16,6 +17,7 @@ void FUniversalBeatModule::StartupModule()
 void FUniversalBeatModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module
+	FNoteChartComponentTypes::Destroy();
 	UE_LOG(LogUniversalBeat, Log, TEXT("UniversalBeat module shutdown"));
 }
 
@@ -1,79 +1,38 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "UniversalBeatFunctionLibrary.h"
+#include "MusicalTiming.h"
 
 float UUniversalBeatFunctionLibrary::ConvertMusicalNoteToSeconds(EMusicalNoteValue NoteValue, float BPM)
 {
-	return ::ConvertMusicalNoteToSeconds(NoteValue, BPM);
+	return MusicalTiming::NoteValueToSeconds(NoteValue, BPM);
 }
 
 float UUniversalBeatFunctionLibrary::GetNoteValueMultiplier(EMusicalNoteValue NoteValue)
 {
-	switch (NoteValue)
-	{
-	case EMusicalNoteValue::Sixteenth:
-		return 0.25f;
-	case EMusicalNoteValue::Eighth:
-		return 0.5f;
-	case EMusicalNoteValue::Quarter:
-		return 1.0f;
-	case EMusicalNoteValue::Half:
-		return 2.0f;
-	case EMusicalNoteValue::Whole:
-		return 4.0f;
-	default:
-		return 1.0f;
-	}
+	return MusicalTiming::GetNoteValueBeats(NoteValue);
 }
 
 void UUniversalBeatFunctionLibrary::CalculateTimingWindows(EMusicalNoteValue PreTiming, EMusicalNoteValue PostTiming, float BPM, float& OutPreSeconds, float& OutPostSeconds)
 {
-	OutPreSeconds = ConvertMusicalNoteToSeconds(PreTiming, BPM);
-	OutPostSeconds = ConvertMusicalNoteToSeconds(PostTiming, BPM);
+	OutPreSeconds = MusicalTiming::NoteValueToSeconds(PreTiming, BPM);
+	OutPostSeconds = MusicalTiming::NoteValueToSeconds(PostTiming, BPM);
 }
 
 int32 UUniversalBeatFunctionLibrary::GetTicksForSubdivision(EBeatSubdivision Subdivision)
 {
-	// Map subdivision enum to tick divisor
-	// Internal subdivision is always 16 (sixteenth notes)
-	switch (Subdivision)
-	{
-	case EBeatSubdivision::None:
-		return 0;  // No broadcasts
-	case EBeatSubdivision::Whole:
-		return 16;  // Every 16 ticks = whole beat
-	case EBeatSubdivision::Half:
-		return 8;   // Every 8 ticks = half beat
-	case EBeatSubdivision::Quarter:
-		return 4;   // Every 4 ticks = quarter beat
-	case EBeatSubdivision::Eighth:
-		return 2;   // Every 2 ticks = eighth beat
-	case EBeatSubdivision::Sixteenth:
-		return 1;   // Every tick = sixteenth beat
-	default:
-		return 0;
-	}
+	return MusicalTiming::GetSubdivisionTicks(Subdivision);
 }
 
 int32 UUniversalBeatFunctionLibrary::GetSubdivisionMultiplier(EBeatSubdivision Subdivision)
 {
-	// Get subdivision multiplier for timer interval calculation
-	switch (Subdivision)
-	{
-		case EBeatSubdivision::None:    return 1;
-		case EBeatSubdivision::Whole:   return 1;
-		case EBeatSubdivision::Half:    return 2;
-		case EBeatSubdivision::Quarter: return 4;
-		case EBeatSubdivision::Eighth:  return 8;
-		case EBeatSubdivision::Sixteenth:  return 16;
-		default: return 1;
-	}
+	return MusicalTiming::GetSubdivisionsPerBeat(Subdivision);
 }
 
 bool UUniversalBeatFunctionLibrary::IsNoteSubdivision(const FBeatEventData& BeatEvent, EBeatSubdivision TargetSubdivision)
 {
 	// Get the ticks per target subdivision
-	int32 TicksPerSubdivision = GetTicksForSubdivision(TargetSubdivision);
+	int32 TicksPerSubdivision = MusicalTiming::GetSubdivisionTicks(TargetSubdivision);
 	
 	// If target is None or invalid, return false
 	if (TicksPerSubdivision <= 0)
@@ -81,7 +40,7 @@ bool UUniversalBeatFunctionLibrary::IsNoteSubdivision(const FBeatEventData& Beat
 		return false;
 	}
 	
-	int32 BroadcastTicks = GetTicksForSubdivision(BeatEvent.SubdivisionType);
+	int32 BroadcastTicks = MusicalTiming::GetSubdivisionTicks(BeatEvent.SubdivisionType);
 
 	// Check if the SubdivisionIndex aligns with the target subdivision
 	// The SubdivisionIndex cycles based on the broadcast subdivision rate:
@@ -8,15 +8,122 @@
 #include "LevelSequence.h"
 #include "LevelSequencePlayer.h"
 #include "LevelSequenceActor.h"
-#include "UniversalBeatFunctionLibrary.h"
+#include "MusicalTiming.h"
 #include "MovieScene.h"
+#include "MovieSceneTimeHelpers.h"
 #include "MovieSceneNoteChartTrack.h"
 #include "MovieSceneNoteChartSection.h"
 #include "Engine/LocalPlayer.h"
+#include "Misc/ScopeRWLock.h"
+#include "Algo/StableSort.h"
+#include "AudioClockTimingSource.h"
+#include "BeatInputPreprocessor.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GameFramework/WorldSettings.h"
+#include "CookedSongChart.h"
+#include "Components/AudioComponent.h"
+#include "UniversalBeatTrace.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Paths.h"
 
 // Logging category
 DEFINE_LOG_CATEGORY_STATIC(LogUniversalBeat, Log, All);
 
+// Stats
+DECLARE_STATS_GROUP(TEXT("UniversalBeat"), STATGROUP_UniversalBeat, STATCAT_Advanced);
+DECLARE_MEMORY_STAT(TEXT("Note Chart Memory"), STAT_UniversalBeatNoteChartMemory, STATGROUP_UniversalBeat);
+DECLARE_CYCLE_STAT(TEXT("Evaluate Judgement Sessions"), STAT_UniversalBeatEvaluateSessions, STATGROUP_UniversalBeat);
+DECLARE_CYCLE_STAT(TEXT("Broadcast Beat Event"), STAT_UniversalBeatBroadcastBeat, STATGROUP_UniversalBeat);
+DECLARE_CYCLE_STAT(TEXT("Check Beat Timing"), STAT_UniversalBeatCheckTiming, STATGROUP_UniversalBeat);
+DECLARE_CYCLE_STAT(TEXT("Judge Note Input"), STAT_UniversalBeatJudgeNote, STATGROUP_UniversalBeat);
+DECLARE_CYCLE_STAT(TEXT("Load Note Chart"), STAT_UniversalBeatLoadNoteChart, STATGROUP_UniversalBeat);
+DECLARE_CYCLE_STAT(TEXT("Advance Chart Playback"), STAT_UniversalBeatAdvanceChart, STATGROUP_UniversalBeat);
+DECLARE_CYCLE_STAT(TEXT("Dispatch Beat Events"), STAT_UniversalBeatDispatchEvents, STATGROUP_UniversalBeat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Beat Ticks"), STAT_UniversalBeatTicks, STATGROUP_UniversalBeat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Timing Checks"), STAT_UniversalBeatTimingChecks, STATGROUP_UniversalBeat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Note Hits"), STAT_UniversalBeatNoteHits, STATGROUP_UniversalBeat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Notes Missed"), STAT_UniversalBeatNotesMissed, STATGROUP_UniversalBeat);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Beat Events Dispatched"), STAT_UniversalBeatEventsDispatched, STATGROUP_UniversalBeat);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Beat Tick Jitter (ms)"), STAT_UniversalBeatTickJitter, STATGROUP_UniversalBeat);
+
+static void DumpTimingStatsForWorld(UWorld* World)
+{
+	if (const UUniversalBeatSubsystem* Subsystem = World ? World->GetSubsystem<UUniversalBeatSubsystem>() : nullptr)
+	{
+		UE_LOG(LogUniversalBeat, Display, TEXT("UniversalBeat timing stats:\n%s"), *Subsystem->GetTimingStats().ToString());
+	}
+}
+
+static FAutoConsoleCommandWithWorld DumpTimingStatsCommand(
+	TEXT("UniversalBeat.DumpTimingStats"),
+	TEXT("Log the UniversalBeat beat tick jitter, input latency and judgement offset histograms."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&DumpTimingStatsForWorld));
+
+static void ResetTimingStatsForWorld(UWorld* World)
+{
+	if (UUniversalBeatSubsystem* Subsystem = World ? World->GetSubsystem<UUniversalBeatSubsystem>() : nullptr)
+	{
+		Subsystem->ResetTimingStats();
+	}
+}
+
+static FAutoConsoleCommandWithWorld ResetTimingStatsCommand(
+	TEXT("UniversalBeat.ResetTimingStats"),
+	TEXT("Clear the UniversalBeat timing histograms and counters."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&ResetTimingStatsForWorld));
+
+// Below this many sessions with inputs, judging inline is cheaper than waking workers
+static constexpr int32 MinParallelJudgementSessions = 4;
+
+// Calibration: a sequence finishes once this many taps agree to within the target error
+static constexpr int32 MinCalibrationSamples = 4;
+static constexpr float CalibrationTargetErrorMs = 3.0f;
+
+// Passive recalibration waits for a fuller window and only applies changes players could feel
+static constexpr int32 MinPassiveCalibrationSamples = 16;
+static constexpr float PassiveCalibrationApplyThresholdMs = 5.0f;
+
+// Beat ticks delivered per frame at most (four beats); after a longer hitch the oldest are dropped
+static constexpr int64 MaxBeatTicksPerFrame = 64;
+
+static bool NeedsSequencerEvaluation(const UMovieScene& MovieScene)
+{
+	// Note chart tracks are handled by the chart clock; anything else (bindings, camera cuts, audio, events) needs the sequencer
+	if (MovieScene.GetPossessableCount() > 0 || MovieScene.GetSpawnableCount() > 0 || MovieScene.GetCameraCutTrack() != nullptr)
+	{
+		return true;
+	}
+	for (const UMovieSceneTrack* Track : MovieScene.GetTracks())
+	{
+		if (!Cast<UMovieSceneNoteChartTrack>(Track))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// Bake a chart's windows for a BPM without retargeting a chart someone else holds (a song's cooked
+// chart may be live at another BPM): a shared chart that needs rebaking is swapped for a baked copy
+static void BakeChartWindows(TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe>& Chart, float BPM)
+{
+	// Tempo-mapped windows do not follow the BPM, so those are baked once
+	if (!Chart || (Chart->BakedBPM > 0.0f && (Chart->HasTempoMap() || Chart->BakedBPM == BPM)))
+	{
+		return;
+	}
+
+	if (!Chart.IsUnique())
+	{
+		Chart = MakeShared<FCompiledNoteChart, ESPMode::ThreadSafe>(*Chart);
+	}
+	Chart->BakeWindows(BPM);
+}
+
 void UUniversalBeatSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
@@ -31,40 +138,75 @@ void UUniversalBeatSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	bDebugLoggingEnabled = false;
 	CurrentSubdivision = EBeatSubdivision::None;
 	bCurveFallbackWarningLogged = false;
+	TimingCurveLUT.BakeTriangle();
 
 	// Initialize note chart tracking
-	CurrentNoteIndex = 0;
-	CachedSequenceFrameRate = FFrameRate(60, 1); // Default 60 FPS
+	NoteChart.Reset();
+	JudgementState.Empty();
+	CachedSequenceFrameRate = FFrameRate(24000, 1); // Default MovieScene tick resolution
+
+	// Capture press timestamps ahead of game-thread input dispatch
+	const UWorld* World = GetWorld();
+	if (World && World->IsGameWorld() && FSlateApplication::IsInitialized())
+	{
+		InputPreprocessor = MakeShared<FBeatInputPreprocessor>();
+		FSlateApplication::Get().RegisterInputPreProcessor(InputPreprocessor);
+	}
 
-	UE_LOG(LogUniversalBeat, Log, TEXT("UniversalBeatSubsystem initialized - BPM: %.1f, Timer started at Sixteenth rate"), CurrentBPM);
+	UE_LOG(LogUniversalBeat, Log, TEXT("UniversalBeatSubsystem initialized - BPM: %.1f, beat ticks at Sixteenth rate"), CurrentBPM);
 }
 
 void UUniversalBeatSubsystem::Deinitialize()
 {
-	// Clean up SongPlayer actor
+	// Release timing source (unregisters audio render listeners)
+	if (TimingSource)
+	{
+		TimingSource->Shutdown();
+		TimingSource.Reset();
+	}
+
+	if (InputPreprocessor)
+	{
+		if (FSlateApplication::IsInitialized())
+		{
+			FSlateApplication::Get().UnregisterInputPreProcessor(InputPreprocessor);
+		}
+		InputPreprocessor.Reset();
+	}
+
+	JudgementSessions.Empty();
+	JudgementSessionCharts.Empty();
+	PendingBeatEvents.Empty();
+	ReplayRecorder.Stop();
+
+	// Clean up SongPlayer actor and the track player pool
 	if (SongPlayerActor)
 	{
 		SongPlayerActor->Destroy();
 		SongPlayerActor = nullptr;
 	}
+	for (ALevelSequenceActor* PooledActor : SongPlayerPool)
+	{
+		if (IsValid(PooledActor))
+		{
+			PooledActor->Destroy();
+		}
+	}
+	SongPlayerPool.Empty();
+	ActiveSongTracks.Empty();
+	ResetPreparedTrack();
 
-	// T010: Pause timers instead of clearing (preserves calibration state)
+	// T010: Beat ticks come from Tick, so the calibration timer is the only one left to clear
 	if (UWorld* World = GetWorld())
 	{
 		FTimerManager& TimerManager = World->GetTimerManager();
 		
-		// Pause Universal Beat Timer
-		if (TimerManager.IsTimerActive(BeatBroadcastTimer))
-		{
-			TimerManager.PauseTimer(BeatBroadcastTimer);
-		}
-		
 		// Clear calibration timer (transient state)
 		TimerManager.ClearTimer(CalibrationTimer);
 	}
 	
 	Super::Deinitialize();
-	UE_LOG(LogUniversalBeat, Log, TEXT("UniversalBeatSubsystem deinitialized - Timer paused"));
+	UE_LOG(LogUniversalBeat, Log, TEXT("UniversalBeatSubsystem deinitialized - Calibration timer cleared"));
 }
 
 void UUniversalBeatSubsystem::OnWorldBeginPlay(UWorld& InWorld)
@@ -73,6 +215,38 @@ void UUniversalBeatSubsystem::OnWorldBeginPlay(UWorld& InWorld)
 	RecreateTimerWithNewRate();
 }
 
+void UUniversalBeatSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Pull render-thread timing samples once per frame before any queries run
+	if (TimingSource)
+	{
+		TimingSource->Tick();
+	}
+
+	AdvanceChartPlayback();
+	AdvanceBeatTicks();
+	EvaluateJudgementSessions();
+	DispatchBeatEvents();
+}
+
+void UUniversalBeatSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UUniversalBeatSubsystem* This = CastChecked<UUniversalBeatSubsystem>(InThis);
+	for (FBeatSession& Session : This->JudgementSessions)
+	{
+		Collector.AddReferencedObjects(Session.NoteAssets, This);
+	}
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+TStatId UUniversalBeatSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UUniversalBeatSubsystem, STATGROUP_Tickables);
+}
+
 // ====================================================================
 // 1. BPM Configuration
 // ====================================================================
@@ -87,6 +261,8 @@ void UUniversalBeatSubsystem::SetBPM(float NewBPM)
 		UE_LOG(LogUniversalBeat, Error, TEXT("Invalid BPM value %.2f rejected (<=0, NaN, or Inf), resetting to default 120"), NewBPM);
 		CurrentBPM = 120.0f;
 		PendingBPM = 0.0f;
+		ReplayRecorder.RecordTempoChange(GetBeatClockTime(), CurrentBPM);
+		RebuildNoteLaneWindows();
 		RecreateTimerWithNewRate();
 		return;
 	}
@@ -125,7 +301,18 @@ float UUniversalBeatSubsystem::GetSecondsPerBeat() const
 void UUniversalBeatSubsystem::SetRespectTimeDilation(bool bRespect)
 {
 	// T014: Set time dilation mode
-	bRespectTimeDilation = bRespect;
+	if (bRespect != bRespectTimeDilation)
+	{
+		// Move the clock anchor into the new time domain so the beat position doesn't jump
+		const double OldDomainNow = GetBeatClockTime();
+		bRespectTimeDilation = bRespect;
+		const double NewDomainNow = GetBeatClockTime();
+
+		ChartStartTime += NewDomainNow - OldDomainNow;
+
+		FWriteScopeLock Lock(BeatClockLock);
+		BeatClock.Rebase(OldDomainNow, NewDomainNow);
+	}
 	
 	if (bDebugLoggingEnabled)
 	{
@@ -142,18 +329,95 @@ bool UUniversalBeatSubsystem::GetRespectTimeDilation() const
 
 void UUniversalBeatSubsystem::PauseBeatTimer(bool bPause)
 {
-	if (UWorld* World = GetWorld())
+	// A paused clock crosses no ticks, so beat events stop with it
+	const double Now = GetBeatClockTime();
+
+	// Chart time stops with the beat clock so notes don't fire (or expire) while paused
+	if (bChartPlaybackActive && bPause != bChartPaused)
 	{
-		FTimerManager& TimerManager = World->GetTimerManager();
-		
 		if (bPause)
 		{
-			TimerManager.PauseTimer(BeatBroadcastTimer);
+			ChartPausedTime = GetChartTime();
 		}
 		else
 		{
-			TimerManager.UnPauseTimer(BeatBroadcastTimer);
+			ChartStartTime = Now - (ChartPausedTime - ChartRangeStartSeconds);
 		}
+		bChartPaused = bPause;
+	}
+
+	FWriteScopeLock Lock(BeatClockLock);
+	if (bPause)
+	{
+		BeatClock.Pause(Now);
+	}
+	else
+	{
+		BeatClock.Resume(Now);
+	}
+}
+
+bool UUniversalBeatSubsystem::SetAudioClockSource(UAudioComponent* SongAudio)
+{
+	if (!SongAudio)
+	{
+		ClearTimingSource();
+		return false;
+	}
+
+	TSharedRef<FAudioClockTimingSource, ESPMode::ThreadSafe> AudioSource = MakeShared<FAudioClockTimingSource, ESPMode::ThreadSafe>();
+	if (!AudioSource->Initialize(SongAudio))
+	{
+		UE_LOG(LogUniversalBeat, Warning, TEXT("SetAudioClockSource: Could not attach to audio component '%s'"), *SongAudio->GetName());
+		return false;
+	}
+
+	SetTimingSource(AudioSource);
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("SetAudioClockSource: Beat timing now follows audio clock of '%s'"), *SongAudio->GetName());
+	}
+
+	return true;
+}
+
+void UUniversalBeatSubsystem::ClearTimingSource()
+{
+	SetTimingSource(nullptr);
+}
+
+void UUniversalBeatSubsystem::SetTimingSource(TSharedPtr<IBeatTimingSource, ESPMode::ThreadSafe> InSource)
+{
+	if (InSource == TimingSource)
+	{
+		return;
+	}
+
+	const double OldDomainNow = GetBeatClockTime();
+
+	if (TimingSource)
+	{
+		TimingSource->Shutdown();
+	}
+	TimingSource = InSource;
+
+	const double NewDomainNow = GetBeatClockTime();
+
+	// Chart time continues seamlessly in the new domain
+	ChartStartTime += NewDomainNow - OldDomainNow;
+
+	FWriteScopeLock Lock(BeatClockLock);
+	if (TimingSource && TimingSource->IsSongPositionSource())
+	{
+		// Song time 0 is the first beat of the music
+		BeatClock.Start(0.0, CurrentBPM, MusicalTiming::TicksPerBeat);
+		BeatClock.SetOffset(CalibrationOffsetMs / 1000.0);
+		ResetBeatTickCursor();
+	}
+	else
+	{
+		BeatClock.Rebase(OldDomainNow, NewDomainNow);
 	}
 }
 
@@ -164,7 +428,46 @@ void UUniversalBeatSubsystem::PauseBeatTimer(bool bPause)
 float UUniversalBeatSubsystem::CheckBeatTimingByLabel(FName LabelName)
 {
 	// T021: Check timing with label identifier
-	return CheckBeatTimingInternal(LabelName, FGameplayTag());
+	const double ClockTime = GetBeatClockTime();
+	ReplayRecorder.RecordBeatCheck(LabelName, ClockTime);
+	return CheckBeatTimingInternal(LabelName, FGameplayTag(), ClockTime);
+}
+
+float UUniversalBeatSubsystem::CheckBeatTimingByLabelAtTime(FName LabelName, double InputPlatformTime)
+{
+	RecordInputLatency(InputPlatformTime);
+	const double ClockTime = PlatformTimeToBeatClockTime(InputPlatformTime);
+	ReplayRecorder.RecordBeatCheck(LabelName, ClockTime);
+	return CheckBeatTimingInternal(LabelName, FGameplayTag(), ClockTime);
+}
+
+double UUniversalBeatSubsystem::GetLastInputTimestamp(FKey Key) const
+{
+	const double PressTime = InputPreprocessor ? InputPreprocessor->GetLastPressTime(Key) : 0.0;
+	return PressTime > 0.0 ? PressTime : FPlatformTime::Seconds();
+}
+
+double UUniversalBeatSubsystem::GetLastReleaseTimestamp(FKey Key) const
+{
+	const double ReleaseTime = InputPreprocessor ? InputPreprocessor->GetLastReleaseTime(Key) : 0.0;
+	return ReleaseTime > 0.0 ? ReleaseTime : FPlatformTime::Seconds();
+}
+
+double UUniversalBeatSubsystem::PlatformTimeToBeatClockTime(double PlatformSeconds) const
+{
+	// How long ago the input happened, converted into the clock's domain
+	double Age = FMath::Max(FPlatformTime::Seconds() - PlatformSeconds, 0.0);
+	if (!TimingSource && bRespectTimeDilation)
+	{
+		if (const UWorld* World = GetWorld())
+		{
+			if (const AWorldSettings* WorldSettings = World->GetWorldSettings())
+			{
+				Age *= WorldSettings->GetEffectiveTimeDilation();
+			}
+		}
+	}
+	return GetBeatClockTime() - Age;
 }
 
 
@@ -176,6 +479,26 @@ void UUniversalBeatSubsystem::SetTimingCurve(UCurveFloat* NewCurve)
 	
 	// Reset fallback warning flag when curve changes
 	bCurveFallbackWarningLogged = false;
+
+	// Bake once; checks only ever read the table
+	if (NewCurve && NewCurve->FloatCurve.GetNumKeys() > 0)
+	{
+		const int32 NumClamped = TimingCurveLUT.Bake(NewCurve->FloatCurve);
+		if (NumClamped > 0)
+		{
+			UE_LOG(LogUniversalBeat, Warning, TEXT("Timing curve '%s' leaves [0, 1] in %d of %d samples, clamped"),
+				*NewCurve->GetName(), NumClamped, FTimingCurveLUT::NumSamples + 1);
+		}
+	}
+	else
+	{
+		TimingCurveLUT.BakeTriangle();
+		if (NewCurve)
+		{
+			UE_LOG(LogUniversalBeat, Warning, TEXT("Timing curve '%s' has no keys, using linear fallback"), *NewCurve->GetName());
+			bCurveFallbackWarningLogged = true;
+		}
+	}
 	
 	if (bDebugLoggingEnabled)
 	{
@@ -202,7 +525,7 @@ UCurveFloat* UUniversalBeatSubsystem::GetTimingCurve() const
 
 void UUniversalBeatSubsystem::SetCalibrationOffset(float OffsetMs)
 {
-	// T030: Validate and set calibration offset with timer recreation
+	// T030: Validate and set calibration offset, then re-phase the beat clock
 	float ClampedOffset = FMath::Clamp(OffsetMs, -200.0f, 200.0f);
 	
 	if (ClampedOffset != OffsetMs)
@@ -216,14 +539,15 @@ void UUniversalBeatSubsystem::SetCalibrationOffset(float OffsetMs)
 	}
 	
 	CalibrationOffsetMs = ClampedOffset;
+	ReplayRecorder.RecordCalibrationChange(GetBeatClockTime(), CalibrationOffsetMs);
 	
-	// Recreate timer with new offset as initial delay
+	// Restart the beat clock so ticks line up with the offset
 	// Note: This causes a brief timing discontinuity, acceptable during calibration
 	RecreateTimerWithNewRate();
 	
 	if (bDebugLoggingEnabled)
 	{
-		UE_LOG(LogUniversalBeat, Log, TEXT("Calibration offset set to %.2fms - Timer recreated with adjusted initial delay"), CalibrationOffsetMs);
+		UE_LOG(LogUniversalBeat, Log, TEXT("Calibration offset set to %.2fms - beat clock re-phased"), CalibrationOffsetMs);
 	}
 }
 
@@ -235,26 +559,56 @@ float UUniversalBeatSubsystem::GetCalibrationOffset() const
 
 void UUniversalBeatSubsystem::RunCalibrationSequence(int32 NumPrompts)
 {
-	// T032: Simplified calibration sequence
-	// For full implementation, would need timer-based prompt presentation
-	// This version provides the basic structure
-	
+	// T032: Calibration sequence, driven by the player's timestamped taps
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		UE_LOG(LogUniversalBeat, Error, TEXT("RunCalibrationSequence: No valid world"));
+		OnCalibrationComplete.Broadcast(CalibrationOffsetMs, false);
+		return;
+	}
+
 	int32 ClampedPrompts = FMath::Clamp(NumPrompts, 5, 20);
 	
 	CalibrationTotalPrompts = ClampedPrompts;
-	CalibrationPromptsRemaining = ClampedPrompts;
-	CalibrationOffsets.Empty();
-	
-	UE_LOG(LogUniversalBeat, Log, TEXT("Calibration sequence started - %d prompts"), ClampedPrompts);
-	
-	// In a full implementation, this would:
-	// 1. Present visual/audio prompts at beat intervals
-	// 2. Collect player input timing via timing checks
-	// 3. Calculate average offset from collected data
-	// 4. Broadcast OnCalibrationComplete with result
+	CalibrationPromptsRemaining = ClampedPrompts + 2;
+	CalibrationEstimator.Reset();
 	
-	// For now, complete immediately with placeholder
-	CompleteCalibrationSequence();
+	UE_LOG(LogUniversalBeat, Log, TEXT("Calibration sequence started - up to %d prompts"), ClampedPrompts);
+
+	// Prompts only pace the player and bound the sequence; the samples come from the taps themselves
+	World->GetTimerManager().SetTimer(CalibrationTimer, this, &UUniversalBeatSubsystem::PresentCalibrationPrompt,
+		static_cast<float>(BeatClock.GetSecondsPerBeat()), true);
+}
+
+bool UUniversalBeatSubsystem::IsCalibrating() const
+{
+	return CalibrationTotalPrompts > 0;
+}
+
+void UUniversalBeatSubsystem::EnablePassiveCalibration(bool bEnabled, bool bAutoApply)
+{
+	bPassiveCalibrationEnabled = bEnabled;
+	bPassiveCalibrationAutoApply = bAutoApply;
+	PassiveCalibrationEstimator.Reset();
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("Passive calibration %s%s"),
+			bEnabled ? TEXT("enabled") : TEXT("disabled"), (bEnabled && bAutoApply) ? TEXT(" (auto-apply)") : TEXT(""));
+	}
+}
+
+bool UUniversalBeatSubsystem::IsPassiveCalibrationEnabled() const
+{
+	return bPassiveCalibrationEnabled;
+}
+
+float UUniversalBeatSubsystem::GetPassiveCalibrationEstimate(float& OutStandardErrorMs, int32& OutNumSamples) const
+{
+	OutNumSamples = PassiveCalibrationEstimator.Num();
+	OutStandardErrorMs = PassiveCalibrationEstimator.GetStandardErrorMs();
+	return OutNumSamples > 0 ? PassiveCalibrationEstimator.GetEstimateMs() : CalibrationOffsetMs;
 }
 
 // ====================================================================
@@ -264,27 +618,27 @@ void UUniversalBeatSubsystem::RunCalibrationSequence(int32 NumPrompts)
 void UUniversalBeatSubsystem::EnableBeatBroadcasting(EBeatSubdivision Subdivision)
 {
 	// T024: Enable beat broadcasting with subdivision filtering
-	// Timer always runs at Sixteenth rate; this just controls which timer ticks fire OnBeat events
+	// Ticks always run at Sixteenth rate; this just controls which ticks fire OnBeat events
 	bBeatBroadcastingEnabled = true;
 	CurrentSubdivision = Subdivision;
 	
 	if (bDebugLoggingEnabled)
 	{
 		UE_LOG(LogUniversalBeat, Log, TEXT("Beat broadcasting enabled - Subdivision:%d (filtering on %d-tick boundaries)"), 
-			(int32)Subdivision, UUniversalBeatFunctionLibrary::GetTicksForSubdivision(Subdivision));
+			(int32)Subdivision, MusicalTiming::GetSubdivisionTicks(Subdivision));
 	}
 }
 
 void UUniversalBeatSubsystem::DisableBeatBroadcasting()
 {
 	// T025: Disable beat broadcasting
-	// Timer continues running for timing checks; just stop firing OnBeat events
+	// Ticks continue for timing checks; just stop firing OnBeat events
 	bBeatBroadcastingEnabled = false;
 	CurrentSubdivision = EBeatSubdivision::None;
 	
 	if (bDebugLoggingEnabled)
 	{
-		UE_LOG(LogUniversalBeat, Log, TEXT("Beat broadcasting disabled - Timer continues for timing checks"));
+		UE_LOG(LogUniversalBeat, Log, TEXT("Beat broadcasting disabled - Ticks continue for timing checks"));
 	}
 }
 
@@ -294,6 +648,16 @@ bool UUniversalBeatSubsystem::IsBeatBroadcastingEnabled() const
 	return bBeatBroadcastingEnabled;
 }
 
+void UUniversalBeatSubsystem::SetBeatEventLookahead(float Seconds)
+{
+	BeatEventLookaheadSeconds = FMath::Clamp(FMath::IsFinite(Seconds) ? Seconds : 0.0f, 0.0f, 1.0f);
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("Beat event lookahead set to %.3fs"), BeatEventLookaheadSeconds);
+	}
+}
+
 // ====================================================================
 // 5. Debug & Utility
 // ====================================================================
@@ -311,11 +675,83 @@ bool UUniversalBeatSubsystem::IsDebugLoggingEnabled() const
 	return bDebugLoggingEnabled;
 }
 
+float UUniversalBeatSubsystem::GetTimingStatPercentile(EBeatTimingMetric Metric, float Percentile) const
+{
+	switch (Metric)
+	{
+	case EBeatTimingMetric::TickJitter:
+		return TimingStats.TickJitter.GetPercentile(Percentile);
+	case EBeatTimingMetric::InputLatency:
+		return TimingStats.InputLatency.GetPercentile(Percentile);
+	case EBeatTimingMetric::JudgementOffset:
+		return TimingStats.JudgementOffset.GetPercentile(Percentile);
+	}
+	return 0.0f;
+}
+
+void UUniversalBeatSubsystem::ResetTimingStats()
+{
+	TimingStats.Reset();
+}
+
+bool UUniversalBeatSubsystem::StartReplayRecording(const FString& Filename)
+{
+	const FString Path = FPaths::IsRelative(Filename) ? FPaths::ProjectSavedDir() / TEXT("Replays") / Filename : Filename;
+	if (!ReplayRecorder.Start(Path, GetBeatClockTime(), CurrentBPM, CalibrationOffsetMs))
+	{
+		UE_LOG(LogUniversalBeat, Warning, TEXT("StartReplayRecording: Could not open '%s'"), *Path);
+		return false;
+	}
+
+	// Recording mid-chart: inputs from here on belong to the pass in progress
+	if (bChartPlaybackActive)
+	{
+		ReplayRecorder.RecordPassStart(ChartStartTime);
+	}
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("StartReplayRecording: Recording to '%s'"), *Path);
+	}
+	return true;
+}
+
+void UUniversalBeatSubsystem::StopReplayRecording()
+{
+	if (!ReplayRecorder.IsRecording())
+	{
+		return;
+	}
+
+	const uint64 NumBytes = ReplayRecorder.GetNumBytesRecorded();
+	ReplayRecorder.Stop();
+
+	if (ReplayRecorder.GetNumDroppedEvents() > 0)
+	{
+		UE_LOG(LogUniversalBeat, Warning, TEXT("StopReplayRecording: %d events were dropped (replay sink too slow)"), ReplayRecorder.GetNumDroppedEvents());
+	}
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("StopReplayRecording: %llu bytes recorded"), NumBytes);
+	}
+}
+
+int64 UUniversalBeatSubsystem::GetNoteChartMemoryUsage() const
+{
+	if (!NoteChart)
+	{
+		return 0;
+	}
+
+	return static_cast<int64>(NoteChart->GetAllocatedSize()
+		+ NoteChartAssets.GetAllocatedSize()
+		+ JudgementState.GetAllocatedSize());
+}
+
 int32 UUniversalBeatSubsystem::GetCurrentBeatNumber() const
 {
-	// Calculate beat number from current tick counter
-	// Since timer ticks at InternalSubdivision default to Sixteenth rate (16 ticks per beat)
-	return CurrentBeatTick / InternalSubdivision;
+	// Whole beats elapsed on the beat clock since the timer was (re)started
+	return BeatClock.GetBeatNumber(GetBeatClockTime());
 }
 
 float UUniversalBeatSubsystem::GetCurrentBeatPhase() const
@@ -324,19 +760,36 @@ float UUniversalBeatSubsystem::GetCurrentBeatPhase() const
 	return CalculateBeatPhase();
 }
 
-// ====================================================================
-// Internal Helper Functions
-// ====================================================================
+FBeatClock UUniversalBeatSubsystem::GetBeatClock() const
+{
+	FReadScopeLock Lock(BeatClockLock);
+	return BeatClock;
+}
 
-float UUniversalBeatSubsystem::GetTimerRate() const
+double UUniversalBeatSubsystem::GetBeatClockTime() const
 {
-	// T006: Return timer rate for Sixteenth subdivision (1/16th notes)
-	return (60.0f / GetBPM()) / InternalSubdivision + (GetCalibrationOffset() / 1000.0f);
+	if (TimingSource)
+	{
+		return TimingSource->GetTimeSeconds();
+	}
+
+	if (bRespectTimeDilation)
+	{
+		if (const UWorld* World = GetWorld())
+		{
+			return World->GetTimeSeconds();
+		}
+	}
+	return FPlatformTime::Seconds();
 }
 
+// ====================================================================
+// Internal Helper Functions
+// ====================================================================
+
 void UUniversalBeatSubsystem::RecreateTimerWithNewRate()
 {
-	// T008: Centralized timer recreation logic
+	// T008: Centralized clock restart logic
 	if (!GetWorld())
 	{
 		return;
@@ -345,138 +798,163 @@ void UUniversalBeatSubsystem::RecreateTimerWithNewRate()
 	UWorld* World = GetWorld();
 	FTimerManager& TimerManager = World->GetTimerManager();
 
-	// Clear existing timer
-	if (TimerManager.IsTimerActive(BeatBroadcastTimer))
+	// Re-anchor the beat clock; ticks are delivered from its next tick on
+	// Calibration offset is applied as a phase shift on the beat clock, not as a rate change
+	auto StartBeatTimer = [this]()
 	{
-		TimerManager.ClearTimer(BeatBroadcastTimer);
-	}
+		const double Now = GetBeatClockTime();
+		{
+			FWriteScopeLock Lock(BeatClockLock);
+			BeatClock.Start(Now, CurrentBPM, MusicalTiming::TicksPerBeat);
+			BeatClock.SetOffset(CalibrationOffsetMs / 1000.0);
+		}
 
-	// Calculate new timer rate (Sixteenth note intervals)
-	float TimerRate = GetTimerRate();
+		ResetBeatTickCursor();
+	};
 
-	// Create new timer with appropriate time mode
+	// Restart in the appropriate time mode (real-time restarts wait for the next frame)
 	if (bRespectTimeDilation)
 	{
-		TimerManager.SetTimer(
-			BeatBroadcastTimer,
-			this,
-			&UUniversalBeatSubsystem::BroadcastBeatEvent,
-			TimerRate,
-			true,  // Loop
-			0
-		);
+		StartBeatTimer();
 	}
 	else
 	{
-		TimerManager.SetTimerForNextTick([this, TimerRate, World]()
-		{
-			World->GetTimerManager().SetTimer(
-				BeatBroadcastTimer,
-				this,
-				&UUniversalBeatSubsystem::BroadcastBeatEvent,
-				TimerRate,
-				true,  // Loop
-				0.0f
-			);
-		});
+		TimerManager.SetTimerForNextTick(StartBeatTimer);
 	}
+}
 
-	// Reset tick counter when timer is recreated
-	CurrentBeatTick = 0;
+void UUniversalBeatSubsystem::ResetBeatTickCursor()
+{
+	// Tick counter continues from the clock (negative offsets start mid-tick)
+	const double Now = GetBeatClockTime();
+	CurrentBeatTick = BeatClock.GetTick(Now);
 
 	if (bDebugLoggingEnabled)
 	{
-		UE_LOG(LogUniversalBeat, Log, TEXT("Timer recreated: Rate=%.6f, InitialDelay=%.6f, BPM=%.2f"),
-			TimerRate, 0.0f, CurrentBPM);
+		UE_LOG(LogUniversalBeat, Log, TEXT("Beat ticks resynced: SecondsPerTick=%.6f, NextTickIn=%.6f, BPM=%.2f, Tick=%lld"),
+			BeatClock.GetSecondsPerTick(), BeatClock.GetTickTime(CurrentBeatTick + 1) - Now, CurrentBPM, CurrentBeatTick);
 	}
 }
 
-float UUniversalBeatSubsystem::CalculateBeatPhase() const
+void UUniversalBeatSubsystem::ApplyTempoChange(float NewBPM, double ClockTime)
 {
-	// T012: Calculate BeatPhase from Universal Beat Timer's remaining time
-	// IMPORTANT: Must be called from game thread only
-	
-	if (!GetWorld())
+	PendingBPM = 0.0f;
+	if (NewBPM <= 0.0f || NewBPM == CurrentBPM)
 	{
-		return 0.0f;
+		return;
 	}
-	
-	UWorld* World = GetWorld();
-	FTimerManager& TimerManager = World->GetTimerManager();
-	
-	// Check if timer is active
-	if (!TimerManager.IsTimerActive(BeatBroadcastTimer))
+
+	if (bDebugLoggingEnabled)
 	{
-		// Timer not started yet, return default
-		return -1.0f;
+		UE_LOG(LogUniversalBeat, Log, TEXT("ApplyTempoChange: %.2f -> %.2f at beat %.3f"),
+			CurrentBPM, NewBPM, BeatClock.GetBeatPosition(ClockTime));
 	}
-	
-	// Get remaining time until next timer fire
-	float TimerRemaining = TimerManager.GetTimerRemaining(BeatBroadcastTimer);
-	
-	// Get current timer rate (Sixteenth subdivision)
-	float TimerRate = TimerManager.GetTimerRate(BeatBroadcastTimer);
-	
 
-	// Remap TimerRemaining from [0, TimerRate] to [-1.0, +1.0]
-	// Formula: BeatPhase = ((TimerRemaining / TimerRate) * 2.0) - 1.0
-	// We should check for TimerRate > 0 to avoid division by zero, but it should never be zero in practice
-	// When TimerRemaining = 0 (just fired): BeatPhase = -1.0 (beat edge)
-	// When TimerRemaining = TimerRate/2 (halfway): BeatPhase = 0.0 (beat peak)
-	// When TimerRemaining = TimerRate (just started): BeatPhase = +1.0 (beat edge)
-	float BeatPhase = ((TimerRemaining / TimerRate) * 2.0f) - 1.0f;
-	
-	// Safety clamp to ensure range
-	BeatPhase = FMath::Clamp(BeatPhase, -1.0f, 1.0f);
-	
-	return BeatPhase;
+	CurrentBPM = NewBPM;
+	{
+		// Re-anchors at the change point: beat number and phase carry on at the new rate
+		FWriteScopeLock Lock(BeatClockLock);
+		BeatClock.SetBPM(ClockTime, CurrentBPM);
+	}
+	ReplayRecorder.RecordTempoChange(ClockTime, CurrentBPM);
+
+	RebuildNoteLaneWindows();
+	EnqueueBeatEvent(FBeatEvent::MakeBPMChanged(CurrentBPM));
 }
 
-float UUniversalBeatSubsystem::EvaluateTimingCurve(float BeatPhase)
+void UUniversalBeatSubsystem::UpdateChartTempo(const FCompiledNoteChart& Chart, double ChartTime)
 {
-	// T020: Curve evaluation with validation and fallback
-	float RawValue;
-	
-	if (TimingCurve && TimingCurve->FloatCurve.GetNumKeys() > 0)
+	const FTempoMap& TempoMap = Chart.TempoMap;
+	if (ChartTempoSegment == INDEX_NONE || TempoMap.IsEmpty())
 	{
-		// Valid curve - evaluate it
-		RawValue = TimingCurve->GetFloatValue(BeatPhase);
+		return;
 	}
-	else
+
+	// Each boundary is applied at its exact clock time, so a hitch does not shift the grid
+	while (ChartTempoSegment + 1 < TempoMap.Num() && TempoMap.SegmentSeconds[ChartTempoSegment + 1] <= ChartTime)
 	{
-		// Invalid/null curve - use linear fallback (FR-007a)
-		if (!bCurveFallbackWarningLogged)
-		{
-			UE_LOG(LogUniversalBeat, Warning, TEXT("TimingCurve is null or invalid, using linear fallback"));
-			bCurveFallbackWarningLogged = true;
-		}
-		
-		// Linear fallback: Triangle wave
-		// 0.0→0.5 = rise from 0.0 to 1.0
-		// 0.5→1.0 = fall from 1.0 to 0.0
-		if (BeatPhase <= 0.5f)
-		{
-			RawValue = BeatPhase * 2.0f;
-		}
-		else
-		{
-			RawValue = (1.0f - BeatPhase) * 2.0f;
-		}
+		++ChartTempoSegment;
+		const double ChangeClockTime = ChartStartTime + (TempoMap.SegmentSeconds[ChartTempoSegment] - ChartRangeStartSeconds);
+		ApplyTempoChange(TempoMap.GetBPM(ChartTempoSegment), ChangeClockTime);
 	}
-	
-	// Clamp to valid range [0.0, 1.0] (FR-007b)
-	float ClampedValue = FMath::Clamp(RawValue, 0.0f, 1.0f);
-	if (ClampedValue != RawValue)
+}
+
+void UUniversalBeatSubsystem::AlignBeatClockToChart(const FCompiledNoteChart& Chart)
+{
+	const FTempoMap& TempoMap = Chart.TempoMap;
+	ChartTempoSegment = TempoMap.FindSegment(ChartRangeStartSeconds);
+	if (ChartTempoSegment == INDEX_NONE)
 	{
-		UE_LOG(LogUniversalBeat, Warning, TEXT("Curve returned out-of-range value %.3f, clamped to %.3f"), RawValue, ClampedValue);
+		return;
 	}
-	
-	return ClampedValue;
+
+	const float ChartBPM = TempoMap.GetBPM(ChartTempoSegment);
+	const bool bTempoChanged = ChartBPM != CurrentBPM;
+	CurrentBPM = ChartBPM;
+	PendingBPM = 0.0f;
+	{
+		// Clock beats are chart beats from here on, also when the range starts mid-song
+		FWriteScopeLock Lock(BeatClockLock);
+		BeatClock.Start(ChartStartTime, CurrentBPM, MusicalTiming::TicksPerBeat, TempoMap.SecondsToBeats(ChartRangeStartSeconds));
+		BeatClock.SetOffset(CalibrationOffsetMs / 1000.0);
+	}
+	ResetBeatTickCursor();
+
+	if (bTempoChanged)
+	{
+		EnqueueBeatEvent(FBeatEvent::MakeBPMChanged(CurrentBPM));
+	}
+}
+
+float UUniversalBeatSubsystem::GetTimeSignature(int32& OutBeatsPerBar, int32& OutBeatUnit) const
+{
+	OutBeatsPerBar = 4;
+	OutBeatUnit = 4;
+	if (!NoteChart || !NoteChart->HasTempoMap())
+	{
+		return 0.0f;
+	}
+
+	const FTempoMap& TempoMap = NoteChart->TempoMap;
+	const double ChartTime = GetCurrentPlaybackTime();
+	const int32 Segment = TempoMap.FindSegment(ChartTime);
+	OutBeatsPerBar = TempoMap.SegmentBeatsPerBar[Segment];
+	OutBeatUnit = TempoMap.SegmentBeatUnit[Segment];
+	return static_cast<float>(TempoMap.SecondsToBars(ChartTime));
+}
+
+float UUniversalBeatSubsystem::CalculateBeatPhase() const
+{
+	// T012: Calculate BeatPhase analytically from the beat clock
+	// Equivalent to the old remap of TimerRemaining from [0, TimerRate] to [-1.0, +1.0],
+	// but evaluated at the exact query time instead of the frame the timer last fired on:
+	// - Tick just fired: BeatPhase = +1.0 (beat edge)
+	// - Halfway to next tick: BeatPhase = 0.0 (beat peak)
+	// - Next tick about to fire: BeatPhase = -1.0 (beat edge)
+	// Returns -1.0 until the clock has been started
+	return BeatClock.GetBeatPhase(GetBeatClockTime());
+}
+
+float UUniversalBeatSubsystem::EvaluateTimingCurve(float BeatPhase)
+{
+	// T020: Curve evaluation with validation and fallback
+	// Validation and clamping (FR-007b) happen when the curve is baked in SetTimingCurve
+	if (!TimingCurve && !bCurveFallbackWarningLogged)
+	{
+		// Null curve - the table holds the linear fallback (FR-007a)
+		UE_LOG(LogUniversalBeat, Warning, TEXT("TimingCurve is null or invalid, using linear fallback"));
+		bCurveFallbackWarningLogged = true;
+	}
+
+	return TimingCurveLUT.Evaluate(BeatPhase);
 }
 
-float UUniversalBeatSubsystem::CheckBeatTimingInternal(FName LabelName, FGameplayTag InputTag)
+float UUniversalBeatSubsystem::CheckBeatTimingInternal(FName LabelName, FGameplayTag InputTag, double ClockTime)
 {
 	// T013: Internal timing check implementation with FPS warning
+	SCOPE_CYCLE_COUNTER(STAT_UniversalBeatCheckTiming);
+	++TimingStats.NumTimingChecks;
+	INC_DWORD_STAT(STAT_UniversalBeatTimingChecks);
 	
 	// Static flag for one-time low FPS warning
 	static bool bLowFPSWarningLogged = false;
@@ -498,8 +976,18 @@ float UUniversalBeatSubsystem::CheckBeatTimingInternal(FName LabelName, FGamepla
 		}
 	}
 	
-	// Get current beat phase (-1.0 to +1.0)
-	float BeatPhase = CalculateBeatPhase();
+	// Taps during calibration, or during play with passive calibration on, are offset samples too
+	if (IsCalibrating())
+	{
+		ProcessCalibrationInput(ClockTime);
+	}
+	else if (bPassiveCalibrationEnabled)
+	{
+		AddPassiveCalibrationSample(GetCalibrationSampleMs(ClockTime));
+	}
+
+	// Beat phase (-1.0 to +1.0) at the time of the input
+	float BeatPhase = BeatClock.GetBeatPhase(ClockTime);
 	
 	// Apply abs() to get curve input (0.0 to 1.0)
 	float CurveInput = FMath::Abs(BeatPhase);
@@ -507,8 +995,8 @@ float UUniversalBeatSubsystem::CheckBeatTimingInternal(FName LabelName, FGamepla
 	// Evaluate timing value via curve
 	float TimingValue = EvaluateTimingCurve(CurveInput);
 	
-	// Get current beat number for metadata
-	int32 BeatNumber = GetCurrentBeatNumber();
+	// Get beat number for metadata
+	int32 BeatNumber = BeatClock.GetBeatNumber(ClockTime);
 	
 	// Get timestamp
 	double CheckTimestamp = FPlatformTime::Seconds();
@@ -522,80 +1010,84 @@ float UUniversalBeatSubsystem::CheckBeatTimingInternal(FName LabelName, FGamepla
 	Result.BeatNumber = BeatNumber;
 	
 	// Broadcast event (Phase 5 - T026)
-	OnBeatInputCheck.Broadcast(SafeLabelName, InputTag, TimingValue);
+	EnqueueBeatEvent(FBeatEvent::MakeInputCheck(SafeLabelName, InputTag, TimingValue));
 	
 	// T026: Debug logging for timing check correlation
 	if (bDebugLoggingEnabled)
 	{
-		float TimerRemaining = GetWorld() ? GetWorld()->GetTimerManager().GetTimerRemaining(BeatBroadcastTimer) : 0.0f;
-		
-		UE_LOG(LogUniversalBeat, Verbose, TEXT("Timing Check [Label:%s] - Beat #%d (TimerRemaining: %.6f, BeatPhase: %.3f, TimingValue: %.3f)"), 
-			*SafeLabelName.ToString(), BeatNumber, TimerRemaining, BeatPhase, TimingValue);
+		UE_LOG(LogUniversalBeat, Verbose, TEXT("Timing Check [Label:%s] - Beat #%d (Tick: %lld, BeatPhase: %.3f, TimingValue: %.3f)"), 
+			*SafeLabelName.ToString(), BeatNumber, BeatClock.GetTick(ClockTime), BeatPhase, TimingValue);
 	
 	}
 	
 	return TimingValue;
 }
 
-void UUniversalBeatSubsystem::BroadcastBeatEvent()
+void UUniversalBeatSubsystem::AdvanceBeatTicks()
 {
-	// T014: Beat broadcasting callback with BPM queuing and subdivision filtering
-	
-	// Increment tick counter
-	CurrentBeatTick++;
-	
-	if (CurrentTrackInfo.TrackSequence != nullptr)
+	SCOPE_CYCLE_COUNTER(STAT_UniversalBeatBroadcastBeat);
+
+	if (!BeatClock.IsStarted())
 	{
-		
-		if (IsValid(SongPlayerActor))
+		return;
+	}
+
+	// Several ticks can fall into one frame at high BPM; each is delivered, at its own time
+	const double Now = GetBeatClockTime();
+	const double Horizon = Now + BeatEventLookaheadSeconds;
+	int64 LastTick = BeatClock.GetTick(Horizon);
+	if (LastTick - CurrentBeatTick > MaxBeatTicksPerFrame)
+	{
+		// A long hitch (or the clock domain moved): only the most recent ticks are still useful
+		if (bDebugLoggingEnabled)
 		{
-			ULevelSequencePlayer* Player = SongPlayerActor->GetSequencePlayer();
-			if (SongPlayerActor->LevelSequenceAsset != nullptr)
-			{
-				CurrentTrackInfo.TrackSequence.LoadSynchronous();
-				FFrameTime CurrentFrame = Player->GetCurrentTime().ConvertTo(FFrameRate(30, 1)).GetFrame();
-				FFrameTime NextFrame = CurrentFrame + FFrameTime(1);
-				FFrameTime EndFrame = Player->GetEndTime().ConvertTo(FFrameRate(30, 1)).GetFrame();
-				FMovieSceneSequencePlaybackSettings PlaybackSettings = SongPlayerActor->PlaybackSettings;
-				int LoopCount = PlaybackSettings.LoopCount.Value;
-				if (NextFrame >= EndFrame) {
-					NextFrame = Player->GetStartTime().ConvertTo(FFrameRate(30, 1)).GetFrame();
-					if (LoopCount > 0) {
-						SongPlayerActor->PlaybackSettings.LoopCount.Value = LoopCount - 1;
-					}
-					else {
-						Player->OnFinished.Broadcast();
-					}
-				}
-				else {
-					FMovieSceneSequencePlaybackParams PlaybackParams = FMovieSceneSequencePlaybackParams(NextFrame, EUpdatePositionMethod::Play);
-					Player->SetPlaybackPosition(PlaybackParams);
-					//Player->PlayTo(PlaybackParams, FMovieSceneSequencePlayToParams());
-				}
-			}
+			UE_LOG(LogUniversalBeat, Verbose, TEXT("AdvanceBeatTicks: Skipped %lld ticks"), LastTick - CurrentBeatTick - MaxBeatTicksPerFrame);
 		}
+		CurrentBeatTick = LastTick - MaxBeatTicksPerFrame;
 	}
 
-	// Check for pending BPM change at whole beat boundary (every InternalSubdivision = 16 ticks)
-	if (PendingBPM > 0.0f && (CurrentBeatTick % InternalSubdivision == 0))
+	while (CurrentBeatTick < LastTick)
 	{
-		if (bDebugLoggingEnabled)
+		const int64 Tick = CurrentBeatTick + 1;
+		const double IdealTickTime = BeatClock.GetTickTime(Tick);
+
+		// Check for pending BPM change at whole beat boundary (every TicksPerBeat = 16 ticks)
+		if (PendingBPM > 0.0f && (Tick % MusicalTiming::TicksPerBeat == 0))
 		{
-			UE_LOG(LogUniversalBeat, Log, TEXT("Applying queued BPM change: %.2f -> %.2f at tick %d"),
-				CurrentBPM, PendingBPM, CurrentBeatTick);
+			if (IdealTickTime > Now)
+			{
+				// Ticks past the change are not known yet: the lookahead waits for it
+				break;
+			}
+
+			if (bDebugLoggingEnabled)
+			{
+				UE_LOG(LogUniversalBeat, Log, TEXT("Applying queued BPM change: %.2f -> %.2f at tick %lld"),
+					CurrentBPM, PendingBPM, Tick);
+			}
+
+			// Switch at the exact beat: its time is unchanged, the ticks after it are spaced at the new rate
+			ApplyTempoChange(PendingBPM, IdealTickTime);
+			LastTick = BeatClock.GetTick(Horizon);
 		}
-		
-		// Apply pending BPM
-		CurrentBPM = PendingBPM;
-		PendingBPM = 0.0f;
-		OnBPMChanged.Broadcast(CurrentBPM);
-		// Recreate timer with new rate
-		RecreateTimerWithNewRate();
-		
-		// Return early - timer recreation will restart callbacks
-		return;
+
+		CurrentBeatTick = Tick;
+		BroadcastBeatEvent(Tick, IdealTickTime, Now);
 	}
-	
+}
+
+void UUniversalBeatSubsystem::BroadcastBeatEvent(int64 Tick, double IdealTickTime, double Now)
+{
+	// Delivery time relative to the ideal tick time: frame quantization, negative within the lookahead
+	const float JitterMs = static_cast<float>((Now - IdealTickTime) * 1000.0);
+	TimingStats.TickJitter.Record(JitterMs);
+	++TimingStats.NumBeatTicks;
+	INC_DWORD_STAT(STAT_UniversalBeatTicks);
+	SET_FLOAT_STAT(STAT_UniversalBeatTickJitter, JitterMs);
+	UniversalBeatTrace::OutputBeatTick(static_cast<int32>(Tick), IdealTickTime, JitterMs);
+
+	// Chart playback advances from Tick on the beat clock, not per beat tick
+
 	// Check if broadcasting is enabled
 	if (!bBeatBroadcastingEnabled)
 	{
@@ -603,56 +1095,176 @@ void UUniversalBeatSubsystem::BroadcastBeatEvent()
 	}
 	
 	// Get ticks per broadcast for current subdivision
-	int32 TicksPerBroadcast = UUniversalBeatFunctionLibrary::GetTicksForSubdivision(CurrentSubdivision);
+	const int32 TicksPerBroadcast = MusicalTiming::GetSubdivisionTicks(CurrentSubdivision);
 	
 	// Check if we should broadcast on this tick
-	if (TicksPerBroadcast > 0 && (CurrentBeatTick % TicksPerBroadcast == 0))
+	if (TicksPerBroadcast > 0 && (Tick % TicksPerBroadcast == 0))
 	{
 		// Calculate subdivision index relative to CurrentSubdivision for event data. It should count from 0 to 7 if CurrentSubdivision is 8th beat and so on
 		// Use modulo to cycle the index within each beat (e.g., 0-7 for eighth notes, 0-3 for quarter notes)
-		int32 SubdivisionsPerBeat = InternalSubdivision / TicksPerBroadcast;
-		int32 SubdivisionIndex = (CurrentBeatTick / TicksPerBroadcast) % SubdivisionsPerBeat;
-		// Get current beat phase and number
-		float CurrentPhase = GetCurrentBeatPhase();
-		int32 CurrentBeatNum = GetCurrentBeatNumber();
+		const int32 SubdivisionsPerBeat = MusicalTiming::GetSubdivisionsPerBeat(CurrentSubdivision);
+		int32 SubdivisionIndex = static_cast<int32>((Tick / TicksPerBroadcast) % SubdivisionsPerBeat);
 		
-		// Create event data
+		// Create event data from the tick itself, not from the frame it is delivered on
 		FBeatEventData EventData;
-		EventData.BeatNumber = CurrentBeatNum;
+		EventData.BeatNumber = static_cast<int32>(FMath::FloorToInt64(static_cast<double>(Tick) / MusicalTiming::TicksPerBeat));
 		EventData.SubdivisionIndex = SubdivisionIndex;
 		EventData.SubdivisionType = CurrentSubdivision;
-		EventData.EventTimestamp = FPlatformTime::Seconds();
+		EventData.BeatClockTime = IdealTickTime;
+		EventData.EventTimestamp = BeatClockTimeToPlatformTime(IdealTickTime);
+		EventData.TimeUntil = static_cast<float>(IdealTickTime - Now);
 		
-		// Broadcast event
-		OnBeat.Broadcast(EventData);
+		// Queue event (delivered at the end of this frame's Tick)
+		EnqueueBeatEvent(FBeatEvent::MakeBeat(EventData));
 		
 		// T026: Debug logging for synchronization validation
 		if (bDebugLoggingEnabled)
 		{
-			float TimerRemaining = GetWorld() ? GetWorld()->GetTimerManager().GetTimerRemaining(BeatBroadcastTimer) : 0.0f;
-			UE_LOG(LogUniversalBeat, Verbose, TEXT("Beat #%d fired (TimerRemaining: %.6f, BeatPhase: %.3f, Tick: %d, Subdivision: %d)"), 
-				CurrentBeatNum, TimerRemaining, CurrentPhase, CurrentBeatTick, (int32)CurrentSubdivision);
+			UE_LOG(LogUniversalBeat, Verbose, TEXT("Beat #%d delivered (TimeUntil: %.6f, Tick: %lld, Subdivision: %d)"), 
+				EventData.BeatNumber, EventData.TimeUntil, Tick, (int32)CurrentSubdivision);
+		}
+	}
+}
+
+double UUniversalBeatSubsystem::BeatClockTimeToPlatformTime(double ClockTime) const
+{
+	// Inverse of PlatformTimeToBeatClockTime: how far from now, converted out of the clock's domain
+	double Delta = ClockTime - GetBeatClockTime();
+	if (!TimingSource && bRespectTimeDilation)
+	{
+		if (const UWorld* World = GetWorld())
+		{
+			if (const AWorldSettings* WorldSettings = World->GetWorldSettings())
+			{
+				const float Dilation = WorldSettings->GetEffectiveTimeDilation();
+				Delta = Dilation > 0.0f ? Delta / Dilation : 0.0;
+			}
+		}
+	}
+	return FPlatformTime::Seconds() + Delta;
+}
+
+void UUniversalBeatSubsystem::DispatchBeatEvents()
+{
+	SCOPE_CYCLE_COUNTER(STAT_UniversalBeatDispatchEvents);
+
+	DispatchedBeatEvents.Reset();
+	FBeatEvent Event;
+	while (PendingBeatEvents.Dequeue(Event))
+	{
+		DispatchedBeatEvents.Add(Event);
+	}
+	if (DispatchedBeatEvents.Num() == 0)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT_BY(STAT_UniversalBeatEventsDispatched, DispatchedBeatEvents.Num());
+
+	// Events raised by listeners below are queued for the next frame
+	BeatEventBatchNative.Broadcast(DispatchedBeatEvents);
+
+	const bool bNativeBound = BeatEventNative.IsBound();
+	const bool bBatchMisses = OnNotesMissed.IsBound();
+	MissedNoteInstances.Reset();
+	for (const FBeatEvent& DispatchedEvent : DispatchedBeatEvents)
+	{
+		if (bNativeBound)
+		{
+			BeatEventNative.Broadcast(DispatchedEvent);
+		}
+
+		// Blueprint adapter: reflection calls only for events somebody listens to
+		switch (DispatchedEvent.Type)
+		{
+		case EBeatEventType::Beat:
+			if (OnBeat.IsBound())
+			{
+				OnBeat.Broadcast(DispatchedEvent.ToBeatEventData());
+			}
+			break;
+		case EBeatEventType::Note:
+			if (OnNoteBeat.IsBound())
+			{
+				OnNoteBeat.Broadcast(DispatchedEvent.ToNoteInstance());
+			}
+			break;
+		case EBeatEventType::InputCheck:
+			if (OnBeatInputCheck.IsBound())
+			{
+				OnBeatInputCheck.Broadcast(DispatchedEvent.Label, DispatchedEvent.Tag, DispatchedEvent.Value);
+			}
+			break;
+		case EBeatEventType::BPMChanged:
+			if (OnBPMChanged.IsBound())
+			{
+				OnBPMChanged.Broadcast(static_cast<int32>(DispatchedEvent.Value));
+			}
+			break;
+		case EBeatEventType::NoteApproach:
+			if (OnNoteApproach.IsBound())
+			{
+				OnNoteApproach.Broadcast(DispatchedEvent.ToNoteInstance(), DispatchedEvent.Value);
+			}
+			break;
+		case EBeatEventType::NoteMissed:
+			if (OnNoteMissed.IsBound())
+			{
+				OnNoteMissed.Broadcast(DispatchedEvent.ToNoteInstance());
+			}
+			if (bBatchMisses)
+			{
+				MissedNoteInstances.Add(DispatchedEvent.ToNoteInstance());
+			}
+			break;
+		case EBeatEventType::HoldCompleted:
+			if (OnNoteHoldCompleted.IsBound())
+			{
+				OnNoteHoldCompleted.Broadcast(DispatchedEvent.ToNoteInstance(), DispatchedEvent.Value);
+			}
+			break;
 		}
 	}
+
+	if (MissedNoteInstances.Num() > 0)
+	{
+		OnNotesMissed.Broadcast(MissedNoteInstances);
+	}
 }
 
 void UUniversalBeatSubsystem::PresentCalibrationPrompt()
 {
-	// T032: Present a calibration prompt (to be called by timer)
+	// T032: Present a calibration prompt (called by timer once per beat)
 	// Game-specific implementation would trigger UI/audio cue here
-	UE_LOG(LogUniversalBeat, Log, TEXT("Calibration prompt %d/%d"), 
-		(CalibrationTotalPrompts - CalibrationPromptsRemaining + 1), CalibrationTotalPrompts);
+	if (--CalibrationPromptsRemaining < 0)
+	{
+		// Out of beats without enough taps: finish with whatever was collected
+		CompleteCalibrationSequence();
+		return;
+	}
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("Calibration prompt - %d/%d taps"), 
+			CalibrationEstimator.Num(), CalibrationTotalPrompts);
+	}
 }
 
-void UUniversalBeatSubsystem::ProcessCalibrationInput(float TimingValue)
+void UUniversalBeatSubsystem::ProcessCalibrationInput(double ClockTime)
 {
-	// T032: Process player input during calibration
-	// This would be called from game code when player responds to prompt
-	// Calculate offset based on timing value and expected beat time
-	CalibrationOffsets.Add(TimingValue);
-	CalibrationPromptsRemaining--;
-	
-	if (CalibrationPromptsRemaining <= 0)
+	// T032: One calibration tap, judged by its own timestamp rather than by the prompt it answers
+	const float SampleMs = GetCalibrationSampleMs(ClockTime);
+	const bool bAccepted = CalibrationEstimator.AddSample(SampleMs);
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("Calibration tap %.2fms %s - Estimate:%.2fms +/-%.2fms"),
+			SampleMs, bAccepted ? TEXT("accepted") : TEXT("rejected"),
+			CalibrationEstimator.GetEstimateMs(), CalibrationEstimator.GetStandardErrorMs());
+	}
+
+	const int32 NumTaps = CalibrationEstimator.Num() + CalibrationEstimator.GetNumRejected();
+	if (CalibrationEstimator.IsConverged(MinCalibrationSamples, CalibrationTargetErrorMs) || NumTaps >= CalibrationTotalPrompts)
 	{
 		CompleteCalibrationSequence();
 	}
@@ -660,35 +1272,57 @@ void UUniversalBeatSubsystem::ProcessCalibrationInput(float TimingValue)
 
 void UUniversalBeatSubsystem::CompleteCalibrationSequence()
 {
-	// T032: Calculate final calibration offset and broadcast result
-	float CalculatedOffset = 0.0f;
-	bool bSuccess = false;
-	
-	if (CalibrationOffsets.Num() > 0)
+	// T032: Report the robust estimate; too few agreeing taps is a failure
+	const bool bSuccess = CalibrationEstimator.Num() >= MinCalibrationSamples;
+	const float CalculatedOffset = bSuccess
+		? FMath::Clamp(CalibrationEstimator.GetEstimateMs(), -200.0f, 200.0f)
+		: CalibrationOffsetMs;
+
+	if (UWorld* World = GetWorld())
 	{
-		// Calculate average offset from collected data
-		float Sum = 0.0f;
-		for (float Offset : CalibrationOffsets)
-		{
-			Sum += Offset;
-		}
-		CalculatedOffset = Sum / CalibrationOffsets.Num();
-		bSuccess = true;
+		World->GetTimerManager().ClearTimer(CalibrationTimer);
 	}
+
+	UE_LOG(LogUniversalBeat, Log, TEXT("Calibration complete - Offset:%.2fms +/-%.2fms from %d taps (%d rejected) Success:%s"), 
+		CalculatedOffset, bSuccess ? CalibrationEstimator.GetStandardErrorMs() : 0.0f,
+		CalibrationEstimator.Num(), CalibrationEstimator.GetNumRejected(), bSuccess ? TEXT("true") : TEXT("false"));
 	
-	// Broadcast completion event
+	// Reset calibration state before broadcasting, so listeners can start another sequence
+	CalibrationEstimator.Reset();
+	CalibrationPromptsRemaining = 0;
+	CalibrationTotalPrompts = 0;
+
 	OnCalibrationComplete.Broadcast(CalculatedOffset, bSuccess);
-	
-	if (bDebugLoggingEnabled)
+}
+
+void UUniversalBeatSubsystem::AddPassiveCalibrationSample(float OffsetMs)
+{
+	if (!PassiveCalibrationEstimator.AddSample(OffsetMs) || !bPassiveCalibrationAutoApply)
 	{
-		UE_LOG(LogUniversalBeat, Log, TEXT("Calibration complete - Offset:%.2fms Success:%s"), 
-			CalculatedOffset, bSuccess ? TEXT("true") : TEXT("false"));
+		return;
 	}
-	
-	// Reset calibration state
-	CalibrationOffsets.Empty();
-	CalibrationPromptsRemaining = 0;
-	CalibrationTotalPrompts = 0;
+
+	if (!PassiveCalibrationEstimator.IsConverged(MinPassiveCalibrationSamples, CalibrationTargetErrorMs))
+	{
+		return;
+	}
+
+	const float EstimateMs = PassiveCalibrationEstimator.GetEstimateMs();
+	if (FMath::Abs(EstimateMs - CalibrationOffsetMs) > PassiveCalibrationApplyThresholdMs)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("Passive calibration: offset %.2fms -> %.2fms (+/-%.2fms, %d samples)"),
+			CalibrationOffsetMs, EstimateMs, PassiveCalibrationEstimator.GetStandardErrorMs(), PassiveCalibrationEstimator.Num());
+		SetCalibrationOffset(EstimateMs);
+		OnCalibrationComplete.Broadcast(CalibrationOffsetMs, true);
+	}
+}
+
+float UUniversalBeatSubsystem::GetCalibrationSampleMs(double ClockTime) const
+{
+	// The beat clock already subtracts the current offset: add it back for the raw lateness
+	const double BeatPosition = BeatClock.GetBeatPosition(ClockTime);
+	const double LatenessSeconds = (BeatPosition - FMath::RoundToDouble(BeatPosition)) * BeatClock.GetSecondsPerBeat();
+	return static_cast<float>(LatenessSeconds * 1000.0) + CalibrationOffsetMs;
 }
 
 bool UUniversalBeatSubsystem::IsPausedState() const
@@ -707,20 +1341,61 @@ bool UUniversalBeatSubsystem::IsPausedState() const
 
 FNoteValidationResult UUniversalBeatSubsystem::CheckBeatTimingByTag(FGameplayTag InputTag)
 {
+	return CheckNoteInputAtTime(InputTag, FPlatformTime::Seconds(), false);
+}
+
+FNoteValidationResult UUniversalBeatSubsystem::CheckBeatTimingByTagAtTime(FGameplayTag InputTag, double InputPlatformTime)
+{
+	RecordInputLatency(InputPlatformTime);
+	return CheckNoteInputAtTime(InputTag, InputPlatformTime, false);
+}
+
+FNoteValidationResult UUniversalBeatSubsystem::CheckBeatReleaseByTag(FGameplayTag InputTag)
+{
+	return CheckNoteInputAtTime(InputTag, FPlatformTime::Seconds(), true);
+}
+
+FNoteValidationResult UUniversalBeatSubsystem::CheckBeatReleaseByTagAtTime(FGameplayTag InputTag, double InputPlatformTime)
+{
+	RecordInputLatency(InputPlatformTime);
+	return CheckNoteInputAtTime(InputTag, InputPlatformTime, true);
+}
+
+void UUniversalBeatSubsystem::RecordInputLatency(double InputPlatformTime)
+{
+	const float LatencyMs = static_cast<float>((FPlatformTime::Seconds() - InputPlatformTime) * 1000.0);
+	TimingStats.InputLatency.Record(LatencyMs);
+	UniversalBeatTrace::OutputInputLatency(LatencyMs);
+}
+
+FNoteValidationResult UUniversalBeatSubsystem::CheckNoteInputAtTime(FGameplayTag InputTag, double InputPlatformTime, bool bRelease)
+{
+	SCOPE_CYCLE_COUNTER(STAT_UniversalBeatCheckTiming);
+
 	// T070: Full validation implementation with note chart integration
+	const double ClockTime = PlatformTimeToBeatClockTime(InputPlatformTime);
+
 	FNoteValidationResult Result;
 	Result.bHit = false;
 	Result.NoteTag = InputTag;
-	Result.InputTimestamp = FPlatformTime::Seconds();
+	Result.InputTimestamp = InputPlatformTime;
 	Result.Accuracy = 0.0f;
 	Result.TimingDirection = ENoteTimingDirection::OnTime;
 	Result.TimingOffset = 0.0f;
 	
 	// Check if we have loaded notes and a valid input tag
-	if (CachedNotesSorted.Num() == 0 || !InputTag.IsValid())
+	if (!NoteChart || NoteChart->IsEmpty() || !InputTag.IsValid())
 	{
+		// Releases have no beat to fall back to
+		if (bRelease)
+		{
+			return Result;
+		}
+
+		ReplayRecorder.RecordBeatCheck(InputTag.GetTagName(), ClockTime);
+
 		// T073: Fallback to standard beat timing when no note chart loaded
-		Result.Accuracy = CheckBeatTimingInternal(NAME_None, InputTag);
+		Result.Accuracy = CheckBeatTimingInternal(NAME_None, InputTag, ClockTime);
 		Result.TimingOffset = 0.0f; // Standard timing doesn't provide offset
 		
 		if (bDebugLoggingEnabled)
@@ -732,84 +1407,166 @@ FNoteValidationResult UUniversalBeatSubsystem::CheckBeatTimingByTag(FGameplayTag
 		return Result;
 	}
 	
-	// T074: Query for next note with matching tag
-	FNoteInstance FoundNote;
-	float CurrentTime = GetCurrentPlaybackTime();
+	// T074: Query for next note with matching tag, at the chart time the input happened
+	const double ChartTime = bChartPlaybackActive
+		? GetChartTimeAt(ClockTime)
+		: GetCurrentPlaybackTime() - (GetBeatClockTime() - ClockTime);
+	ReplayRecorder.RecordInput(InputTag, ChartTime, bRelease);
+	JudgeNoteInput(InputTag, ChartTime, Result, bRelease);
 	
-	if (!GetNextNoteForTag(InputTag, CurrentTime, FoundNote))
+	return Result;
+}
+
+void UUniversalBeatSubsystem::JudgeNoteInput(FGameplayTag InputTag, double ChartTime, FNoteValidationResult& OutResult, bool bRelease)
+{
+	SCOPE_CYCLE_COUNTER(STAT_UniversalBeatJudgeNote);
+
+	const FNoteJudgement Judgement = bRelease
+		? NoteJudgement::JudgeRelease(*NoteChart, JudgementState, InputTag, ChartTime)
+		: NoteJudgement::JudgeInput(*NoteChart, JudgementState, InputTag, ChartTime);
+
+	++TimingStats.NumTimingChecks;
+	INC_DWORD_STAT(STAT_UniversalBeatTimingChecks);
+	if (Judgement.IsHit() && !Judgement.bHoldEnd)
 	{
-		// No note found within timing window for this tag
-		Result.bHit = false;
-		Result.Accuracy = 0.0f;
-		Result.TimingDirection = ENoteTimingDirection::Late; // Assume late if no note found
-		
-		if (bDebugLoggingEnabled)
+		++TimingStats.NumNoteHits;
+		INC_DWORD_STAT(STAT_UniversalBeatNoteHits);
+		TimingStats.JudgementOffset.Record(Judgement.TimingOffset * 1000.0f);
+
+		// Note timing ignores the calibration offset, so the hit offset is the player's raw lateness
+		if (bPassiveCalibrationEnabled)
 		{
-			UE_LOG(LogUniversalBeat, Log, TEXT("CheckBeatTimingByTag: No note found for tag '%s' at time %.3f (Miss)"), 
-				*InputTag.ToString(), CurrentTime);
+			AddPassiveCalibrationSample(Judgement.TimingOffset * 1000.0f);
 		}
-		
-		return Result;
 	}
+	UniversalBeatTrace::OutputJudgement(GetTypeHash(InputTag), Judgement.IsHit(), Judgement.TimingOffset * 1000.0f);
 	
 	// T075: Populate validation result with note data
-	Result.NoteTag = FoundNote.NoteData->GetNoteTag();
-	Result.NoteData = FoundNote.NoteData;
-	Result.NoteTimestamp = FrameToSeconds(FoundNote.Timestamp);
-	
-	// T072: Calculate timing offset and direction
-	Result.TimingOffset = CurrentTime - Result.NoteTimestamp;
+	NoteJudgement::FillValidationResult(*NoteChart, Judgement, OutResult);
 	
-	if (FMath::Abs(Result.TimingOffset) < 0.001f) // Within 1ms = perfect
+	if (Judgement.NoteIndex == INDEX_NONE)
 	{
-		Result.TimingDirection = ENoteTimingDirection::OnTime;
-	}
-	else if (Result.TimingOffset < 0.0f)
-	{
-		Result.TimingDirection = ENoteTimingDirection::Early;
+		// No note found within timing window for this tag
+		if (bDebugLoggingEnabled)
+		{
+			UE_LOG(LogUniversalBeat, Log, TEXT("JudgeNoteInput: No note found for tag '%s' at time %.3f (Miss)"), 
+				*InputTag.ToString(), ChartTime);
+		}
+		
+		return;
 	}
-	else
+	
+	if (Judgement.bHoldEnd && Judgement.IsHit())
 	{
-		Result.TimingDirection = ENoteTimingDirection::Late;
+		EnqueueHoldCompleted(*NoteChart, Judgement);
 	}
 	
-	// T071: Calculate accuracy (1.0 = perfect, 0.0 = edge of timing window)
-	// Get timing windows from note data asset
-	float PreTimingSeconds = UUniversalBeatFunctionLibrary::ConvertMusicalNoteToSeconds(
-		FoundNote.NoteData->GetPreTiming(), CurrentBPM);
-	float PostTimingSeconds = UUniversalBeatFunctionLibrary::ConvertMusicalNoteToSeconds(
-		FoundNote.NoteData->GetPostTiming(), CurrentBPM);
-	
-	// Maximum acceptable timing difference is the appropriate window based on direction
-	float MaxTimingWindow = (Result.TimingOffset < 0.0f) ? PreTimingSeconds : PostTimingSeconds;
-	
-	// Accuracy = 1.0 - (|offset| / max_window), clamped to [0, 1]
-	Result.Accuracy = FMath::Clamp(1.0f - (FMath::Abs(Result.TimingOffset) / MaxTimingWindow), 0.0f, 1.0f);
-	Result.bHit = true;
-	
-	// T074: Mark note as consumed to prevent re-validation
-	MarkNoteConsumed(FoundNote);
-	
 	// T076: Log validation event for debugging
 	if (bDebugLoggingEnabled)
 	{
-		UE_LOG(LogUniversalBeat, Log, TEXT("CheckBeatTimingByTag: HIT - Tag=%s, Accuracy=%.3f, Offset=%.4fs, Direction=%s"), 
+		if (Judgement.bHoldEnd)
+		{
+			UE_LOG(LogUniversalBeat, Log, TEXT("JudgeNoteInput: HOLD %s - Tag=%s, Ticks=%d, Sustain=%.3f, Offset=%.4fs"),
+				Judgement.IsHit() ? TEXT("COMPLETE") : TEXT("DROPPED"),
+				*InputTag.ToString(),
+				OutResult.SustainTicks,
+				OutResult.SustainRatio,
+				OutResult.TimingOffset);
+			return;
+		}
+
+		UE_LOG(LogUniversalBeat, Log, TEXT("JudgeNoteInput: HIT - Tag=%s, Accuracy=%.3f, Offset=%.4fs, Direction=%s"), 
 			*InputTag.ToString(), 
-			Result.Accuracy, 
-			Result.TimingOffset,
-			Result.TimingDirection == ENoteTimingDirection::Early ? TEXT("Early") : 
-			Result.TimingDirection == ENoteTimingDirection::OnTime ? TEXT("OnTime") : TEXT("Late"));
+			OutResult.Accuracy, 
+			OutResult.TimingOffset,
+			OutResult.TimingDirection == ENoteTimingDirection::Early ? TEXT("Early") : 
+			OutResult.TimingDirection == ENoteTimingDirection::OnTime ? TEXT("OnTime") : TEXT("Late"));
 	}
-	
-	return Result;
 }
 
-bool UUniversalBeatSubsystem::RegisterSong(USongConfiguration* SongConfig)
+void UUniversalBeatSubsystem::EnqueueHoldCompleted(const FCompiledNoteChart& Chart, const FNoteJudgement& Judgement)
 {
-	// TODO: Implement in Phase 8 (User Story 6)
-	if (!SongConfig || !SongConfig->GetSongTag().IsValid())
-	{
-		UE_LOG(LogUniversalBeat, Warning, TEXT("RegisterSong: Invalid song configuration"));
+	FBeatEvent Event = FBeatEvent::MakeNote(Chart.MakeNoteInstance(Judgement.NoteIndex), Chart.GetNoteTag(Judgement.NoteIndex), Judgement.NoteIndex, EBeatEventType::HoldCompleted);
+	Event.Value = Judgement.Accuracy;
+	EnqueueBeatEvent(Event);
+}
+
+int32 UUniversalBeatSubsystem::CheckBeatTimingBatch(TConstArrayView<FBeatInputEvent> Inputs, TArray<FNoteValidationResult>& OutResults)
+{
+	SCOPE_CYCLE_COUNTER(STAT_UniversalBeatCheckTiming);
+
+	// Reuses the caller's allocation once it has grown to the largest batch
+	OutResults.Reset(Inputs.Num());
+	OutResults.AddDefaulted(Inputs.Num());
+
+	if (Inputs.Num() == 0)
+	{
+		return 0;
+	}
+
+	int32 NumHits = 0;
+	if (!NoteChart || NoteChart->IsEmpty())
+	{
+		// T073: Same fallback as CheckBeatTimingByTag, with each input's phase taken at its own timestamp
+		for (int32 InputIndex = 0; InputIndex < Inputs.Num(); ++InputIndex)
+		{
+			const FBeatInputEvent& Input = Inputs[InputIndex];
+			const double ClockTime = ChartTimeToBeatClockTime(Input.Timestamp);
+			ReplayRecorder.RecordBeatCheck(Input.InputTag.GetTagName(), ClockTime);
+			FNoteValidationResult& Result = OutResults[InputIndex];
+			Result.NoteTag = Input.InputTag;
+			Result.InputTimestamp = Input.Timestamp;
+			Result.Accuracy = EvaluateTimingCurve(FMath::Abs(BeatClock.GetBeatPhase(ClockTime)));
+		}
+	}
+	else
+	{
+		// Judge in time order, so when two presses compete for a note the one that happened first
+		// takes it, as it would have live
+		TArray<int32, TInlineAllocator<64>> Order;
+		Order.SetNumUninitialized(Inputs.Num());
+		bool bSorted = true;
+		for (int32 InputIndex = 0; InputIndex < Inputs.Num(); ++InputIndex)
+		{
+			Order[InputIndex] = InputIndex;
+			bSorted &= InputIndex == 0 || Inputs[InputIndex - 1].Timestamp <= Inputs[InputIndex].Timestamp;
+		}
+		if (!bSorted)
+		{
+			Algo::StableSortBy(Order, [&Inputs](int32 InputIndex) { return Inputs[InputIndex].Timestamp; });
+		}
+
+		for (const int32 InputIndex : Order)
+		{
+			const FBeatInputEvent& Input = Inputs[InputIndex];
+			FNoteValidationResult& Result = OutResults[InputIndex];
+			Result.NoteTag = Input.InputTag;
+			Result.InputTimestamp = Input.Timestamp;
+			if (Input.InputTag.IsValid())
+			{
+				ReplayRecorder.RecordInput(Input.InputTag, Input.Timestamp, Input.bIsRelease);
+				JudgeNoteInput(Input.InputTag, Input.Timestamp, Result, Input.bIsRelease);
+			}
+			NumHits += Result.bHit ? 1 : 0;
+		}
+	}
+
+	OnBeatInputBatchCheck.Broadcast(OutResults, NumHits);
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("CheckBeatTimingBatch: %d inputs, %d hits"), Inputs.Num(), NumHits);
+	}
+
+	return NumHits;
+}
+
+bool UUniversalBeatSubsystem::RegisterSong(USongConfiguration* SongConfig)
+{
+	// TODO: Implement in Phase 8 (User Story 6)
+	if (!SongConfig || !SongConfig->GetSongTag().IsValid())
+	{
+		UE_LOG(LogUniversalBeat, Warning, TEXT("RegisterSong: Invalid song configuration"));
 		return false;
 	}
 	
@@ -893,15 +1650,67 @@ bool UUniversalBeatSubsystem::PlaySongByTag(FGameplayTag SongTag, bool bQueue)
 	{
 		PlaySong();
 	}
+	else if (QueuedTracks.IsEmpty() && !PreparedTrack.bReady && ActiveSongTracks.Num() == 0)
+	{
+		// Queued during the last track of the current song: pre-roll it for a gapless start
+		PrefetchNextTrack();
+	}
 	
 	return true;
 }
 
 bool UUniversalBeatSubsystem::PlaySongByAsset(TSoftObjectPtr<USongConfiguration> SongAsset, bool bQueue)
 {
-	// Load the asset synchronously if it's a soft reference
-	USongConfiguration* LoadedSong = SongAsset.LoadSynchronous();
-	
+	if (SongAsset.IsNull())
+	{
+		UE_LOG(LogUniversalBeat, Warning, TEXT("PlaySongByAsset: Invalid song asset reference"));
+		return false;
+	}
+
+	// Already resident: no load needed
+	if (USongConfiguration* LoadedSong = SongAsset.Get())
+	{
+		return PlayLoadedSongAsset(LoadedSong, bQueue);
+	}
+
+	// Stream the song configuration without blocking the game thread
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		SongAsset.ToSoftObjectPath(),
+		FStreamableDelegate::CreateWeakLambda(this, [this, SongAsset, bQueue]()
+		{
+			SongLoadHandles.RemoveAll([](const TSharedPtr<FStreamableHandle>& Handle) { return !Handle.IsValid() || Handle->HasLoadCompleted(); });
+
+			USongConfiguration* LoadedSong = SongAsset.Get();
+			if (!LoadedSong)
+			{
+				UE_LOG(LogUniversalBeat, Warning, TEXT("PlaySongByAsset: Failed to load song asset '%s'"), *SongAsset.ToString());
+				return;
+			}
+			PlayLoadedSongAsset(LoadedSong, bQueue);
+		}),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	if (!Handle.IsValid())
+	{
+		UE_LOG(LogUniversalBeat, Warning, TEXT("PlaySongByAsset: Failed to request load of '%s'"), *SongAsset.ToString());
+		return false;
+	}
+
+	if (!Handle->HasLoadCompleted())
+	{
+		SongLoadHandles.Add(Handle);
+	}
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("PlaySongByAsset: Streaming song asset '%s'"), *SongAsset.ToString());
+	}
+
+	return true;
+}
+
+bool UUniversalBeatSubsystem::PlayLoadedSongAsset(USongConfiguration* LoadedSong, bool bQueue)
+{
 	if (!LoadedSong)
 	{
 		UE_LOG(LogUniversalBeat, Warning, TEXT("PlaySongByAsset: Failed to load song asset"));
@@ -976,6 +1785,7 @@ void UUniversalBeatSubsystem::PlaySong()
 	}
 	
 	CurrentlyPlayingSong = NextSong;
+	bCurrentSongReady = false;
 	
 	// Broadcast OnSongStarted event with the song configuration
 	OnSongStarted.Broadcast();
@@ -1000,6 +1810,12 @@ void UUniversalBeatSubsystem::PlaySong()
 	
 	// Clear track queue and enqueue all tracks from this song
 	QueuedTracks.Empty();
+
+	if (CurrentlyPlayingSong->bPlayTracksConcurrently)
+	{
+		PlayConcurrentTracks();
+		return;
+	}
 	
 	for (const FNoteTrackEntry& Track : Tracks)
 	{
@@ -1036,13 +1852,13 @@ bool UUniversalBeatSubsystem::IsPlayingSong() const
 
 void UUniversalBeatSubsystem::CleanupSongPlayback()
 {
-	// Stop SongPlayer if playing
-	ULevelSequencePlayer* Player = GetSongPlayer();
-	if (Player && Player->IsPlaying())
-	{
-		Player->Stop();
-	}
+	// Stop SongPlayer and the pooled track players if playing (they stay spawned for the next song)
+	StopSongPlayers();
 	
+	StopChartPlayback();
+	ActiveSongTracks.Reset();
+	ResetPreparedTrack();
+
 	// Clear delay timer
 	if (UWorld* World = GetWorld())
 	{
@@ -1053,6 +1869,20 @@ void UUniversalBeatSubsystem::CleanupSongPlayback()
 		}
 	}
 	
+	// Cancel in-flight track streaming (prefetch of the next song's track is dropped too)
+	if (TrackLoadHandle.IsValid())
+	{
+		TrackLoadHandle->CancelHandle();
+		TrackLoadHandle.Reset();
+	}
+	if (TrackPrefetchHandle.IsValid())
+	{
+		TrackPrefetchHandle->CancelHandle();
+		TrackPrefetchHandle.Reset();
+	}
+	++TrackLoadSerial;
+	bCurrentSongReady = false;
+
 	// Clear track queue
 	QueuedTracks.Empty();
 
@@ -1080,15 +1910,66 @@ void UUniversalBeatSubsystem::PlayTrack()
 		return;
 	}
 	
-	// Validate track sequence
-	ULevelSequence* TrackSequence = CurrentTrackInfo.TrackSequence.LoadSynchronous();
-	if (!TrackSequence)
+	if (CurrentTrackInfo.TrackSequence.IsNull())
+	{
+		UE_LOG(LogUniversalBeat, Error, TEXT("PlayTrack: Track has no sequence assigned"));
+		// Try next track
+		PlayTrack();
+		return;
+	}
+
+	// Stream the sequence; note assets and icon textures are hard references and load with it.
+	// Completes immediately if the track was prefetched while the previous one played.
+	// The serial drops callbacks that arrive after another track has been requested.
+	const uint32 TrackSerial = ++TrackLoadSerial;
+	TSharedPtr<FStreamableHandle> NewLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		CurrentTrackInfo.TrackSequence.ToSoftObjectPath(),
+		FStreamableDelegate::CreateWeakLambda(this, [this, TrackSerial]()
+		{
+			if (TrackSerial == TrackLoadSerial)
+			{
+				OnTrackLoaded();
+			}
+		}),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	if (TrackSerial != TrackLoadSerial)
+	{
+		// Completed synchronously and already moved on to a later track
+		return;
+	}
+
+	TrackLoadHandle = NewLoadHandle;
+	if (!TrackLoadHandle.IsValid())
+	{
+		UE_LOG(LogUniversalBeat, Error, TEXT("PlayTrack: Failed to request load of '%s'"), *CurrentTrackInfo.TrackSequence.ToString());
+		PlayTrack();
+	}
+}
+
+void UUniversalBeatSubsystem::OnTrackLoaded()
+{
+	if (!CurrentlyPlayingSong)
+	{
+		return;
+	}
+
+	if (!CurrentTrackInfo.TrackSequence.Get())
 	{
-		UE_LOG(LogUniversalBeat, Error, TEXT("PlayTrack: Failed to load track sequence"));
+		UE_LOG(LogUniversalBeat, Error, TEXT("PlayTrack: Failed to load track sequence '%s'"), *CurrentTrackInfo.TrackSequence.ToString());
 		// Try next track
 		PlayTrack();
 		return;
 	}
+
+	if (!bCurrentSongReady)
+	{
+		bCurrentSongReady = true;
+		OnSongReady.Broadcast(CurrentlyPlayingSong->GetSongTag());
+	}
+
+	// Stream the next track while this one plays
+	PrefetchNextTrack();
 	
 	if (bDebugLoggingEnabled)
 	{
@@ -1108,6 +1989,290 @@ void UUniversalBeatSubsystem::PlayTrack()
 	}
 }
 
+void UUniversalBeatSubsystem::PrefetchNextTrack()
+{
+	// Next track of this song, otherwise the first track of the next queued song
+	TSoftObjectPtr<ULevelSequence> NextSequence;
+	if (const FNoteTrackEntry* NextTrack = QueuedTracks.Peek())
+	{
+		NextSequence = NextTrack->TrackSequence;
+	}
+	else if (const TObjectPtr<USongConfiguration>* NextSong = QueuedSongs.Peek())
+	{
+		if (*NextSong && (*NextSong)->Tracks.Num() > 0)
+		{
+			NextSequence = (*NextSong)->Tracks[0].TrackSequence;
+		}
+	}
+
+	// Drop the previous prefetch; TrackLoadHandle keeps that sequence resident if it is now playing
+	TrackPrefetchHandle.Reset();
+	ResetPreparedTrack();
+	if (NextSequence.IsNull())
+	{
+		return;
+	}
+
+	// Requested even when resident so the handle keeps it that way; completes at once in that case.
+	// Pre-rolling happens here, off the track boundary, and is dropped if another track is requested first.
+	const uint32 TrackSerial = TrackLoadSerial;
+	const bool bResident = NextSequence.Get() != nullptr;
+	TrackPrefetchHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		NextSequence.ToSoftObjectPath(),
+		FStreamableDelegate::CreateWeakLambda(this, [this, TrackSerial]()
+		{
+			if (TrackSerial == TrackLoadSerial)
+			{
+				PrepareNextTrack();
+			}
+		}),
+		FStreamableManager::DefaultAsyncLoadPriority);
+
+	if (bDebugLoggingEnabled && !bResident)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("PrefetchNextTrack: Streaming '%s'"), *NextSequence.ToString());
+	}
+}
+
+void UUniversalBeatSubsystem::PrepareNextTrack()
+{
+	SCOPE_CYCLE_COUNTER(STAT_UniversalBeatLoadNoteChart);
+
+	ResetPreparedTrack();
+
+	// Concurrent songs already use the pooled players, and merge their charts when they load
+	if (!CurrentlyPlayingSong || CurrentlyPlayingSong->bPlayTracksConcurrently)
+	{
+		return;
+	}
+
+	USongConfiguration* Song = CurrentlyPlayingSong;
+	const FNoteTrackEntry* NextTrack = QueuedTracks.Peek();
+	if (!NextTrack)
+	{
+		const TObjectPtr<USongConfiguration>* NextSong = QueuedSongs.Peek();
+		if (!NextSong || !*NextSong || (*NextSong)->bPlayTracksConcurrently || (*NextSong)->Tracks.Num() == 0)
+		{
+			return;
+		}
+		Song = *NextSong;
+		NextTrack = &Song->Tracks[0];
+	}
+
+	ULevelSequence* Sequence = NextTrack->TrackSequence.Get();
+	UMovieScene* MovieScene = Sequence ? Sequence->GetMovieScene() : nullptr;
+	if (!MovieScene)
+	{
+		return;
+	}
+
+	// Back buffer: slot 1 is free while sequential songs play
+	ALevelSequenceActor* BackPlayer = AcquireSongPlayer(1);
+	if (!BackPlayer)
+	{
+		return;
+	}
+	BackPlayer->SetSequence(Sequence);
+
+	PreparedTrack.Track = *NextTrack;
+	PreparedTrack.Song = Song;
+	PreparedTrack.TrackIndex = Song->Tracks.IndexOfByPredicate([NextTrack](const FNoteTrackEntry& Entry)
+	{
+		return Entry.TrackSequence == NextTrack->TrackSequence;
+	});
+
+	TSharedPtr<const FCookedSongChart, ESPMode::ThreadSafe> CookedChart = Song->GetCookedChart();
+	if (CookedChart.IsValid() && CookedChart->Tracks.IsValidIndex(PreparedTrack.TrackIndex))
+	{
+		PreparedTrack.Chart = CookedChart->Tracks[PreparedTrack.TrackIndex].Chart;
+	}
+	else
+	{
+		PreparedTrack.Chart = MakeShared<FCompiledNoteChart, ESPMode::ThreadSafe>();
+		if (!PreparedTrack.Chart->CompileFromSequence(Sequence))
+		{
+			PreparedTrack.Chart.Reset();
+		}
+	}
+
+	if (PreparedTrack.Chart)
+	{
+		// Rebaked on start only if the tempo changes in between
+		BakeChartWindows(PreparedTrack.Chart, CurrentBPM);
+		PreparedTrack.JudgementState.Init(*PreparedTrack.Chart);
+		PreparedNoteChartAssets = PreparedTrack.Chart->NoteAssets;
+	}
+
+	const TRange<FFrameNumber> PlaybackRange = MovieScene->GetPlaybackRange();
+	PreparedTrack.TickResolution = MovieScene->GetTickResolution();
+	PreparedTrack.RangeStartSeconds = PreparedTrack.TickResolution.AsSeconds(UE::MovieScene::DiscreteInclusiveLower(PlaybackRange));
+	PreparedTrack.DurationSeconds = PreparedTrack.TickResolution.AsSeconds(FFrameTime(UE::MovieScene::DiscreteSize(PlaybackRange)));
+	PreparedTrack.DisplayRate = MovieScene->GetDisplayRate();
+	PreparedTrack.bEvaluatesSequencer = NeedsSequencerEvaluation(*MovieScene);
+	PreparedTrack.bReady = true;
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("PrepareNextTrack: Pre-rolled track %d of '%s' (%d notes)"),
+			PreparedTrack.TrackIndex, *Song->GetSongLabel(), PreparedTrack.Chart ? PreparedTrack.Chart->Num() : 0);
+	}
+}
+
+void UUniversalBeatSubsystem::ResetPreparedTrack()
+{
+	PreparedTrack = FPreparedSongTrack();
+	PreparedNoteChartAssets.Reset();
+}
+
+bool UUniversalBeatSubsystem::IsPreparedTrackNext() const
+{
+	if (!PreparedTrack.bReady || !CurrentlyPlayingSong)
+	{
+		return false;
+	}
+
+	// The queues may have changed since it was prepared
+	if (const FNoteTrackEntry* NextTrack = QueuedTracks.Peek())
+	{
+		return PreparedTrack.Song.Get() == CurrentlyPlayingSong && PreparedTrack.Track.TrackSequence == NextTrack->TrackSequence;
+	}
+	const TObjectPtr<USongConfiguration>* NextSong = QueuedSongs.Peek();
+	return NextSong && *NextSong && PreparedTrack.Song.Get() == *NextSong && PreparedTrack.TrackIndex == 0;
+}
+
+bool UUniversalBeatSubsystem::AdvanceToPreparedTrack(double EndClockTime)
+{
+	if (ActiveSongTracks.Num() > 0 || !IsPreparedTrackNext())
+	{
+		return false;
+	}
+
+	const int32 EndedTrackIndex = CurrentlyPlayingSong->Tracks.IndexOfByPredicate([this](const FNoteTrackEntry& Entry)
+	{
+		return Entry.TrackSequence == CurrentTrackInfo.TrackSequence;
+	});
+	OnTrackEnded.Broadcast(FMath::Max(EndedTrackIndex, 0));
+
+	if (QueuedTracks.IsEmpty())
+	{
+		// Song boundary: what CheckSongCompletion and PlaySong do, minus unloading and recompiling
+		OnSongEnded.Broadcast();
+
+		TObjectPtr<USongConfiguration> NextSong;
+		QueuedSongs.Dequeue(NextSong);
+		CurrentlyPlayingSong = NextSong;
+		bCurrentSongReady = false;
+		OnSongStarted.Broadcast();
+
+		for (const FNoteTrackEntry& Track : CurrentlyPlayingSong->Tracks)
+		{
+			QueuedTracks.Enqueue(Track);
+		}
+
+		if (bDebugLoggingEnabled)
+		{
+			UE_LOG(LogUniversalBeat, Log, TEXT("AdvanceToPreparedTrack: Started song '%s' with tag '%s'"),
+				*CurrentlyPlayingSong->GetSongLabel(), *CurrentlyPlayingSong->GetSongTag().ToString());
+		}
+	}
+
+	QueuedTracks.Dequeue(CurrentTrackInfo);
+
+	// The prefetch handle kept the prepared sequence resident; it is the current track's now.
+	// Callbacks still in flight for the ended track are dropped by the serial.
+	TrackLoadHandle = MoveTemp(TrackPrefetchHandle);
+	++TrackLoadSerial;
+
+	if (!bCurrentSongReady)
+	{
+		bCurrentSongReady = true;
+		OnSongReady.Broadcast(CurrentlyPlayingSong->GetSongTag());
+	}
+
+	if (CurrentTrackInfo.DelayOffset > 0.0f)
+	{
+		// A deliberate gap: OnTrackDelayComplete picks up the prepared state when the timer fires
+		StartTrackWithDelay(CurrentTrackInfo.DelayOffset);
+		return true;
+	}
+
+	// The boundary may have passed a fraction of a frame ago; start from it, not from now. A chart with
+	// a tempo map re-anchors the beat clock there; otherwise hold the start to the running beat grid.
+	double StartClockTime = EndClockTime;
+	const bool bHasTempoMap = PreparedTrack.Chart && PreparedTrack.Chart->HasTempoMap();
+	if (!bHasTempoMap && BeatClock.IsStarted())
+	{
+		const double BeatPosition = BeatClock.GetBeatPosition(EndClockTime);
+		const double BoundaryBeat = FMath::CeilToDouble(BeatPosition - UE_KINDA_SMALL_NUMBER);
+		StartClockTime += FMath::Max(BoundaryBeat - BeatPosition, 0.0) * BeatClock.GetSecondsPerBeat();
+	}
+	StartPreparedTrack(StartClockTime);
+	return true;
+}
+
+void UUniversalBeatSubsystem::StartPreparedTrack(double StartClockTime)
+{
+	// Front and back buffers trade places; the previous track's player becomes the next back buffer
+	if (SongPlayerPool.Num() > 0 && SongPlayerPool[0] && IsValid(SongPlayerPool[0]))
+	{
+		Swap(SongPlayerActor, SongPlayerPool[0]);
+	}
+	if (SongPlayerActor)
+	{
+		FMovieSceneSequencePlaybackSettings PlaybackSettings = SongPlayerActor->PlaybackSettings;
+		PlaybackSettings.LoopCount.Value = CurrentTrackInfo.LoopCount;
+		SongPlayerActor->PlaybackSettings = PlaybackSettings;
+		if (ULevelSequencePlayer* Player = GetSongPlayer())
+		{
+			Player->SetPlaybackSettings(PlaybackSettings);
+		}
+	}
+
+	ClearNoteChart();
+	CachedSequenceFrameRate = PreparedTrack.TickResolution;
+	if (PreparedTrack.Chart)
+	{
+		// No-op unless the tempo changed since the chart was prepared
+		BakeChartWindows(PreparedTrack.Chart, CurrentBPM);
+		NoteChart = MoveTemp(PreparedTrack.Chart);
+		Swap(NoteChartAssets, PreparedNoteChartAssets);
+		Swap(JudgementState, PreparedTrack.JudgementState);
+		SET_MEMORY_STAT(STAT_UniversalBeatNoteChartMemory, GetNoteChartMemoryUsage());
+	}
+
+	const int32 TrackIndex = FMath::Max(PreparedTrack.TrackIndex, 0);
+	StartChartPlaybackRange(
+		PreparedTrack.RangeStartSeconds,
+		PreparedTrack.DurationSeconds,
+		CurrentTrackInfo.LoopCount,
+		PreparedTrack.DisplayRate,
+		PreparedTrack.bEvaluatesSequencer,
+		CurrentTrackInfo.TrackSequence.GetAssetName(),
+		StartClockTime);
+	ResetPreparedTrack();
+
+	OnTrackStarted.Broadcast(TrackIndex);
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("StartPreparedTrack: Track %d started %.1fms after the boundary frame"),
+			TrackIndex, (GetBeatClockTime() - StartClockTime) * 1000.0);
+	}
+
+	// Pre-roll the one after, next frame so the boundary frame does no compile work
+	if (UWorld* World = GetWorld())
+	{
+		const uint32 TrackSerial = TrackLoadSerial;
+		World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this, TrackSerial]()
+		{
+			if (TrackSerial == TrackLoadSerial)
+			{
+				PrefetchNextTrack();
+			}
+		}));
+	}
+}
+
 void UUniversalBeatSubsystem::StartTrackWithDelay(float DelaySeconds)
 {
 	UWorld* World = GetWorld();
@@ -1143,11 +2308,18 @@ void UUniversalBeatSubsystem::OnTrackDelayComplete()
 		return;
 	}
 
-	// Load the track sequence asset from CurrentTrackInfo
-	ULevelSequence* TrackSequence = CurrentTrackInfo.TrackSequence.LoadSynchronous();
+	// Pre-rolled while the previous track played (delayed tracks come through here after the gapless switch)
+	if (PreparedTrack.bReady && PreparedTrack.Song.Get() == CurrentlyPlayingSong && PreparedTrack.Track.TrackSequence == CurrentTrackInfo.TrackSequence)
+	{
+		StartPreparedTrack(GetBeatClockTime());
+		return;
+	}
+
+	// Resident since OnTrackLoaded, held by TrackLoadHandle
+	ULevelSequence* TrackSequence = CurrentTrackInfo.TrackSequence.Get();
 	if (!TrackSequence)
 	{
-		UE_LOG(LogUniversalBeat, Error, TEXT("OnTrackDelayComplete: Failed to load track sequence"));
+		UE_LOG(LogUniversalBeat, Error, TEXT("OnTrackDelayComplete: Track sequence is not loaded"));
 		// Try next track
 		PlayTrack();
 		return;
@@ -1172,23 +2344,36 @@ void UUniversalBeatSubsystem::OnTrackDelayComplete()
 		return;
 	}
 
-	// Load note chart from the sequence for validation
-	LoadNoteChartFromSequence(TrackSequence);
+	// Use the cooked chart if the song has one, otherwise compile from the sequence
+	const int32 CookedTrackIndex = CurrentlyPlayingSong->Tracks.IndexOfByPredicate([this](const FNoteTrackEntry& Entry)
+	{
+		return Entry.TrackSequence == CurrentTrackInfo.TrackSequence;
+	});
+	TSharedPtr<const FCookedSongChart, ESPMode::ThreadSafe> CookedChart = CurrentlyPlayingSong->GetCookedChart();
+	if (CookedChart.IsValid() && CookedChart->Tracks.IsValidIndex(CookedTrackIndex))
+	{
+		SetActiveNoteChart(CookedChart->Tracks[CookedTrackIndex].Chart);
 
-	// Configure loop settings from CurrentTrackInfo
-	FMovieSceneSequencePlaybackSettings PlaybackSettings = SongPlayerActor->PlaybackSettings;
-	PlaybackSettings.LoopCount.Value = CurrentTrackInfo.LoopCount;
+		if (bDebugLoggingEnabled)
+		{
+			UE_LOG(LogUniversalBeat, Log, TEXT("OnTrackDelayComplete: Using cooked chart for track %d (%d notes)"), CookedTrackIndex, NoteChart->Num());
+		}
+	}
+	else
+	{
+		LoadNoteChartFromSequence(TrackSequence);
+	}
+
+	// Configure loop settings from CurrentTrackInfo
+	FMovieSceneSequencePlaybackSettings PlaybackSettings = SongPlayerActor->PlaybackSettings;
+	PlaybackSettings.LoopCount.Value = CurrentTrackInfo.LoopCount;
 	SongPlayerActor->PlaybackSettings = PlaybackSettings;
 
 	Player->SetPlaybackSettings(PlaybackSettings);
 
-	// Clear any previous finish bindings and bind our callback
-	Player->OnFinished.Clear();
-	Player->OnFinished.AddDynamic(this, &UUniversalBeatSubsystem::OnSongPlayerFinished);
-
-	// Start playback
-	// We don't use this for sequential playback, we control playback manually
-	//Player->Play(); 
+	// The player is never played: the chart clock fires notes, handles loops and ends the track,
+	// and only evaluates the sequence when it has cosmetic tracks
+	StartChartPlayback(TrackSequence, CurrentTrackInfo.LoopCount);
 
 	// Find track index for broadcasting (search in original song tracks)
 	int32 TrackIndex = 0;
@@ -1221,6 +2406,13 @@ void UUniversalBeatSubsystem::OnTrackSequenceFinished()
 		return;
 	}
 
+	// Concurrent tracks have already ended one by one on the merged timeline
+	if (ActiveSongTracks.Num() > 0)
+	{
+		CheckSongCompletion();
+		return;
+	}
+
 	if (bDebugLoggingEnabled)
 	{
 		UE_LOG(LogUniversalBeat, Log, TEXT("OnTrackSequenceFinished: Track finished"));
@@ -1249,17 +2441,10 @@ void UUniversalBeatSubsystem::OnTrackSequenceFinished()
 	}
 
 	// Play next track from queue (or complete song if queue empty)
-	// Note: If track was configured to loop, the player will handle it automatically
-	// and OnFinished won't be called until all loops are complete
+	// Note: Track loops are handled by the chart clock, which only calls this after the last pass
 	PlayTrack();
 }
 
-void UUniversalBeatSubsystem::OnSongPlayerFinished()
-{
-	// Delegate to the track-specific handler
-	OnTrackSequenceFinished();
-}
-
 bool UUniversalBeatSubsystem::CheckSongCompletion() const
 {
 	if (!CurrentlyPlayingSong)
@@ -1291,104 +2476,604 @@ bool UUniversalBeatSubsystem::CheckSongCompletion() const
 		return true;
 	}
 
-	return false;
+	return false;
+}
+
+void UUniversalBeatSubsystem::PlayConcurrentTracks()
+{
+	TArray<FSoftObjectPath> TrackPaths;
+	for (const FNoteTrackEntry& Track : CurrentlyPlayingSong->Tracks)
+	{
+		if (!Track.TrackSequence.IsNull())
+		{
+			TrackPaths.AddUnique(Track.TrackSequence.ToSoftObjectPath());
+		}
+	}
+
+	if (TrackPaths.Num() == 0)
+	{
+		UE_LOG(LogUniversalBeat, Error, TEXT("PlayConcurrentTracks: Song '%s' has no track sequences assigned"), *CurrentlyPlayingSong->GetSongLabel());
+		CheckSongCompletion();
+		return;
+	}
+
+	// One request for all stems; completes immediately if the song was prefetched
+	const uint32 TrackSerial = ++TrackLoadSerial;
+	TSharedPtr<FStreamableHandle> NewLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		TrackPaths,
+		FStreamableDelegate::CreateWeakLambda(this, [this, TrackSerial]()
+		{
+			if (TrackSerial == TrackLoadSerial)
+			{
+				OnConcurrentTracksLoaded();
+			}
+		}),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	if (TrackSerial != TrackLoadSerial)
+	{
+		// Completed synchronously and already moved on
+		return;
+	}
+
+	TrackLoadHandle = NewLoadHandle;
+	if (!TrackLoadHandle.IsValid())
+	{
+		UE_LOG(LogUniversalBeat, Error, TEXT("PlayConcurrentTracks: Failed to request load of song '%s'"), *CurrentlyPlayingSong->GetSongLabel());
+		CheckSongCompletion();
+	}
+}
+
+void UUniversalBeatSubsystem::OnConcurrentTracksLoaded()
+{
+	if (!CurrentlyPlayingSong)
+	{
+		return;
+	}
+
+	const TArray<FNoteTrackEntry>& Tracks = CurrentlyPlayingSong->Tracks;
+	TSharedPtr<const FCookedSongChart, ESPMode::ThreadSafe> CookedChart = CurrentlyPlayingSong->GetCookedChart();
+
+	// Track charts only need to live until they are merged
+	TArray<TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe>, TInlineAllocator<8>> TrackCharts;
+	TArray<FCompiledNoteChartLayer, TInlineAllocator<8>> Layers;
+	ActiveSongTracks.Reset(Tracks.Num());
+	double SongDurationSeconds = 0.0;
+	int32 NextPlayerSlot = 0;
+
+	for (int32 TrackIndex = 0; TrackIndex < Tracks.Num(); ++TrackIndex)
+	{
+		const FNoteTrackEntry& Track = Tracks[TrackIndex];
+		ULevelSequence* TrackSequence = Track.TrackSequence.Get();
+		UMovieScene* MovieScene = TrackSequence ? TrackSequence->GetMovieScene() : nullptr;
+		if (!MovieScene)
+		{
+			UE_LOG(LogUniversalBeat, Error, TEXT("OnConcurrentTracksLoaded: Failed to load track sequence '%s'"), *Track.TrackSequence.ToString());
+			continue;
+		}
+
+		const TRange<FFrameNumber> PlaybackRange = MovieScene->GetPlaybackRange();
+		const FFrameRate TickResolution = MovieScene->GetTickResolution();
+
+		FActiveSongTrack& ActiveTrack = ActiveSongTracks.AddDefaulted_GetRef();
+		ActiveTrack.TrackIndex = TrackIndex;
+		ActiveTrack.StartSeconds = FMath::Max(Track.DelayOffset, 0.0f);
+		ActiveTrack.RangeStartSeconds = TickResolution.AsSeconds(UE::MovieScene::DiscreteInclusiveLower(PlaybackRange));
+		ActiveTrack.PassSeconds = TickResolution.AsSeconds(FFrameTime(UE::MovieScene::DiscreteSize(PlaybackRange)));
+		ActiveTrack.NumPasses = FMath::Max(Track.LoopCount, 0) + 1;
+		ActiveTrack.DisplayRate = MovieScene->GetDisplayRate();
+		ActiveTrack.bEvaluatesSequencer = NeedsSequencerEvaluation(*MovieScene);
+		SongDurationSeconds = FMath::Max(SongDurationSeconds, ActiveTrack.GetEndSeconds());
+
+		if (ActiveSongTracks.Num() == 1)
+		{
+			CachedSequenceFrameRate = TickResolution;
+		}
+
+		// Only tracks with cosmetic content need a player of their own; the pool keeps them between songs
+		if (ActiveTrack.bEvaluatesSequencer)
+		{
+			if (ALevelSequenceActor* PlayerActor = AcquireSongPlayer(NextPlayerSlot))
+			{
+				PlayerActor->SetSequence(TrackSequence);
+				ActiveTrack.PlayerSlot = NextPlayerSlot++;
+			}
+		}
+
+		TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> TrackChart;
+		if (CookedChart.IsValid() && CookedChart->Tracks.IsValidIndex(TrackIndex))
+		{
+			TrackChart = CookedChart->Tracks[TrackIndex].Chart;
+		}
+		else
+		{
+			TrackChart = MakeShared<FCompiledNoteChart, ESPMode::ThreadSafe>();
+			TrackChart->CompileFromSequence(TrackSequence);
+		}
+		TrackCharts.Add(TrackChart);
+
+		FCompiledNoteChartLayer& Layer = Layers.AddDefaulted_GetRef();
+		Layer.Chart = TrackChart.Get();
+		Layer.RangeStartSeconds = ActiveTrack.RangeStartSeconds;
+		Layer.PassSeconds = ActiveTrack.PassSeconds;
+		Layer.OffsetSeconds = ActiveTrack.StartSeconds;
+		Layer.NumPasses = ActiveTrack.NumPasses;
+	}
+
+	if (ActiveSongTracks.Num() == 0)
+	{
+		CheckSongCompletion();
+		return;
+	}
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_UniversalBeatLoadNoteChart);
+		TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> MergedChart = MakeShared<FCompiledNoteChart, ESPMode::ThreadSafe>();
+		MergedChart->Merge(Layers);
+		SetActiveNoteChart(MoveTemp(MergedChart));
+	}
+
+	if (!bCurrentSongReady)
+	{
+		bCurrentSongReady = true;
+		OnSongReady.Broadcast(CurrentlyPlayingSong->GetSongTag());
+	}
+
+	// Stream the next song's first track while this one plays
+	PrefetchNextTrack();
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("OnConcurrentTracksLoaded: %d tracks merged into %d notes over %.2fs, %d pooled players"),
+			ActiveSongTracks.Num(), NoteChart->Num(), SongDurationSeconds, NextPlayerSlot);
+	}
+
+	// One chart clock for the whole song; each track starts at its delay on it
+	StartChartPlaybackRange(0.0, SongDurationSeconds, 0, FFrameRate(), false, CurrentlyPlayingSong->GetSongLabel(), GetBeatClockTime());
+	UpdateConcurrentTracks(GetChartTime(), false);
+}
+
+void UUniversalBeatSubsystem::UpdateConcurrentTracks(double ChartTime, bool bPassEnded)
+{
+	// Broadcast after the walk: a listener may stop the song and clear ActiveSongTracks
+	TArray<TPair<int32, bool>, TInlineAllocator<8>> TrackEvents;
+
+	for (FActiveSongTrack& Track : ActiveSongTracks)
+	{
+		if (Track.bEnded)
+		{
+			continue;
+		}
+
+		if (!Track.bStarted)
+		{
+			if (ChartTime < Track.StartSeconds && !bPassEnded)
+			{
+				continue;
+			}
+			Track.bStarted = true;
+			TrackEvents.Emplace(Track.TrackIndex, true);
+		}
+
+		if (bPassEnded || ChartTime >= Track.GetEndSeconds())
+		{
+			Track.bEnded = true;
+			TrackEvents.Emplace(Track.TrackIndex, false);
+			continue;
+		}
+
+		if (!Track.bEvaluatesSequencer || Track.PlayerSlot == INDEX_NONE || Track.PassSeconds <= 0.0)
+		{
+			continue;
+		}
+
+		// Track-local sequence time, looping within the track's own range
+		const double Elapsed = ChartTime - Track.StartSeconds;
+		const int32 Pass = FMath::Min(FMath::FloorToInt32(Elapsed / Track.PassSeconds), Track.NumPasses - 1);
+		const double SequenceTime = Track.RangeStartSeconds + Elapsed - Pass * Track.PassSeconds;
+		const int32 DisplayFrame = Track.DisplayRate.AsFrameTime(SequenceTime).FloorToFrame().Value;
+		if (Pass == Track.LastEvaluatedPass && DisplayFrame == Track.LastEvaluatedDisplayFrame)
+		{
+			continue;
+		}
+
+		ALevelSequenceActor* PlayerActor = AcquireSongPlayer(Track.PlayerSlot);
+		ULevelSequencePlayer* Player = PlayerActor ? PlayerActor->GetSequencePlayer() : nullptr;
+		if (!Player)
+		{
+			continue;
+		}
+
+		// Jump on start and loop wrap so events between the old and new position aren't re-triggered
+		const bool bJump = Pass != Track.LastEvaluatedPass;
+		Track.LastEvaluatedPass = Pass;
+		Track.LastEvaluatedDisplayFrame = DisplayFrame;
+		Player->SetPlaybackPosition(FMovieSceneSequencePlaybackParams(FFrameTime(FFrameNumber(DisplayFrame)),
+			bJump ? EUpdatePositionMethod::Jump : EUpdatePositionMethod::Play));
+	}
+
+	for (const TPair<int32, bool>& TrackEvent : TrackEvents)
+	{
+		if (TrackEvent.Value)
+		{
+			OnTrackStarted.Broadcast(TrackEvent.Key);
+		}
+		else
+		{
+			OnTrackEnded.Broadcast(TrackEvent.Key);
+		}
+	}
+}
+
+// ====================================================================
+// Note Chart System Implementation (moved from UNoteChartDirector)
+// ====================================================================
+bool UUniversalBeatSubsystem::LoadNoteChartFromSequence(ULevelSequence* Sequence)
+{
+	SCOPE_CYCLE_COUNTER(STAT_UniversalBeatLoadNoteChart);
+
+	if (!Sequence)
+	{
+		UE_LOG(LogUniversalBeat, Warning, TEXT("LoadNoteChartFromSequence: Invalid sequence"));
+		return false;
+	}
+
+	// Clear existing data
+	ClearNoteChart();
+
+	// Get the movie scene
+	UMovieScene* MovieScene = Sequence->GetMovieScene();
+	if (!MovieScene)
+	{
+		UE_LOG(LogUniversalBeat, Warning, TEXT("LoadNoteChartFromSequence: No movie scene"));
+		return false;
+	}
+
+	// Note keys are stored in tick resolution
+	CachedSequenceFrameRate = MovieScene->GetTickResolution();
+
+	// Compile all note chart sections straight from their channels
+	TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> CompiledChart = MakeShared<FCompiledNoteChart, ESPMode::ThreadSafe>();
+	if (!CompiledChart->CompileFromSequence(Sequence))
+	{
+		if (bDebugLoggingEnabled)
+		{
+			UE_LOG(LogUniversalBeat, Log, TEXT("LoadNoteChartFromSequence: No notes in sequence '%s'"), *Sequence->GetName());
+		}
+		return false;
+	}
+
+	SetActiveNoteChart(MoveTemp(CompiledChart));
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("LoadNoteChartFromSequence: Loaded %d notes in %d lanes (%llu bytes)"),
+			NoteChart->Num(), NoteChart->NumLanes(), (uint64)NoteChart->GetAllocatedSize());
+	}
+
+	return true;
+}
+
+void UUniversalBeatSubsystem::SetActiveNoteChart(TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> InChart)
+{
+	ClearNoteChart();
+	if (!InChart.IsValid())
+	{
+		return;
+	}
+
+	// A cooked chart stays shared with its song; only a chart handed over outright is baked in place
+	BakeChartWindows(InChart, CurrentBPM);
+	NoteChart = MoveTemp(InChart);
+	NoteChartAssets = NoteChart->NoteAssets;
+	JudgementState.Init(*NoteChart);
+	SET_MEMORY_STAT(STAT_UniversalBeatNoteChartMemory, GetNoteChartMemoryUsage());
+}
+
+void UUniversalBeatSubsystem::ClearNoteChart()
+{
+	NoteChart.Reset();
+	NoteChartAssets.Empty();
+	JudgementState.Empty();
+	SET_MEMORY_STAT(STAT_UniversalBeatNoteChartMemory, 0);
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("ClearNoteChart: Cleared all notes and reset tracking"));
+	}
+}
+
+TArray<FNoteInstance> UUniversalBeatSubsystem::GetAllNotes() const
+{
+	TArray<FNoteInstance> Notes;
+	if (NoteChart)
+	{
+		Notes.Reserve(NoteChart->Num());
+		for (int32 NoteIndex = 0; NoteIndex < NoteChart->Num(); ++NoteIndex)
+		{
+			Notes.Add(NoteChart->MakeNoteInstance(NoteIndex));
+		}
+	}
+	return Notes;
+}
+
+void UUniversalBeatSubsystem::SetNoteLookahead(float Lookahead, bool bInBeats)
+{
+	NoteLookahead = FMath::Max(Lookahead, 0.0f);
+	bNoteLookaheadInBeats = bInBeats;
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("SetNoteLookahead: %.3f %s (%.3fs)"),
+			NoteLookahead, bInBeats ? TEXT("beats") : TEXT("seconds"), GetNoteLookaheadSeconds());
+	}
+}
+
+float UUniversalBeatSubsystem::GetNoteLookaheadSeconds() const
+{
+	return bNoteLookaheadInBeats ? NoteLookahead * GetSecondsPerBeat() : NoteLookahead;
+}
+
+FCompiledNoteRange UUniversalBeatSubsystem::GetLookaheadNotes() const
+{
+	FCompiledNoteRange Range;
+	if (NoteChart && bChartPlaybackActive && GetNoteLookaheadSeconds() > 0.0f)
+	{
+		// Every entered note whose window has not been swept, [MissCursor, EnterCursor)
+		Range.Chart = NoteChart.Get();
+		Range.FirstNote = FMath::Min(JudgementState.MissCursor, LookaheadEnterCursor);
+		Range.NumNotes = LookaheadEnterCursor - Range.FirstNote;
+	}
+	return Range;
+}
+
+int32 UUniversalBeatSubsystem::GetTotalNoteCount() const
+{
+	return NoteChart ? NoteChart->Num() : 0;
+}
+
+void UUniversalBeatSubsystem::RebuildNoteLaneWindows()
+{
+	// Tempo-mapped charts are baked once at load; their windows do not follow the BPM
+	BakeChartWindows(NoteChart, CurrentBPM);
+
+	// Game thread, never during EvaluateJudgementSessions, so no session reads a half-baked chart.
+	// Sessions sharing a chart keep sharing it: a chart copied for one is reused for the rest.
+	TMap<const FCompiledNoteChart*, TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe>, TInlineSetAllocator<8>> RebakedCharts;
+	for (FBeatSession& Session : JudgementSessions)
+	{
+		if (!Session.Chart)
+		{
+			continue;
+		}
+
+		if (const TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe>* Rebaked = RebakedCharts.Find(Session.Chart.Get()))
+		{
+			Session.Chart = *Rebaked;
+			continue;
+		}
+
+		const FCompiledNoteChart* SourceChart = Session.Chart.Get();
+		BakeChartWindows(Session.Chart, CurrentBPM);
+		RebakedCharts.Add(SourceChart, Session.Chart);
+	}
+}
+
+void UUniversalBeatSubsystem::ResetConsumedNotes()
+{
+	if (NoteChart)
+	{
+		JudgementState.Rewind(*NoteChart);
+	}
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("ResetConsumedNotes: Reset for loop/restart"));
+	}
+}
+
+FBeatSessionHandle UUniversalBeatSubsystem::CreateJudgementSession(ULevelSequence* ChartSequence, float CalibrationOffsetMs)
+{
+	if (!ChartSequence)
+	{
+		return CreateJudgementSessionForChart(NoteChart, CalibrationOffsetMs);
+	}
+
+	// Share one compiled chart between all sessions on the same sequence
+	TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> Chart;
+	if (const TWeakPtr<FCompiledNoteChart, ESPMode::ThreadSafe>* CachedChart = JudgementSessionCharts.Find(ChartSequence))
+	{
+		Chart = CachedChart->Pin();
+	}
+	if (!Chart)
+	{
+		Chart = MakeShared<FCompiledNoteChart, ESPMode::ThreadSafe>();
+		if (!Chart->CompileFromSequence(ChartSequence))
+		{
+			UE_LOG(LogUniversalBeat, Warning, TEXT("CreateJudgementSession: Sequence '%s' has no notes"), *ChartSequence->GetName());
+			return FBeatSessionHandle();
+		}
+
+		// Baked while nothing else holds it, so the sessions share this chart rather than a copy
+		Chart->BakeWindows(CurrentBPM);
+
+		// Drop entries whose sequence or sessions are gone
+		for (auto It = JudgementSessionCharts.CreateIterator(); It; ++It)
+		{
+			if (!It->Key.IsValid() || !It->Value.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+		JudgementSessionCharts.Add(ChartSequence, Chart);
+	}
+
+	return CreateJudgementSessionForChart(Chart, CalibrationOffsetMs);
+}
+
+FBeatSessionHandle UUniversalBeatSubsystem::CreateJudgementSessionForChart(const TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe>& Chart, float CalibrationOffsetMs)
+{
+	if (!Chart || Chart->IsEmpty())
+	{
+		UE_LOG(LogUniversalBeat, Warning, TEXT("CreateJudgementSessionForChart: No note chart"));
+		return FBeatSessionHandle();
+	}
+
+	TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> SessionChart = Chart;
+	BakeChartWindows(SessionChart, CurrentBPM);
+
+	FBeatSessionHandle Handle;
+	Handle.Index = JudgementSessions.Emplace();
+	Handle.Serial = NextJudgementSessionSerial++;
+
+	FBeatSession& Session = JudgementSessions[Handle.Index];
+	Session.Serial = Handle.Serial;
+	Session.CalibrationOffsetSeconds = CalibrationOffsetMs / 1000.0;
+	Session.SetChart(SessionChart);
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("CreateJudgementSession: Session %d over %d notes (%d sessions)"),
+			Handle.Index, Chart->Num(), JudgementSessions.Num());
+	}
+
+	return Handle;
+}
+
+bool UUniversalBeatSubsystem::DestroyJudgementSession(FBeatSessionHandle Session)
+{
+	if (!ResolveJudgementSession(Session))
+	{
+		return false;
+	}
+
+	JudgementSessions.RemoveAt(Session.Index);
+	return true;
+}
+
+bool UUniversalBeatSubsystem::QueueJudgementSessionInput(FBeatSessionHandle Session, const FBeatInputEvent& Input)
+{
+	FBeatSession* ResolvedSession = ResolveJudgementSession(Session);
+	if (!ResolvedSession)
+	{
+		return false;
+	}
+
+	ResolvedSession->PendingInputs.Add(Input);
+	return true;
+}
+
+bool UUniversalBeatSubsystem::SetJudgementSessionCalibration(FBeatSessionHandle Session, float CalibrationOffsetMs)
+{
+	FBeatSession* ResolvedSession = ResolveJudgementSession(Session);
+	if (!ResolvedSession)
+	{
+		return false;
+	}
+
+	ResolvedSession->CalibrationOffsetSeconds = CalibrationOffsetMs / 1000.0;
+	return true;
+}
+
+bool UUniversalBeatSubsystem::ResetJudgementSession(FBeatSessionHandle Session)
+{
+	FBeatSession* ResolvedSession = ResolveJudgementSession(Session);
+	if (!ResolvedSession || !ResolvedSession->Chart)
+	{
+		return false;
+	}
+
+	ResolvedSession->State.Rewind(*ResolvedSession->Chart);
+	return true;
 }
 
-// ====================================================================
-// Note Chart System Implementation (moved from UNoteChartDirector)
-// ====================================================================
-bool UUniversalBeatSubsystem::LoadNoteChartFromSequence(ULevelSequence* Sequence)
+const FBeatSession* UUniversalBeatSubsystem::FindJudgementSession(FBeatSessionHandle Session) const
 {
-	if (!Sequence)
+	return const_cast<UUniversalBeatSubsystem*>(this)->ResolveJudgementSession(Session);
+}
+
+bool UUniversalBeatSubsystem::RestoreJudgementSessionState(FBeatSessionHandle Session, const FNoteJudgementState& Snapshot)
+{
+	FBeatSession* ResolvedSession = ResolveJudgementSession(Session);
+	if (!ResolvedSession || !ResolvedSession->Chart || !Snapshot.IsValidFor(*ResolvedSession->Chart))
 	{
-		UE_LOG(LogUniversalBeat, Warning, TEXT("LoadNoteChartFromSequence: Invalid sequence"));
 		return false;
 	}
 
-	// Clear existing data
-	CachedNotesSorted.Empty();
-	ConsumedNoteTimestamps.Empty();
-	CurrentNoteIndex = 0;
+	ResolvedSession->State = Snapshot;
+	return true;
+}
 
-	// Get the movie scene
-	UMovieScene* MovieScene = Sequence->GetMovieScene();
-	if (!MovieScene)
+FBeatSession* UUniversalBeatSubsystem::ResolveJudgementSession(FBeatSessionHandle Session)
+{
+	if (!Session.IsValid() || !JudgementSessions.IsValidIndex(Session.Index))
 	{
-		UE_LOG(LogUniversalBeat, Warning, TEXT("LoadNoteChartFromSequence: No movie scene"));
-		return false;
+		return nullptr;
 	}
 
-	// Cache frame rate for performance
-	CachedSequenceFrameRate = MovieScene->GetDisplayRate();
+	FBeatSession& ResolvedSession = JudgementSessions[Session.Index];
+	return ResolvedSession.Serial == Session.Serial ? &ResolvedSession : nullptr;
+}
 
-	// Find all note chart tracks
-	const TArray<UMovieSceneTrack*>& AllTracks = MovieScene->GetTracks();
-	for (UMovieSceneTrack* Track : AllTracks)
+void UUniversalBeatSubsystem::EvaluateJudgementSessions()
+{
+	if (JudgementSessions.Num() == 0)
 	{
-		UMovieSceneNoteChartTrack* NoteTrack = Cast<UMovieSceneNoteChartTrack>(Track);
-		if (!NoteTrack)
-		{
-			continue;
-		}
+		return;
+	}
 
-		// Get all sections from this track
-		const TArray<UMovieSceneSection*>& Sections = NoteTrack->GetAllSections();
-		for (UMovieSceneSection* Section : Sections)
+	SCOPE_CYCLE_COUNTER(STAT_UniversalBeatEvaluateSessions);
+
+	// Only sessions with queued inputs do any work this frame
+	TArray<FBeatSessionHandle, TInlineAllocator<64>> ActiveSessions;
+	for (auto It = JudgementSessions.CreateIterator(); It; ++It)
+	{
+		if (It->PendingInputs.Num() > 0)
 		{
-			UMovieSceneNoteChartSection* NoteSection = Cast<UMovieSceneNoteChartSection>(Section);
-			if (NoteSection)
-			{
-				// Add all notes from this section's runtime notes
-				CachedNotesSorted.Append(NoteSection->RuntimeNotes);
-			}
+			FBeatSessionHandle& Handle = ActiveSessions.AddDefaulted_GetRef();
+			Handle.Index = It.GetIndex();
+			Handle.Serial = It->Serial;
 		}
 	}
-
-	// Sort notes by timestamp
-	CachedNotesSorted.Sort([](const FNoteInstance& A, const FNoteInstance& B)
-	{
-		return A.Timestamp < B.Timestamp;
-	});
-
-	if (bDebugLoggingEnabled)
+	if (ActiveSessions.Num() == 0)
 	{
-		UE_LOG(LogUniversalBeat, Log, TEXT("LoadNoteChartFromSequence: Loaded %d notes"),
-			CachedNotesSorted.Num());
+		return;
 	}
 
-	return CachedNotesSorted.Num() > 0;
-}
-
-void UUniversalBeatSubsystem::ClearNoteChart()
-{
-	CachedNotesSorted.Empty();
-	ConsumedNoteTimestamps.Empty();
-	CurrentNoteIndex = 0;
+	// Each session writes only its own state and results; charts are read-only here
+	ParallelFor(ActiveSessions.Num(), [this, &ActiveSessions](int32 ActiveIndex)
+	{
+		JudgementSessions[ActiveSessions[ActiveIndex].Index].Evaluate();
+	}, ActiveSessions.Num() < MinParallelJudgementSessions ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
-	if (bDebugLoggingEnabled)
+	if (!OnJudgementSessionEvaluated.IsBound())
 	{
-		UE_LOG(LogUniversalBeat, Log, TEXT("ClearNoteChart: Cleared all notes and reset tracking"));
+		return;
 	}
-}
 
-TArray<FNoteInstance> UUniversalBeatSubsystem::GetAllNotes() const
-{
-	return CachedNotesSorted;
-}
+	// Blueprint-facing results resolve note assets, so they are built here on the game thread.
+	// Handlers may destroy sessions, so every handle is resolved again.
+	for (const FBeatSessionHandle& Handle : ActiveSessions)
+	{
+		const FBeatSession* Session = ResolveJudgementSession(Handle);
+		if (!Session)
+		{
+			continue;
+		}
 
-int32 UUniversalBeatSubsystem::GetTotalNoteCount() const
-{
-	return CachedNotesSorted.Num();
-}
+		JudgementSessionResultScratch.Reset(Session->Results.Num());
+		for (int32 InputIndex = 0; InputIndex < Session->Results.Num(); ++InputIndex)
+		{
+			const FNoteJudgement& Judgement = Session->Results[InputIndex];
+			const FBeatInputEvent& Input = Session->JudgedInputs[InputIndex];
 
-void UUniversalBeatSubsystem::ResetConsumedNotes()
-{
-	ConsumedNoteTimestamps.Empty();
-	CurrentNoteIndex = 0;
+			FNoteValidationResult& Result = JudgementSessionResultScratch.AddDefaulted_GetRef();
+			Result.InputTimestamp = Input.Timestamp;
+			Result.NoteTag = Input.InputTag;
+			NoteJudgement::FillValidationResult(*Session->Chart, Judgement, Result);
+		}
 
-	if (bDebugLoggingEnabled)
-	{
-		UE_LOG(LogUniversalBeat, Log, TEXT("ResetConsumedNotes: Reset for loop/restart"));
+		OnJudgementSessionEvaluated.Broadcast(Handle, JudgementSessionResultScratch, Session->NumHits);
 	}
 }
 
@@ -1454,17 +3139,13 @@ bool UUniversalBeatSubsystem::PlayNoteChartSequence(ULevelSequence* Sequence)
 		return false;
 	}
 
-	// Start playback - get player from actor
-	/*ULevelSequencePlayer* Player = GetSongPlayer();
-	if (Player)
-	{
-		Player->Play();
-	}*/
+	// Start the chart clock (plays once, no loops)
+	StartChartPlayback(Sequence, 0);
 
 	if (bDebugLoggingEnabled)
 	{
 		UE_LOG(LogUniversalBeat, Log, TEXT("PlayNoteChartSequence: Started sequence '%s' with %d notes"),
-			*Sequence->GetName(), CachedNotesSorted.Num());
+			*Sequence->GetName(), GetTotalNoteCount());
 	}
 
 	return true;
@@ -1478,6 +3159,7 @@ void UUniversalBeatSubsystem::StopNoteChartSequence()
 		Player->GoToEndAndStop();
 	}
 
+	StopChartPlayback();
 	CurrentNoteChartSequence = nullptr;
 	ClearNoteChart();
 
@@ -1498,101 +3180,330 @@ bool UUniversalBeatSubsystem::IsPlayingNoteChart() const
 	//return Player && Player->IsPlaying();
 }
 
-bool UUniversalBeatSubsystem::GetNextNoteForTag(FGameplayTag NoteTag, float CurrentTime, FNoteInstance& OutNote)
+bool UUniversalBeatSubsystem::RestoreJudgementState(const FNoteJudgementState& Snapshot)
 {
-	if (!NoteTag.IsValid() || CachedNotesSorted.Num() == 0)
+	if (!NoteChart || !Snapshot.IsValidFor(*NoteChart))
 	{
+		UE_LOG(LogUniversalBeat, Warning, TEXT("RestoreJudgementState: Snapshot does not match the active note chart"));
 		return false;
 	}
 
-	// Binary search for notes around current time
-	// Start from current index to optimize sequential playback
-	for (int32 i = CurrentNoteIndex; i < CachedNotesSorted.Num(); ++i)
+	JudgementState = Snapshot;
+	return true;
+}
+
+float UUniversalBeatSubsystem::FrameToSeconds(FFrameNumber Frame) const
+{
+	return CachedSequenceFrameRate.AsSeconds(Frame);
+}
+
+FFrameNumber UUniversalBeatSubsystem::SecondsToFrame(float Seconds) const
+{
+	return CachedSequenceFrameRate.AsFrameNumber(Seconds);
+}
+
+float UUniversalBeatSubsystem::GetCurrentPlaybackTime() const
+{
+	// Chart clock (follows the beat clock, so the audio clock too when one is set)
+	if (bChartPlaybackActive)
 	{
-		const FNoteInstance& Note = CachedNotesSorted[i];
+		return static_cast<float>(GetChartTime());
+	}
 
-		// Skip if already consumed
-		if (ConsumedNoteTimestamps.Contains(Note.Timestamp.Value))
-		{
-			continue;
-		}
+	// Sample-accurate song position when an audio clock drives timing
+	if (TimingSource && TimingSource->IsSongPositionSource() && TimingSource->IsReady())
+	{
+		return static_cast<float>(TimingSource->GetTimeSeconds());
+	}
 
-		// Skip if wrong tag
-		if (!Note.NoteData || Note.NoteData->GetNoteTag() != NoteTag)
-		{
-			continue;
-		}
+	ULevelSequencePlayer* Player = GetSongPlayer();
+	if (!Player)
+	{
+		// Fallback to real-time if no player active or not playing
+		return FPlatformTime::Seconds();
+	}
+
+	// Get current playback position from the player (qualified by the player's own rate)
+	return static_cast<float>(Player->GetCurrentTime().AsSeconds());
+}
+
+void UUniversalBeatSubsystem::StartChartPlayback(ULevelSequence* Sequence, int32 LoopCount)
+{
+	UMovieScene* MovieScene = Sequence ? Sequence->GetMovieScene() : nullptr;
+	if (!MovieScene)
+	{
+		StopChartPlayback();
+		return;
+	}
+
+	const TRange<FFrameNumber> PlaybackRange = MovieScene->GetPlaybackRange();
+	const FFrameRate TickResolution = MovieScene->GetTickResolution();
+	const FFrameNumber RangeStart = UE::MovieScene::DiscreteInclusiveLower(PlaybackRange);
+
+	StartChartPlaybackRange(
+		TickResolution.AsSeconds(RangeStart),
+		TickResolution.AsSeconds(FFrameTime(UE::MovieScene::DiscreteSize(PlaybackRange))),
+		LoopCount,
+		MovieScene->GetDisplayRate(),
+		NeedsSequencerEvaluation(*MovieScene),
+		Sequence->GetName(),
+		GetBeatClockTime());
+}
+
+void UUniversalBeatSubsystem::StartChartPlaybackRange(double RangeStartSeconds, double DurationSeconds, int32 LoopCount, FFrameRate DisplayRate, bool bEvaluatesSequencer, const FString& DebugName, double StartClockTime)
+{
+	StopChartPlayback();
+
+	ChartRangeStartSeconds = RangeStartSeconds;
+	ChartDurationSeconds = DurationSeconds;
+	ChartDisplayRate = DisplayRate;
+	ChartLoopsRemaining = FMath::Max(LoopCount, 0);
+	NextTriggerNote = 0;
+	LookaheadEnterCursor = 0;
+	if (NoteChart)
+	{
+		// A new pass: the miss sweep starts over from the first note
+		JudgementState.Rewind(*NoteChart);
+	}
+	LastEvaluatedDisplayFrame = INDEX_NONE;
+	bChartEvaluatesSequencer = bEvaluatesSequencer;
+
+	ChartStartTime = StartClockTime;
+	ChartPausedTime = ChartRangeStartSeconds;
+	ReplayRecorder.RecordPassStart(ChartStartTime);
+	bChartPaused = false;
+	bChartPlaybackActive = true;
+
+	ChartTempoSegment = INDEX_NONE;
+	if (NoteChart && NoteChart->HasTempoMap())
+	{
+		AlignBeatClockToChart(*NoteChart);
+	}
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("StartChartPlayback: '%s' %.3fs x%d, sequencer evaluation %s at %.2f fps"),
+			*DebugName, ChartDurationSeconds, ChartLoopsRemaining + 1,
+			bChartEvaluatesSequencer ? TEXT("on") : TEXT("off"), ChartDisplayRate.AsDecimal());
+	}
+}
+
+void UUniversalBeatSubsystem::StopChartPlayback()
+{
+	bChartPlaybackActive = false;
+	bChartPaused = false;
+	bChartEvaluatesSequencer = false;
+	NextTriggerNote = 0;
+	LookaheadEnterCursor = 0;
+	ChartTempoSegment = INDEX_NONE;
+	LastEvaluatedDisplayFrame = INDEX_NONE;
+}
+
+double UUniversalBeatSubsystem::GetChartTime() const
+{
+	return GetChartTimeAt(GetBeatClockTime());
+}
+
+double UUniversalBeatSubsystem::GetChartTimeAt(double ClockTime) const
+{
+	if (bChartPaused)
+	{
+		return ChartPausedTime;
+	}
+	return ChartRangeStartSeconds + (ClockTime - ChartStartTime);
+}
+
+double UUniversalBeatSubsystem::ChartTimeToBeatClockTime(double ChartTime) const
+{
+	if (bChartPlaybackActive && !bChartPaused)
+	{
+		return ChartStartTime + (ChartTime - ChartRangeStartSeconds);
+	}
+
+	// Paused or no chart playing: measure back from the current playback time, as CheckBeatTimingByTag does
+	return GetBeatClockTime() - (GetCurrentPlaybackTime() - ChartTime);
+}
 
-		// Convert note timestamp to seconds
-		float NoteTimeSeconds = FrameToSeconds(Note.Timestamp);
+void UUniversalBeatSubsystem::AdvanceChartPlayback()
+{
+	SCOPE_CYCLE_COUNTER(STAT_UniversalBeatAdvanceChart);
 
-		// Calculate timing windows
-		float PreTimingSeconds = UUniversalBeatFunctionLibrary::ConvertMusicalNoteToSeconds(
-			Note.NoteData->GetPreTiming(), CurrentBPM);
-		float PostTimingSeconds = UUniversalBeatFunctionLibrary::ConvertMusicalNoteToSeconds(
-			Note.NoteData->GetPostTiming(), CurrentBPM);
+	if (!bChartPlaybackActive || bChartPaused)
+	{
+		return;
+	}
 
-		float WindowStart = NoteTimeSeconds - PreTimingSeconds;
-		float WindowEnd = NoteTimeSeconds + PostTimingSeconds;
+	// Finishing a track may replace the chart; keep this one alive for the walk
+	const TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> Chart = NoteChart;
+	const double EndTime = ChartRangeStartSeconds + ChartDurationSeconds;
+	double ChartTime = GetChartTime();
+	bool bWrapped = false;
 
-		// Check if current time is within timing window
-		if (CurrentTime >= WindowStart && CurrentTime <= WindowEnd)
+	// Finish passes that ended since the last frame (more than one on a hitch with a short sequence)
+	while (ChartTime >= EndTime)
+	{
+		while (Chart && NextTriggerNote < Chart->Num() && Chart->NoteSeconds[NextTriggerNote] < EndTime)
 		{
-			// Update current index for next search
-			CurrentNoteIndex = i;
-			OutNote = Note;
-			return true;
+			EnqueueNoteEvent(*Chart, NextTriggerNote++);
+		}
+		if (Chart)
+		{
+			UpdateChartTempo(*Chart, EndTime);
+			UpdateNoteLookahead(*Chart, EndTime, true);
+			CompleteHeldNotes(*Chart, TNumericLimits<double>::Max());
+			SweepMissedNotes(*Chart, TNumericLimits<double>::Max());
 		}
 
-		// If we've passed the window, this note is missed
-		if (CurrentTime > WindowEnd)
+		if (ChartLoopsRemaining <= 0 || ChartDurationSeconds <= 0.0)
 		{
-			// TODO: Trigger miss event in future phase
-			continue;
+			if (ActiveSongTracks.Num() > 0)
+			{
+				UpdateConcurrentTracks(EndTime, true);
+			}
+			const double EndClockTime = ChartStartTime + ChartDurationSeconds;
+			StopChartPlayback();
+			if (CurrentlyPlayingSong && !AdvanceToPreparedTrack(EndClockTime))
+			{
+				OnTrackSequenceFinished();
+			}
+			return;
 		}
 
-		// If we haven't reached the window yet, stop searching
-		if (CurrentTime < WindowStart)
+		--ChartLoopsRemaining;
+		ChartStartTime += ChartDurationSeconds;
+		ChartTime -= ChartDurationSeconds;
+		NextTriggerNote = 0;
+		LookaheadEnterCursor = 0;
+		bWrapped = true;
+		ReplayRecorder.RecordPassStart(ChartStartTime);
+		if (Chart)
 		{
-			break;
+			ResetConsumedNotes();
+
+			// Back to the tempo at the range start, continuing the beat count across the loop
+			if (ChartTempoSegment != INDEX_NONE)
+			{
+				ChartTempoSegment = Chart->TempoMap.FindSegment(ChartRangeStartSeconds);
+				ApplyTempoChange(Chart->TempoMap.GetBPM(ChartTempoSegment), ChartStartTime);
+			}
 		}
 	}
 
-	return false;
+	while (Chart && NextTriggerNote < Chart->Num() && Chart->NoteSeconds[NextTriggerNote] <= ChartTime)
+	{
+		EnqueueNoteEvent(*Chart, NextTriggerNote++);
+	}
+	if (Chart)
+	{
+		UpdateChartTempo(*Chart, ChartTime);
+		UpdateNoteLookahead(*Chart, ChartTime, false);
+		CompleteHeldNotes(*Chart, ChartTime);
+		SweepMissedNotes(*Chart, ChartTime);
+	}
+
+	if (ActiveSongTracks.Num() > 0)
+	{
+		UpdateConcurrentTracks(ChartTime, false);
+	}
+
+	// Cosmetic tracks only: evaluate once per display frame rather than per beat tick
+	if (bChartEvaluatesSequencer && ChartTime >= ChartRangeStartSeconds)
+	{
+		const int32 DisplayFrame = ChartDisplayRate.AsFrameTime(ChartTime).FloorToFrame().Value;
+		if (bWrapped || DisplayFrame != LastEvaluatedDisplayFrame)
+		{
+			EvaluateSequencerAt(DisplayFrame, bWrapped || LastEvaluatedDisplayFrame == INDEX_NONE);
+		}
+	}
 }
 
-void UUniversalBeatSubsystem::MarkNoteConsumed(const FNoteInstance& Note)
+void UUniversalBeatSubsystem::UpdateNoteLookahead(const FCompiledNoteChart& Chart, double ChartTime, bool bPassEnded)
 {
-	ConsumedNoteTimestamps.Add(Note.Timestamp.Value);
+	const double LookaheadSeconds = GetNoteLookaheadSeconds();
+	if (LookaheadSeconds <= 0.0)
+	{
+		// Disabled: keep the window empty so enabling it later starts from the current time
+		LookaheadEnterCursor = NextTriggerNote;
+		return;
+	}
+
+	// Enter: notes are time-ordered, so only the notes crossing the horizon this frame are visited
+	const double Horizon = ChartTime + LookaheadSeconds;
+	while (LookaheadEnterCursor < Chart.Num() && (bPassEnded || Chart.NoteSeconds[LookaheadEnterCursor] <= Horizon))
+	{
+		const int32 NoteIndex = LookaheadEnterCursor++;
+		FBeatEvent Event = FBeatEvent::MakeNote(Chart.MakeNoteInstance(NoteIndex), Chart.GetNoteTag(NoteIndex), NoteIndex, EBeatEventType::NoteApproach);
+		Event.Value = static_cast<float>(Chart.NoteSeconds[NoteIndex] - ChartTime);
+		EnqueueBeatEvent(Event);
+	}
+
+	// Notes leave through the miss sweep cursor (see GetLookaheadNotes)
 }
 
-bool UUniversalBeatSubsystem::IsNoteConsumed(const FNoteInstance& Note) const
+void UUniversalBeatSubsystem::SweepMissedNotes(const FCompiledNoteChart& Chart, double ChartTime)
 {
-	return ConsumedNoteTimestamps.Contains(Note.Timestamp.Value);
+	if (!JudgementState.IsValidFor(Chart))
+	{
+		return;
+	}
+
+	MissedNoteScratch.Reset();
+	if (NoteJudgement::SweepMisses(Chart, JudgementState, ChartTime, &MissedNoteScratch) == 0)
+	{
+		return;
+	}
+
+	TimingStats.NumNotesMissed += MissedNoteScratch.Num();
+	INC_DWORD_STAT_BY(STAT_UniversalBeatNotesMissed, MissedNoteScratch.Num());
+	UniversalBeatTrace::OutputMisses(MissedNoteScratch.Num());
+
+	for (const int32 NoteIndex : MissedNoteScratch)
+	{
+		EnqueueBeatEvent(FBeatEvent::MakeNote(Chart.MakeNoteInstance(NoteIndex), Chart.GetNoteTag(NoteIndex), NoteIndex, EBeatEventType::NoteMissed));
+	}
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Verbose, TEXT("SweepMissedNotes: %d missed at %.3fs (%d total)"),
+			MissedNoteScratch.Num(), ChartTime, JudgementState.NumMissed);
+	}
 }
 
-float UUniversalBeatSubsystem::FrameToSeconds(FFrameNumber Frame) const
+void UUniversalBeatSubsystem::CompleteHeldNotes(const FCompiledNoteChart& Chart, double ChartTime)
 {
-	return CachedSequenceFrameRate.AsSeconds(Frame);
+	// O(1) between hold endpoints: nothing is polled while a sustain is in progress
+	if (JudgementState.ActiveHolds.Num() == 0 || ChartTime < JudgementState.NextHoldEnd)
+	{
+		return;
+	}
+
+	CompletedHoldScratch.Reset();
+	NoteJudgement::CompleteHolds(Chart, JudgementState, ChartTime, &CompletedHoldScratch);
+	for (const FNoteJudgement& Judgement : CompletedHoldScratch)
+	{
+		EnqueueHoldCompleted(Chart, Judgement);
+	}
 }
 
-FFrameNumber UUniversalBeatSubsystem::SecondsToFrame(float Seconds) const
+void UUniversalBeatSubsystem::EnqueueNoteEvent(const FCompiledNoteChart& Chart, int32 NoteIndex)
 {
-	return CachedSequenceFrameRate.AsFrameNumber(Seconds);
+	EnqueueBeatEvent(FBeatEvent::MakeNote(Chart.MakeNoteInstance(NoteIndex), Chart.GetNoteTag(NoteIndex), NoteIndex));
 }
 
-float UUniversalBeatSubsystem::GetCurrentPlaybackTime() const
+void UUniversalBeatSubsystem::EvaluateSequencerAt(int32 DisplayFrame, bool bJump)
 {
 	ULevelSequencePlayer* Player = GetSongPlayer();
 	if (!Player)
 	{
-		// Fallback to real-time if no player active or not playing
-		return FPlatformTime::Seconds();
+		return;
 	}
 
-	// Get current playback position from the player
-	FFrameTime CurrentFrame = Player->GetCurrentTime().Time;
-	return FrameToSeconds(CurrentFrame.GetFrame());
+	LastEvaluatedDisplayFrame = DisplayFrame;
+
+	// Jump on start and loop wrap so events between the old and new position aren't re-triggered
+	const FMovieSceneSequencePlaybackParams PlaybackParams(FFrameTime(FFrameNumber(DisplayFrame)),
+		bJump ? EUpdatePositionMethod::Jump : EUpdatePositionMethod::Play);
+	Player->SetPlaybackPosition(PlaybackParams);
 }
 
 void UUniversalBeatSubsystem::EnsureSongPlayerActor()
@@ -1603,11 +3514,28 @@ void UUniversalBeatSubsystem::EnsureSongPlayerActor()
 		return;
 	}
 
+	SongPlayerActor = SpawnSongPlayerActor(FName(TEXT("SongPlayerActor")));
+	if (!SongPlayerActor)
+	{
+		return;
+	}
+
+	// Rename the actor for easy identification in the outliner
+	SongPlayerActor->Rename(TEXT("SongPlayer"));
+
+	if (bDebugLoggingEnabled)
+	{
+		UE_LOG(LogUniversalBeat, Log, TEXT("EnsureSongPlayerActor: Created SongPlayer actor and player"));
+	}
+}
+
+ALevelSequenceActor* UUniversalBeatSubsystem::SpawnSongPlayerActor(FName ActorName)
+{
 	UWorld* World = GetWorld();
 	if (!World)
 	{
-		UE_LOG(LogUniversalBeat, Error, TEXT("EnsureSongPlayerActor: No valid world"));
-		return;
+		UE_LOG(LogUniversalBeat, Error, TEXT("SpawnSongPlayerActor: No valid world"));
+		return nullptr;
 	}
 
 	// Use the static factory method to create both player and actor
@@ -1625,30 +3553,70 @@ void UUniversalBeatSubsystem::EnsureSongPlayerActor()
 	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 	SpawnParams.ObjectFlags |= RF_Transient;
 	SpawnParams.bAllowDuringConstructionScript = true;
-	SpawnParams.Name = FName(TEXT("SongPlayerActor"));
+	SpawnParams.Name = ActorName;
 	// Defer construction for autoplay so that BeginPlay() is called
 	SpawnParams.bDeferConstruction = true;
 
 	ALevelSequenceActor* OutActor = World->SpawnActor<ALevelSequenceActor>(SpawnParams);
-	OutActor->SetActorLabel(TEXT("SongPlayerActor"));
-	ULevelSequencePlayer* Player = OutActor->GetSequencePlayer();
-	OutActor->PlaybackSettings = PlaybackSettings;
+	ULevelSequencePlayer* Player = OutActor ? OutActor->GetSequencePlayer() : nullptr;
 	if (!OutActor || !Player)
 	{
-		UE_LOG(LogUniversalBeat, Error, TEXT("EnsureSongPlayerActor: Failed to create SongPlayer actor (OutActor=%s, Player=%s)"),
+		UE_LOG(LogUniversalBeat, Error, TEXT("SpawnSongPlayerActor: Failed to create '%s' (OutActor=%s, Player=%s)"),
+			*ActorName.ToString(),
 			OutActor ? TEXT("Valid") : TEXT("NULL"),
 			Player ? TEXT("Valid") : TEXT("NULL"));
-		return;
+		return nullptr;
 	}
 
-	SongPlayerActor = OutActor;
+	OutActor->SetActorLabel(ActorName.ToString());
+	OutActor->PlaybackSettings = PlaybackSettings;
+	return OutActor;
+}
 
-	// Rename the actor for easy identification in the outliner
-	SongPlayerActor->Rename(TEXT("SongPlayer"));
+ALevelSequenceActor* UUniversalBeatSubsystem::AcquireSongPlayer(int32 Slot)
+{
+	if (Slot <= 0)
+	{
+		EnsureSongPlayerActor();
+		return SongPlayerActor;
+	}
 
-	if (bDebugLoggingEnabled)
+	if (SongPlayerPool.Num() < Slot)
 	{
-		UE_LOG(LogUniversalBeat, Log, TEXT("EnsureSongPlayerActor: Created SongPlayer actor and player"));
+		SongPlayerPool.SetNum(Slot);
+	}
+
+	TObjectPtr<ALevelSequenceActor>& PooledActor = SongPlayerPool[Slot - 1];
+	if (!PooledActor || !IsValid(PooledActor))
+	{
+		UWorld* World = GetWorld();
+		const FName ActorName = World
+			? MakeUniqueObjectName(World->GetCurrentLevel(), ALevelSequenceActor::StaticClass(), FName(TEXT("SongTrackPlayer")))
+			: NAME_None;
+		PooledActor = SpawnSongPlayerActor(ActorName);
+
+		if (PooledActor && bDebugLoggingEnabled)
+		{
+			UE_LOG(LogUniversalBeat, Log, TEXT("AcquireSongPlayer: Spawned pooled player %d"), Slot);
+		}
+	}
+	return PooledActor;
+}
+
+void UUniversalBeatSubsystem::StopSongPlayers()
+{
+	if (ULevelSequencePlayer* Player = GetSongPlayer(); Player && Player->IsPlaying())
+	{
+		Player->Stop();
+	}
+
+	for (ALevelSequenceActor* PooledActor : SongPlayerPool)
+	{
+		ULevelSequencePlayer* Player = IsValid(PooledActor) ? PooledActor->GetSequencePlayer() : nullptr;
+		if (Player && Player->IsPlaying())
+		{
+			Player->Stop();
+		}
 	}
 }
 
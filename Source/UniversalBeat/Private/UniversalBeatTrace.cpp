@@ -0,0 +1,65 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UniversalBeatTrace.h"
+#include "Trace/Trace.inl"
+
+UE_TRACE_CHANNEL_DEFINE(UniversalBeatChannel)
+
+UE_TRACE_EVENT_BEGIN(UniversalBeat, BeatTick)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(double, IdealTime)
+	UE_TRACE_EVENT_FIELD(int32, Tick)
+	UE_TRACE_EVENT_FIELD(float, JitterMs)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(UniversalBeat, Judgement)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InputTag)
+	UE_TRACE_EVENT_FIELD(bool, bHit)
+	UE_TRACE_EVENT_FIELD(float, OffsetMs)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(UniversalBeat, InputLatency)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(float, LatencyMs)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(UniversalBeat, Misses)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(int32, NumMissed)
+UE_TRACE_EVENT_END()
+
+namespace UniversalBeatTrace
+{
+	void OutputBeatTick(int32 Tick, double IdealTime, float JitterMs)
+	{
+		UE_TRACE_LOG(UniversalBeat, BeatTick, UniversalBeatChannel)
+			<< BeatTick.Cycle(FPlatformTime::Cycles64())
+			<< BeatTick.IdealTime(IdealTime)
+			<< BeatTick.Tick(Tick)
+			<< BeatTick.JitterMs(JitterMs);
+	}
+
+	void OutputJudgement(uint32 InputTag, bool bHit, float OffsetMs)
+	{
+		UE_TRACE_LOG(UniversalBeat, Judgement, UniversalBeatChannel)
+			<< Judgement.Cycle(FPlatformTime::Cycles64())
+			<< Judgement.InputTag(InputTag)
+			<< Judgement.bHit(bHit)
+			<< Judgement.OffsetMs(OffsetMs);
+	}
+
+	void OutputInputLatency(float LatencyMs)
+	{
+		UE_TRACE_LOG(UniversalBeat, InputLatency, UniversalBeatChannel)
+			<< InputLatency.Cycle(FPlatformTime::Cycles64())
+			<< InputLatency.LatencyMs(LatencyMs);
+	}
+
+	void OutputMisses(int32 NumMissed)
+	{
+		UE_TRACE_LOG(UniversalBeat, Misses, UniversalBeatChannel)
+			<< Misses.Cycle(FPlatformTime::Cycles64())
+			<< Misses.NumMissed(NumMissed);
+	}
+}
@@ -0,0 +1,29 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+
+/**
+ * Unreal Insights events of the UniversalBeat subsystem
+ *
+ * Enable with -trace=UniversalBeat (or "Trace.Enable UniversalBeat" at runtime).
+ * Each call is a channel check and nothing else while the channel is off.
+ */
+UE_TRACE_CHANNEL_EXTERN(UniversalBeatChannel)
+
+namespace UniversalBeatTrace
+{
+	/** Beat tick delivered: its index and how far it landed from the tick's ideal time */
+	void OutputBeatTick(int32 Tick, double IdealTime, float JitterMs);
+
+	/** Input judged against the chart (InputTag is the tag's hash); OffsetMs is input minus note time on a hit */
+	void OutputJudgement(uint32 InputTag, bool bHit, float OffsetMs);
+
+	/** Time from a timestamped input to the start of its judgement */
+	void OutputInputLatency(float LatencyMs);
+
+	/** Notes swept as missed this frame */
+	void OutputMisses(int32 NumMissed);
+}
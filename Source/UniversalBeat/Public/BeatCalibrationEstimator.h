@@ -0,0 +1,88 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Streaming estimate of a player's timing offset from individual taps
+ *
+ * Each sample is how late (positive) or early one input was, in milliseconds. The estimate is
+ * a trimmed mean of the samples kept, and its confidence a robust standard error derived from
+ * the median absolute deviation, so one stray tap neither skews the result nor hides behind a
+ * small spread. Samples further than OutlierSigmas robust deviations from the median are
+ * rejected once there are enough to judge by; a run of rejections is taken as the player
+ * settling on a new offset, and the window restarts from the next such sample.
+ *
+ * The window holds the last MaxSamples samples, so a long-running estimator (passive
+ * recalibration during play) follows drift instead of averaging the whole session.
+ * Adding a sample sorts at most MaxSamples floats: no allocation.
+ */
+struct UNIVERSALBEAT_API FBeatCalibrationEstimator
+{
+	static constexpr int32 MaxSamples = 64;
+
+	/** Samples beyond this magnitude are never taps on the beat */
+	static constexpr float MaxSampleMs = 250.0f;
+
+	/** Samples needed before outliers are rejected */
+	static constexpr int32 MinSamplesForRejection = 5;
+
+	/** Consecutive rejections after which the next outlier restarts the window instead */
+	static constexpr int32 MaxConsecutiveRejections = 4;
+
+	/** Floor of the robust deviation used for rejection and confidence (input sampling is not finer) */
+	static constexpr float MinDeviationMs = 1.0f;
+
+	/** Rejection threshold in robust standard deviations */
+	float OutlierSigmas = 3.0f;
+
+	/** Fraction trimmed from each end of the sorted window before averaging */
+	float TrimFraction = 0.2f;
+
+	/**
+	 * Add one tap.
+	 * @return False if the sample was rejected as an outlier
+	 */
+	bool AddSample(float OffsetMs);
+
+	/** Drop all samples */
+	void Reset();
+
+	/** Samples currently in the window */
+	int32 Num() const { return Samples.Num(); }
+
+	/** Samples rejected since the last reset */
+	int32 GetNumRejected() const { return NumRejected; }
+
+	/** Trimmed mean of the window, 0 when empty */
+	float GetEstimateMs() const { return EstimateMs; }
+
+	float GetMedianMs() const { return MedianMs; }
+
+	/** Robust standard deviation of the window (1.4826 * median absolute deviation) */
+	float GetDeviationMs() const { return DeviationMs; }
+
+	/** Robust standard error of the estimate, infinite with fewer than two samples */
+	float GetStandardErrorMs() const;
+
+	/** At least MinSamples samples and a standard error within MaxStandardErrorMs */
+	bool IsConverged(int32 MinSamples, float MaxStandardErrorMs) const
+	{
+		return Num() >= MinSamples && GetStandardErrorMs() <= MaxStandardErrorMs;
+	}
+
+private:
+	/** Recompute median, deviation and estimate from the window */
+	void Update();
+
+	/** Ring of the most recent samples */
+	TArray<float, TFixedAllocator<MaxSamples>> Samples;
+	int32 NextSample = 0;
+
+	int32 NumRejected = 0;
+	int32 ConsecutiveRejections = 0;
+	float MedianMs = 0.0f;
+	float DeviationMs = 0.0f;
+	float EstimateMs = 0.0f;
+};
@@ -0,0 +1,123 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Analytic beat clock
+ *
+ * Stores a song-start anchor together with the tempo and derives beat phase,
+ * beat number and tick from a caller-supplied time with a few arithmetic ops.
+ *
+ * The clock holds no engine state: a copy can be queried from any thread.
+ * Time values are in whatever domain the anchor was set in (FPlatformTime::Seconds,
+ * dilated world time, or an audio clock) - callers must stay in that domain.
+ */
+struct UNIVERSALBEAT_API FBeatClock
+{
+	FBeatClock() = default;
+
+	/**
+	 * Anchor the clock so that tick 0 starts at the given time.
+	 *
+	 * @param InAnchorSeconds Time of the first tick (of InStartBeat, if given)
+	 * @param InBPM Tempo in beats per minute (must be > 0)
+	 * @param InTicksPerBeat Internal subdivision (16 = sixteenth note ticks)
+	 * @param InStartBeat Beat position at the anchor (songs starting mid-chart)
+	 */
+	void Start(double InAnchorSeconds, float InBPM, int32 InTicksPerBeat, double InStartBeat = 0.0);
+
+	/** Stop the clock; queries return the "not started" defaults until Start is called again */
+	void Stop();
+
+	/**
+	 * Change tempo at the given time while keeping the beat position continuous.
+	 * Beat number and phase do not jump; only the rate of progression changes.
+	 */
+	void SetBPM(double InTimeSeconds, float InBPM);
+
+	/** Set calibration offset in seconds (positive = beats are perceived later) */
+	void SetOffset(double InOffsetSeconds) { OffsetSeconds = InOffsetSeconds; }
+
+	/** Freeze beat progression at the given time */
+	void Pause(double InTimeSeconds);
+
+	/** Resume beat progression, shifting the anchor by the paused duration */
+	void Resume(double InTimeSeconds);
+
+	/** Move the anchor into another time domain (e.g. real time -> dilated time) without a beat discontinuity */
+	void Rebase(double InOldDomainNow, double InNewDomainNow);
+
+	bool IsStarted() const { return bStarted; }
+	bool IsPaused() const { return bPaused; }
+	float GetBPM() const { return static_cast<float>(60.0 / SecondsPerBeat); }
+	double GetSecondsPerBeat() const { return SecondsPerBeat; }
+	double GetSecondsPerTick() const { return SecondsPerBeat / TicksPerBeat; }
+	int32 GetTicksPerBeat() const { return TicksPerBeat; }
+
+	/** Fractional beats elapsed since the anchor (negative before the first beat) */
+	FORCEINLINE double GetBeatPosition(double InTimeSeconds) const
+	{
+		const double Elapsed = (bPaused ? PausedAtSeconds : InTimeSeconds) - AnchorSeconds - OffsetSeconds;
+		return BeatAtAnchor + Elapsed / SecondsPerBeat;
+	}
+
+	/** Absolute tick counter (MusicalTiming::TicksPerBeat ticks per beat) */
+	FORCEINLINE int64 GetTick(double InTimeSeconds) const
+	{
+		return bStarted ? FMath::FloorToInt64(GetBeatPosition(InTimeSeconds) * TicksPerBeat) : 0;
+	}
+
+	/** Whole beats elapsed since the anchor */
+	FORCEINLINE int32 GetBeatNumber(double InTimeSeconds) const
+	{
+		return bStarted ? FMath::FloorToInt32(GetBeatPosition(InTimeSeconds)) : 0;
+	}
+
+	/**
+	 * Normalized position within the current tick.
+	 *
+	 * @return +1.0 = tick just fired, 0.0 = tick midpoint, -1.0 = next tick about to fire.
+	 *         Returns -1.0 if the clock has not been started.
+	 */
+	FORCEINLINE float GetBeatPhase(double InTimeSeconds) const
+	{
+		if (!bStarted)
+		{
+			return -1.0f;
+		}
+
+		const double TickPosition = GetBeatPosition(InTimeSeconds) * TicksPerBeat;
+		const double TickFraction = TickPosition - FMath::FloorToDouble(TickPosition);
+		return FMath::Clamp(static_cast<float>(1.0 - 2.0 * TickFraction), -1.0f, 1.0f);
+	}
+
+	/** Time at which the given tick fires, in the clock's time domain */
+	FORCEINLINE double GetTickTime(int64 Tick) const
+	{
+		return AnchorSeconds + OffsetSeconds + (static_cast<double>(Tick) / TicksPerBeat - BeatAtAnchor) * SecondsPerBeat;
+	}
+
+private:
+	/** Time at which BeatAtAnchor was reached */
+	double AnchorSeconds = 0.0;
+
+	/** Beat position at AnchorSeconds (non-zero after tempo changes) */
+	double BeatAtAnchor = 0.0;
+
+	/** Calibration offset applied to every query */
+	double OffsetSeconds = 0.0;
+
+	/** Duration of one beat */
+	double SecondsPerBeat = 0.5;
+
+	/** Time at which Pause was called */
+	double PausedAtSeconds = 0.0;
+
+	/** Internal subdivision */
+	int32 TicksPerBeat = 16;
+
+	bool bStarted = false;
+	bool bPaused = false;
+};
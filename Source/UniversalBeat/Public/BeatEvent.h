@@ -0,0 +1,134 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UniversalBeatTypes.h"
+
+class UNoteDataAsset;
+
+/** Kind of a native beat event */
+enum class EBeatEventType : uint8
+{
+	/** Beat or subdivision broadcast (OnBeat) */
+	Beat,
+	/** Note reached its time during chart playback (OnNoteBeat) */
+	Note,
+	/** Timing check performed (OnBeatInputCheck) */
+	InputCheck,
+	/** Tempo change applied (OnBPMChanged) */
+	BPMChanged,
+	/** Note entered the lookahead window (OnNoteApproach) */
+	NoteApproach,
+	/** Note window closed without a hit (OnNoteMissed) */
+	NoteMissed,
+	/** Hold note sustained to its end (OnNoteHoldCompleted) */
+	HoldCompleted,
+};
+
+/**
+ * Compact event pushed through the subsystem's lock-free event queue
+ *
+ * One flat struct for every event kind so the queue holds a single type;
+ * the meaning of the shared fields depends on Type.
+ */
+struct FBeatEvent
+{
+	EBeatEventType Type = EBeatEventType::Beat;
+
+	/** Beat: active subdivision */
+	EBeatSubdivision Subdivision = EBeatSubdivision::None;
+
+	/** Beat: beat number. Note*: compiled note index (INDEX_NONE when fired by the sequencer) */
+	int32 Index = 0;
+
+	/** Beat: subdivision index. Note*: key frame in tick resolution */
+	int32 SubIndex = 0;
+
+	/** Beat: seconds until the tick's ideal time. InputCheck: timing value. BPMChanged: new BPM. NoteApproach: seconds until the note's time. HoldCompleted: head accuracy */
+	float Value = 0.0f;
+
+	/** Beat: ideal FPlatformTime::Seconds() of the tick. Others: when the event was raised, if stamped */
+	double Timestamp = 0.0;
+
+	/** Beat: ideal beat clock time of the tick */
+	double ClockTime = 0.0;
+
+	/** Note*: lane tag. InputCheck: input tag */
+	FGameplayTag Tag;
+
+	/** InputCheck: label */
+	FName Label;
+
+	/** Note*: note asset (kept alive by the chart owner) */
+	UNoteDataAsset* NoteData = nullptr;
+
+	static FBeatEvent MakeBeat(const FBeatEventData& BeatData)
+	{
+		FBeatEvent Event;
+		Event.Type = EBeatEventType::Beat;
+		Event.Subdivision = BeatData.SubdivisionType;
+		Event.Index = BeatData.BeatNumber;
+		Event.SubIndex = BeatData.SubdivisionIndex;
+		Event.Timestamp = BeatData.EventTimestamp;
+		Event.ClockTime = BeatData.BeatClockTime;
+		Event.Value = BeatData.TimeUntil;
+		return Event;
+	}
+
+	static FBeatEvent MakeNote(const FNoteInstance& Note, FGameplayTag NoteTag, int32 NoteIndex = INDEX_NONE, EBeatEventType NoteEventType = EBeatEventType::Note)
+	{
+		FBeatEvent Event;
+		Event.Type = NoteEventType;
+		Event.Index = NoteIndex;
+		Event.SubIndex = Note.Timestamp.Value;
+		Event.Timestamp = FPlatformTime::Seconds();
+		Event.Tag = NoteTag;
+		Event.NoteData = Note.NoteData;
+		return Event;
+	}
+
+	static FBeatEvent MakeInputCheck(FName LabelName, FGameplayTag InputTag, float TimingValue)
+	{
+		FBeatEvent Event;
+		Event.Type = EBeatEventType::InputCheck;
+		Event.Value = TimingValue;
+		Event.Timestamp = FPlatformTime::Seconds();
+		Event.Tag = InputTag;
+		Event.Label = LabelName;
+		return Event;
+	}
+
+	static FBeatEvent MakeBPMChanged(float BPM)
+	{
+		FBeatEvent Event;
+		Event.Type = EBeatEventType::BPMChanged;
+		Event.Value = BPM;
+		Event.Timestamp = FPlatformTime::Seconds();
+		return Event;
+	}
+
+	FBeatEventData ToBeatEventData() const
+	{
+		FBeatEventData BeatData;
+		BeatData.BeatNumber = Index;
+		BeatData.SubdivisionIndex = SubIndex;
+		BeatData.SubdivisionType = Subdivision;
+		BeatData.EventTimestamp = Timestamp;
+		BeatData.BeatClockTime = ClockTime;
+		BeatData.TimeUntil = Value;
+		return BeatData;
+	}
+
+	FNoteInstance ToNoteInstance() const
+	{
+		return FNoteInstance(FFrameNumber(SubIndex), NoteData);
+	}
+};
+
+/** Native listener for single events, called once per event when the queue is drained */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnBeatEventNative, const FBeatEvent& /*Event*/);
+
+/** Native listener for all events of a frame at once, in the order they were raised */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnBeatEventBatchNative, TConstArrayView<FBeatEvent> /*Events*/);
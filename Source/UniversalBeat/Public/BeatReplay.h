@@ -0,0 +1,246 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Tasks/Task.h"
+#include "UniversalBeatTypes.h"
+#include <atomic>
+
+class FArchive;
+class IFileHandle;
+
+/**
+ * Compact binary replay of one player's timing inputs
+ *
+ * Layout: a fixed header (magic, version, BPM and calibration at the start of recording),
+ * then a stream of events. Each event is one header byte (low 2 bits = kind, high 6 bits =
+ * name palette index or control code) followed by its timestamp as a zigzag varint delta in
+ * microseconds. Names (input tags, labels) are written once, the first time they are used,
+ * so a typical press costs 3-4 bytes and a five-minute chart a few KB.
+ *
+ * Note inputs are stamped with the chart time they were judged at, so a pass can be fed
+ * straight to an FBeatSimulation; beat checks and control events with the beat clock time
+ * since recording started. Each timeline is delta-encoded against itself.
+ */
+namespace BeatReplay
+{
+	static constexpr uint32 Magic = 0x50524255; // 'UBRP'
+	static constexpr uint16 Version = 1;
+
+	/** Timestamps are stored in whole microseconds */
+	static constexpr double TicksPerSecond = 1000000.0;
+
+	/** Palette indices fit the header byte below this; the escape value is followed by a varint index */
+	static constexpr int32 InlineNameLimit = 63;
+
+	/** Header byte kind of control events; their EBeatReplayEventType (from PassStart) goes in the high bits */
+	static constexpr uint8 ControlKind = 3;
+
+	/** Control code defining the next palette name (varint length + UTF-8, no timestamp) */
+	static constexpr uint8 DefineNameCode = 3;
+}
+
+/** Kind of a replay event */
+enum class EBeatReplayEventType : uint8
+{
+	/** Note input press (chart time) */
+	Press,
+
+	/** Note input release (chart time) */
+	Release,
+
+	/** Beat timing check by label, or by tag without a chart (clock time) */
+	BeatCheck,
+
+	/** A chart pass started or looped (clock time); note inputs after it belong to the new pass */
+	PassStart,
+
+	/** Tempo change applied (clock time, Value = BPM) */
+	TempoChange,
+
+	/** Calibration offset changed (clock time, Value = milliseconds) */
+	CalibrationChange
+};
+
+/** One decoded replay event */
+struct FBeatReplayEvent
+{
+	EBeatReplayEventType Type = EBeatReplayEventType::Press;
+
+	/** Chart time for Press/Release, seconds since recording started for everything else */
+	double Time = 0.0;
+
+	/** Input tag or label name (Press, Release, BeatCheck) */
+	FName Name;
+
+	/** BPM or calibration milliseconds (TempoChange, CalibrationChange) */
+	float Value = 0.0f;
+};
+
+/**
+ * Records timing inputs into a preallocated ring buffer
+ *
+ * Recording encodes into the ring with no allocation; once a chunk has accumulated it is
+ * written to the sink by a background task while recording continues behind it. When the
+ * ring is full (the sink cannot keep up) events are dropped and counted, never blocked on.
+ * Record* calls must come from one thread (the game thread).
+ */
+class UNIVERSALBEAT_API FBeatReplayRecorder
+{
+public:
+	/** Ring capacity: minutes of dense play, so a healthy sink never lets it fill */
+	static constexpr int32 DefaultCapacity = 64 * 1024;
+
+	/** Bytes accumulated before a background flush is started */
+	static constexpr int32 FlushThreshold = 4 * 1024;
+
+	FBeatReplayRecorder() = default;
+	~FBeatReplayRecorder();
+
+	FBeatReplayRecorder(const FBeatReplayRecorder&) = delete;
+	FBeatReplayRecorder& operator=(const FBeatReplayRecorder&) = delete;
+
+	/**
+	 * Start recording to a file (replaces a recording in progress).
+	 * @param ClockTime Beat clock time recording starts at (origin of the clock timeline)
+	 * @return False if the file could not be opened
+	 */
+	bool Start(const FString& Filename, double ClockTime, float BPM, float CalibrationOffsetMs);
+
+	/** Start recording into memory; the bytes are available from GetRecordedBytes after Stop */
+	void StartInMemory(double ClockTime, float BPM, float CalibrationOffsetMs);
+
+	/** Flush everything, close the sink and stop recording */
+	void Stop();
+
+	bool IsRecording() const { return bRecording; }
+
+	void RecordInput(FGameplayTag InputTag, double ChartTime, bool bRelease)
+	{
+		RecordNamed(bRelease ? EBeatReplayEventType::Release : EBeatReplayEventType::Press, InputTag.GetTagName(), ChartTime, LastChartTicks);
+	}
+
+	void RecordBeatCheck(FName Name, double ClockTime)
+	{
+		RecordNamed(EBeatReplayEventType::BeatCheck, Name, ClockTime - StartClockTime, LastClockTicks);
+	}
+
+	void RecordPassStart(double ClockTime) { RecordControl(EBeatReplayEventType::PassStart, ClockTime, nullptr); }
+	void RecordTempoChange(double ClockTime, float BPM) { RecordControl(EBeatReplayEventType::TempoChange, ClockTime, &BPM); }
+	void RecordCalibrationChange(double ClockTime, float OffsetMs) { RecordControl(EBeatReplayEventType::CalibrationChange, ClockTime, &OffsetMs); }
+
+	/** Events lost because the ring was full */
+	int32 GetNumDroppedEvents() const { return NumDroppedEvents; }
+
+	/** Bytes recorded so far, header included */
+	uint64 GetNumBytesRecorded() const { return WritePosition; }
+
+	/** Bytes of the last in-memory recording */
+	const TArray<uint8>& GetRecordedBytes() const { return MemorySink; }
+
+private:
+	void Open(double ClockTime, float BPM, float CalibrationOffsetMs, int32 Capacity);
+	void RecordNamed(EBeatReplayEventType Type, FName Name, double Seconds, int64& LastTicks);
+	void RecordControl(EBeatReplayEventType Type, double ClockTime, const float* Value);
+
+	/**
+	 * Append encoded bytes to the ring, or drop them if they do not fit.
+	 * @return False if dropped
+	 */
+	bool Append(const uint8* Bytes, int32 NumBytes);
+
+	/** Start a background flush of everything written so far, unless one is running */
+	void KickFlush();
+
+	/** Write ring bytes [Begin, End) to the sink (flusher only) */
+	void WriteToSink(uint64 Begin, uint64 End);
+
+	/** Ring storage, allocated once per recording; capacity is a power of two */
+	TArray<uint8> Ring;
+	uint64 RingMask = 0;
+
+	/** Total bytes appended (game thread) */
+	uint64 WritePosition = 0;
+
+	/** Total bytes handed to the sink (written by the flusher, read by the game thread) */
+	std::atomic<uint64> FlushedPosition{ 0 };
+
+	/** Write position the running or last flush was started for */
+	uint64 FlushRequestedPosition = 0;
+
+	UE::Tasks::FTask FlushTask;
+
+	/** File sink, null when recording to memory */
+	TUniquePtr<IFileHandle> FileSink;
+	TArray<uint8> MemorySink;
+
+	/** Names defined so far, in palette order */
+	TArray<FName> NamePalette;
+
+	double StartClockTime = 0.0;
+	int64 LastChartTicks = 0;
+	int64 LastClockTicks = 0;
+	int32 NumDroppedEvents = 0;
+	bool bRecording = false;
+};
+
+/**
+ * Streams events back out of a replay
+ */
+class UNIVERSALBEAT_API FBeatReplayReader
+{
+public:
+	/** Read from an archive the caller keeps alive; reads the header */
+	explicit FBeatReplayReader(FArchive& InArchive);
+
+	/** Header matched and the stream has not hit corrupt data */
+	bool IsValid() const { return bValid; }
+
+	/** BPM and calibration at the start of the recording */
+	float GetStartBPM() const { return StartBPM; }
+	float GetStartCalibrationOffsetMs() const { return StartCalibrationOffsetMs; }
+
+	/**
+	 * Decode the next event.
+	 * @return False at the end of the stream or on corrupt data
+	 */
+	bool ReadEvent(FBeatReplayEvent& OutEvent);
+
+	/**
+	 * Collect the note inputs of the next chart pass, ready for FBeatSimulation::Inputs.
+	 * A pass runs from a pass start (or the beginning of the stream) to the next pass start;
+	 * tempo and calibration events along the way update GetCurrentBPM/GetCurrentCalibrationOffsetMs.
+	 * @return False once there is no pass left
+	 */
+	bool ReadPass(TArray<FBeatInputEvent>& OutInputs);
+
+	float GetCurrentBPM() const { return CurrentBPM; }
+	float GetCurrentCalibrationOffsetMs() const { return CurrentCalibrationOffsetMs; }
+
+private:
+	bool ReadVarint(uint64& OutValue);
+	bool ReadSignedDelta(int64& InOutTicks);
+
+	FArchive& Archive;
+
+	TArray<FName> NamePalette;
+
+	/** Tags resolved once per palette entry (parallel to NamePalette, empty for labels) */
+	TArray<FGameplayTag> TagPalette;
+
+	/** Decoded event held back by ReadPass when it ends a pass */
+	TOptional<FBeatReplayEvent> PendingEvent;
+
+	/** Palette index of the last named event decoded */
+	int32 LastNameIndex = INDEX_NONE;
+
+	int64 LastChartTicks = 0;
+	int64 LastClockTicks = 0;
+	float StartBPM = 0.0f;
+	float StartCalibrationOffsetMs = 0.0f;
+	float CurrentBPM = 0.0f;
+	float CurrentCalibrationOffsetMs = 0.0f;
+	bool bValid = false;
+};
@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CompiledNoteChart.h"
+#include "NoteJudgement.h"
+#include "UniversalBeatTypes.h"
+
+/**
+ * One independent judgement stream (a player on a server, a replay being verified)
+ *
+ * Owns its consumption state, calibration and input queue; the compiled chart is shared
+ * read-only between sessions playing the same track. Sessions are judged together once
+ * per frame, in parallel, by UUniversalBeatSubsystem.
+ */
+struct UNIVERSALBEAT_API FBeatSession
+{
+	/** Chart this session is judged against */
+	TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> Chart;
+
+	/** Consumption and lane cursors of this session */
+	FNoteJudgementState State;
+
+	/** Per-session calibration: subtracted from input timestamps before judgement */
+	double CalibrationOffsetSeconds = 0.0;
+
+	/** Inputs queued since the last evaluation (chart time) */
+	TArray<FBeatInputEvent> PendingInputs;
+
+	/** Inputs judged in the last evaluation, in queue order */
+	TArray<FBeatInputEvent> JudgedInputs;
+
+	/** Results of the last evaluation, parallel to JudgedInputs */
+	TArray<FNoteJudgement> Results;
+
+	/** Hits in the last evaluation */
+	int32 NumHits = 0;
+
+	/** Generation of the slot this session lives in (see FBeatSessionHandle::Serial) */
+	uint32 Serial = 0;
+
+	/** Keeps the chart's note assets reachable (reported by the owning subsystem) */
+	TArray<TObjectPtr<UNoteDataAsset>> NoteAssets;
+
+	/** Chart to create sessions against; windows are rebaked by the subsystem on tempo changes */
+	void SetChart(const TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe>& InChart);
+
+	/**
+	 * Judge all pending inputs in timestamp order (safe to call from a worker thread).
+	 * Sessions have no clock: a hold is scored when its release is judged, not when its sustain ends.
+	 */
+	void Evaluate();
+};
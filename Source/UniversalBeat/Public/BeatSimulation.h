@@ -0,0 +1,125 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CompiledNoteChart.h"
+#include "NoteJudgement.h"
+#include "UniversalBeatTypes.h"
+
+class USongConfiguration;
+
+/**
+ * How an autoplay bot plays a chart
+ *
+ * The same policy and chart always produce the same inputs: press errors come from a
+ * random stream seeded with Seed, never from the clock.
+ */
+struct UNIVERSALBEAT_API FBeatAutoplayPolicy
+{
+	/** Standard deviation of the press timing error in seconds (0 = every press on the note) */
+	float TimingErrorSeconds = 0.0f;
+
+	/** Added to every press in seconds (positive = late), e.g. to model an uncalibrated player */
+	float TimingBiasSeconds = 0.0f;
+
+	/** Chance (0-1) to skip a note entirely */
+	float MissChance = 0.0f;
+
+	/** Chance (0-1) to let go of a hold during the first half of its sustain */
+	float DropHoldChance = 0.0f;
+
+	int32 Seed = 0;
+};
+
+/** Totals of one simulation run, computed without touching any UObject */
+struct FBeatSimulationSummary
+{
+	/** Presses and releases judged */
+	int32 NumInputs = 0;
+
+	/** Notes hit (hold ends excluded) */
+	int32 NumHits = 0;
+
+	/** Notes whose window closed without a hit */
+	int32 NumMissed = 0;
+
+	/** Holds sustained to their end, by a release or by completion */
+	int32 NumHoldsCompleted = 0;
+
+	/** Holds let go too early */
+	int32 NumHoldsDropped = 0;
+
+	/** Sum of the accuracy of all hits */
+	double AccuracySum = 0.0;
+
+	float GetMeanAccuracy() const { return NumHits > 0 ? static_cast<float>(AccuracySum / NumHits) : 0.0f; }
+};
+
+/**
+ * Headless playthrough of one input stream over one compiled chart
+ *
+ * Runs the judgement path of live play (NoteJudgement::JudgeInput/JudgeRelease, hold completion
+ * and the miss sweep) on a deterministic clock that only advances to each input's timestamp,
+ * so a chart plays as fast as it can be judged. Run() touches only this object and reads the
+ * chart, so simulations of a shared chart can run on any threads; the chart's windows must be
+ * baked beforehand and not rebaked while they run.
+ *
+ * Timestamps are chart time, as for CheckBeatTimingBatch and judgement sessions. One run is one
+ * pass of the chart: loops are not replayed. Live play settles holds and misses once per frame
+ * rather than at each input, which only differs for an input judged after a frame that already
+ * swept its note's window closed.
+ */
+struct UNIVERSALBEAT_API FBeatSimulation
+{
+	/** Chart to play */
+	TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> Chart;
+
+	/** Inputs in chart time; sorted stably by timestamp by Run() */
+	TArray<FBeatInputEvent> Inputs;
+
+	/** Subtracted from input timestamps before judgement */
+	double CalibrationOffsetSeconds = 0.0;
+
+	/** Judgement of each input (parallel to Inputs) */
+	TArray<FNoteJudgement> Results;
+
+	/** Holds completed by reaching their sustain end, in completion order */
+	TArray<FNoteJudgement> CompletedHolds;
+
+	/** Judgement state after the run */
+	FNoteJudgementState State;
+
+	FBeatSimulationSummary Summary;
+
+	/** Judge every input, then complete the remaining holds and sweep the rest of the chart */
+	void Run();
+
+	/**
+	 * Blueprint-facing results of the run, identical to what live play reports for the same inputs.
+	 * Resolves note assets: call on the game thread.
+	 */
+	void GetValidationResults(TArray<FNoteValidationResult>& OutResults) const;
+};
+
+namespace BeatSimulation
+{
+	/**
+	 * Generate the inputs of an autoplay bot: one press per note, holds sustained to completion
+	 * unless dropped, and one release per Release note.
+	 * @param OutInputs Receives the inputs in timestamp order (chart time)
+	 */
+	UNIVERSALBEAT_API void MakeAutoplayInputs(const FCompiledNoteChart& Chart, const FBeatAutoplayPolicy& Policy, TArray<FBeatInputEvent>& OutInputs);
+
+	/** Run many simulations in parallel on the task graph; blocks until all are done */
+	UNIVERSALBEAT_API void RunBatch(TArrayView<FBeatSimulation> Simulations);
+
+	/**
+	 * Compile one chart per track of a song, baked for simulation (game thread: may load sequences).
+	 * Cooked charts are used when the song has them, otherwise the track sequences are compiled.
+	 * @param BPM Window BPM for charts without a tempo map
+	 * @param OutTrackCharts One chart per entry of Song.Tracks, null for tracks without notes
+	 * @return Number of tracks with notes
+	 */
+	UNIVERSALBEAT_API int32 CompileSongCharts(USongConfiguration& Song, float BPM, TArray<TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe>>& OutTrackCharts);
+}
@@ -0,0 +1,42 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Pluggable time source for the UniversalBeat subsystem
+ *
+ * Provides the time domain the beat clock and note chart are evaluated in.
+ * The default (no source set) is real time or dilated world time; a song-position
+ * source reports seconds since the music started, e.g. driven by the audio render clock.
+ */
+class UNIVERSALBEAT_API IBeatTimingSource
+{
+public:
+	virtual ~IBeatTimingSource() = default;
+
+	/** Current time in this source's domain (seconds). Game thread unless the source documents otherwise. */
+	virtual double GetTimeSeconds() const = 0;
+
+	/** True if GetTimeSeconds() is the song playback position (0 = start of the music) */
+	virtual bool IsSongPositionSource() const { return false; }
+
+	/** True once the source has produced a usable time value */
+	virtual bool IsReady() const { return true; }
+
+	/** Per-frame game-thread update (drain render-thread samples, etc.) */
+	virtual void Tick() {}
+
+	/** Release engine resources; called before the subsystem drops its reference */
+	virtual void Shutdown() {}
+};
+
+/**
+ * Real-time source (FPlatformTime::Seconds)
+ */
+class UNIVERSALBEAT_API FPlatformTimingSource : public IBeatTimingSource
+{
+public:
+	virtual double GetTimeSeconds() const override { return FPlatformTime::Seconds(); }
+};
@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+
+/**
+ * Fixed-bin histogram of millisecond samples
+ *
+ * Recording is a clamp, a multiply and an increment: no allocation, no sorting.
+ * Samples outside [MinMs, MaxMs) land in the edge bins but still count towards
+ * the exact min, max and mean. Percentiles are resolved to a bin and interpolated
+ * within it, so they are accurate to one bin width.
+ */
+struct UNIVERSALBEAT_API FBeatTimingHistogram
+{
+	static constexpr int32 NumBins = 64;
+
+	FBeatTimingHistogram(float InMinMs, float InMaxMs);
+
+	/** Add one sample */
+	FORCEINLINE void Record(float Ms)
+	{
+		const int32 Bin = FMath::Clamp(static_cast<int32>((Ms - MinMs) * BinsPerMs), 0, NumBins - 1);
+		++Bins[Bin];
+		++NumSamples;
+		SumMs += Ms;
+		MinSampleMs = FMath::Min(MinSampleMs, Ms);
+		MaxSampleMs = FMath::Max(MaxSampleMs, Ms);
+	}
+
+	/** Drop all samples, keep the range */
+	void Reset();
+
+	/** Sample value below which Percentile (0-100) of the samples fall, 0 when empty */
+	float GetPercentile(float Percentile) const;
+
+	float GetMean() const { return NumSamples > 0 ? static_cast<float>(SumMs / NumSamples) : 0.0f; }
+	float GetMin() const { return NumSamples > 0 ? MinSampleMs : 0.0f; }
+	float GetMax() const { return NumSamples > 0 ? MaxSampleMs : 0.0f; }
+	uint32 Num() const { return NumSamples; }
+
+	float GetRangeMin() const { return MinMs; }
+	float GetRangeMax() const { return MaxMs; }
+	float GetBinWidth() const { return 1.0f / BinsPerMs; }
+	uint32 GetBinCount(int32 Bin) const { return Bins[Bin]; }
+
+private:
+	TStaticArray<uint32, NumBins> Bins;
+	float MinMs;
+	float MaxMs;
+	float BinsPerMs;
+	uint32 NumSamples = 0;
+	double SumMs = 0.0;
+	float MinSampleMs = TNumericLimits<float>::Max();
+	float MaxSampleMs = TNumericLimits<float>::Lowest();
+};
+
+/**
+ * Timing measurements of one subsystem, kept since the last reset
+ */
+struct UNIVERSALBEAT_API FBeatTimingStats
+{
+	/** Frame a beat tick was delivered on minus its ideal time (positive = late, negative = ahead) */
+	FBeatTimingHistogram TickJitter{ -4.0f, 28.0f };
+
+	/** Time from the input (as stamped by the input preprocessor) to its judgement */
+	FBeatTimingHistogram InputLatency{ 0.0f, 64.0f };
+
+	/** Input time minus note time of note hits (negative = early) */
+	FBeatTimingHistogram JudgementOffset{ -160.0f, 160.0f };
+
+	/** Beat ticks crossed */
+	uint32 NumBeatTicks = 0;
+
+	/** Inputs judged against a note chart or the beat */
+	uint32 NumTimingChecks = 0;
+
+	/** Inputs that hit a note */
+	uint32 NumNoteHits = 0;
+
+	/** Notes whose window closed without a hit */
+	uint32 NumNotesMissed = 0;
+
+	void Reset();
+
+	/** Multi-line summary (count, mean, p50/p95/p99, min/max per histogram) */
+	FString ToString() const;
+};
@@ -0,0 +1,262 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UniversalBeatTypes.h"
+#include "MusicalTiming.h"
+#include "TempoMap.h"
+#include "TimingCurveLUT.h"
+
+class ULevelSequence;
+class UMovieSceneNoteChartSection;
+class UNoteDataAsset;
+struct FCompiledNoteChart;
+
+/**
+ * One source chart placed on a merged timeline (see FCompiledNoteChart::Merge)
+ */
+struct FCompiledNoteChartLayer
+{
+	const FCompiledNoteChart* Chart = nullptr;
+
+	/** Source time that lands on OffsetSeconds, usually the sequence playback range start */
+	double RangeStartSeconds = 0.0;
+
+	/** Length of one pass; notes outside [RangeStartSeconds, RangeStartSeconds + PassSeconds) are left out (0 = one pass of every note) */
+	double PassSeconds = 0.0;
+
+	/** Merged time of the first pass (e.g. FNoteTrackEntry::DelayOffset) */
+	double OffsetSeconds = 0.0;
+
+	/** Back-to-back passes (1 + FNoteTrackEntry::LoopCount) */
+	int32 NumPasses = 1;
+};
+
+/**
+ * Runtime note chart in structure-of-arrays form
+ *
+ * Built once per sequence from the note channels of all active note chart sections.
+ * Per-note data lives in parallel arrays sorted by time; per-lane (gameplay tag) data is
+ * stored flat and grouped by lane so a lookup touches only contiguous memory of one lane.
+ * The hot path never dereferences a UNoteDataAsset: tags, windows and interaction types
+ * are copied out of the assets at compile time.
+ *
+ * NoteAssets is not reported to the garbage collector; the owner must keep the assets
+ * reachable (the source sequence, or an explicit UPROPERTY mirror).
+ */
+struct UNIVERSALBEAT_API FCompiledNoteChart
+{
+	/** Hold notes score one tick per sixteenth note of sustain */
+	static constexpr int32 SustainTicksPerBeat = 4;
+
+	// ====================================================================
+	// Per-note data (index = note index, ascending time)
+	// ====================================================================
+
+	/** Note times in seconds from sequence start */
+	TArray<double> NoteSeconds;
+
+	/** Source key frame in the sequence tick resolution */
+	TArray<FFrameNumber> NoteFrames;
+
+	/** Lane of each note (index into Lanes) */
+	TArray<uint16> NoteLanes;
+
+	/** Source asset of each note (index into NoteAssets) */
+	TArray<uint16> NoteAssetIndices;
+
+	/** Packed timing windows: low nibble = PreTiming, high nibble = PostTiming (EMusicalNoteValue) */
+	TArray<uint8> NoteWindows;
+
+	/** Window close time in seconds at the baked BPM (miss detection walks this in note order) */
+	TArray<double> NoteWindowEnd;
+
+	/** Sustain end in seconds from sequence start; equals NoteSeconds for everything but Hold notes */
+	TArray<double> NoteEndSeconds;
+
+	// ====================================================================
+	// Per-lane data
+	// ====================================================================
+
+	/** Gameplay tag of each lane */
+	TArray<FGameplayTag> Lanes;
+
+	/** Start of each lane's entries in the Lane* arrays; Lanes.Num() + 1 entries */
+	TArray<int32> LaneOffsets;
+
+	/** Note indices grouped by lane, time order within a lane */
+	TArray<int32> LaneNoteIndices;
+
+	/** Note seconds grouped by lane (parallel to LaneNoteIndices, binary-searchable) */
+	TArray<double> LaneNoteSeconds;
+
+	/** Window bounds in seconds at the baked BPM (parallel to LaneNoteIndices) */
+	TArray<double> LaneWindowStart;
+	TArray<double> LaneWindowEnd;
+
+	/** Widest pre/post window per lane at the baked BPM, bounds lane searches */
+	TArray<float> LaneMaxPreWindow;
+	TArray<float> LaneMaxPostWindow;
+
+	// ====================================================================
+	// Asset palette
+	// ====================================================================
+
+	/** Unique note assets referenced by the chart */
+	TArray<TObjectPtr<UNoteDataAsset>> NoteAssets;
+
+	/** Interaction type per asset (parallel to NoteAssets) */
+	TArray<ENoteInteractionType> AssetInteractionTypes;
+
+	/** Index into AccuracyCurves per asset, INDEX_NONE = linear accuracy (parallel to NoteAssets) */
+	TArray<int16> AssetAccuracyCurves;
+
+	/** Baked accuracy curves of the assets that have one */
+	TArray<FTimingCurveLUT> AccuracyCurves;
+
+	/** Tempo keys of the chart's tracks; when present, windows are baked from it instead of a BPM */
+	FTempoMap TempoMap;
+
+	/** BPM the lane windows were baked at */
+	float BakedBPM = 0.0f;
+
+	/** Window length per note value at the last baked BPM (rebuilt by BakeWindows only when the BPM changes) */
+	MusicalTiming::FNoteWindowTable WindowTable;
+
+public:
+	/**
+	 * Compile all active note chart sections of a sequence.
+	 * @return True if at least one note was compiled
+	 */
+	bool CompileFromSequence(const ULevelSequence* Sequence);
+
+	/** Append the keys of all active note chart sections of a sequence (call Finalize when done) */
+	void AddSequence(const ULevelSequence* Sequence);
+
+	/** Append the keys of one section (call Finalize when done) */
+	void AddSection(const UMovieSceneNoteChartSection& Section, FFrameRate TickResolution);
+
+	/** Sort notes by time and build the lane arrays (windows are baked separately) */
+	void Finalize();
+
+	/**
+	 * Replace this chart with finalized source charts laid out on one timeline.
+	 * The sources are already time-ordered, so notes are merged k ways in one pass instead of re-sorted;
+	 * lanes and assets are unified by tag and asset. Note frames stay in their source sequence's ticks.
+	 * The tempo map of the first layer that has one is carried over, repeated per pass; layers are expected
+	 * to share a tempo. Windows are baked separately; no layer may refer to this chart.
+	 */
+	void Merge(TConstArrayView<FCompiledNoteChartLayer> Layers);
+
+	/** Recompute lane window bounds for a BPM (ignored in favour of the tempo map when the chart has one) */
+	void BakeWindows(float BPM);
+
+	/** Whether window bounds are independent of the subsystem BPM */
+	bool HasTempoMap() const { return !TempoMap.IsEmpty(); }
+
+	/** Remove all notes and lanes */
+	void Reset();
+
+	/**
+	 * Serialize the per-note and per-lane arrays as raw memory (cooked chart blobs).
+	 * Lanes and NoteAssets are not part of the blob; bind them with BindPalette after loading.
+	 * The tempo map is included; baked windows are not serialized.
+	 */
+	void SerializeArrays(FArchive& Ar);
+
+	/** Attach the lane tags and note assets a loaded blob's indices refer to */
+	void BindPalette(const TArray<FGameplayTag>& InLanes, const TArray<TObjectPtr<UNoteDataAsset>>& InNoteAssets);
+
+	/** Rebuild the per-asset arrays (interaction types, accuracy curves) from NoteAssets */
+	void BindAssetData();
+
+	int32 Num() const { return NoteSeconds.Num(); }
+	int32 NumLanes() const { return Lanes.Num(); }
+	bool IsEmpty() const { return NoteSeconds.Num() == 0; }
+
+	/** Find the lane for a tag, INDEX_NONE if the chart has no notes with it */
+	int32 FindLane(FGameplayTag Tag) const { return Lanes.IndexOfByKey(Tag); }
+
+	/** First entry of a lane in the Lane* arrays */
+	int32 GetLaneBegin(int32 LaneIndex) const { return LaneOffsets[LaneIndex]; }
+
+	/** One past the last entry of a lane in the Lane* arrays */
+	int32 GetLaneEnd(int32 LaneIndex) const { return LaneOffsets[LaneIndex + 1]; }
+
+	/** Unpack a note's timing windows */
+	FORCEINLINE EMusicalNoteValue GetPreTiming(int32 NoteIndex) const { return static_cast<EMusicalNoteValue>(NoteWindows[NoteIndex] & 0x0F); }
+	FORCEINLINE EMusicalNoteValue GetPostTiming(int32 NoteIndex) const { return static_cast<EMusicalNoteValue>(NoteWindows[NoteIndex] >> 4); }
+
+	/** Timing windows of a note in seconds at the given BPM */
+	FORCEINLINE void GetWindowSeconds(int32 NoteIndex, float BPM, float& OutPreSeconds, float& OutPostSeconds) const
+	{
+		OutPreSeconds = MusicalTiming::NoteValueToSeconds(GetPreTiming(NoteIndex), BPM);
+		OutPostSeconds = MusicalTiming::NoteValueToSeconds(GetPostTiming(NoteIndex), BPM);
+	}
+
+	/** Timing windows of a note in seconds under the chart's tempo map */
+	void GetTempoMappedWindowSeconds(int32 NoteIndex, float& OutPreSeconds, float& OutPostSeconds) const;
+
+	/** Note asset of a note */
+	UNoteDataAsset* GetNoteAsset(int32 NoteIndex) const { return NoteAssets[NoteAssetIndices[NoteIndex]]; }
+
+	/** Gameplay tag of a note */
+	const FGameplayTag& GetNoteTag(int32 NoteIndex) const { return Lanes[NoteLanes[NoteIndex]]; }
+
+	/** Interaction type of a note */
+	ENoteInteractionType GetInteractionType(int32 NoteIndex) const { return AssetInteractionTypes[NoteAssetIndices[NoteIndex]]; }
+
+	/** Whether a note is a Hold with a sustain to track */
+	bool IsSustained(int32 NoteIndex) const { return NoteEndSeconds[NoteIndex] > NoteSeconds[NoteIndex]; }
+
+	/** Fractional beat position of a chart time, under the tempo map or at the baked BPM */
+	double SecondsToChartBeats(double Seconds) const { return HasTempoMap() ? TempoMap.SecondsToBeats(Seconds) : Seconds * BakedBPM / 60.0; }
+
+	/**
+	 * Sustain ticks (sixteenth notes) of a note's hold elapsed by a chart time, clamped to the sustain.
+	 * Counted from the beat grid, so a hold is scored from its two endpoints alone.
+	 */
+	int32 GetSustainTicks(int32 NoteIndex, double Seconds) const;
+
+	/** Shape a linear accuracy through the note's accuracy curve, if its asset has one */
+	FORCEINLINE float ApplyAccuracyCurve(int32 NoteIndex, float LinearAccuracy) const
+	{
+		const int16 CurveIndex = AssetAccuracyCurves[NoteAssetIndices[NoteIndex]];
+		return CurveIndex != INDEX_NONE ? AccuracyCurves[CurveIndex].Evaluate(LinearAccuracy) : LinearAccuracy;
+	}
+
+	/** Reconstruct a Blueprint-facing note instance */
+	FNoteInstance MakeNoteInstance(int32 NoteIndex) const { return FNoteInstance(NoteFrames[NoteIndex], GetNoteAsset(NoteIndex)); }
+
+	/** Heap memory used by the chart */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	/** Append the AssetAccuracyCurves entry of a newly added palette asset */
+	void AddAccuracyCurve(const UNoteDataAsset* NoteData);
+
+	/** Build the lane arrays from time-ordered per-note arrays and drop baked windows */
+	void BuildLanes();
+};
+
+/**
+ * Contiguous run of compiled notes in time order, viewed in place
+ */
+struct FCompiledNoteRange
+{
+	const FCompiledNoteChart* Chart = nullptr;
+
+	/** First compiled note index of the range */
+	int32 FirstNote = 0;
+
+	int32 NumNotes = 0;
+
+	int32 Num() const { return NumNotes; }
+	bool IsEmpty() const { return NumNotes == 0; }
+
+	TConstArrayView<double> GetNoteSeconds() const { return Chart ? MakeArrayView(Chart->NoteSeconds).Slice(FirstNote, NumNotes) : TConstArrayView<double>(); }
+	TConstArrayView<uint16> GetNoteLanes() const { return Chart ? MakeArrayView(Chart->NoteLanes).Slice(FirstNote, NumNotes) : TConstArrayView<uint16>(); }
+	TConstArrayView<uint16> GetNoteAssetIndices() const { return Chart ? MakeArrayView(Chart->NoteAssetIndices).Slice(FirstNote, NumNotes) : TConstArrayView<uint16>(); }
+};
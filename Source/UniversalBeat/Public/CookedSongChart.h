@@ -0,0 +1,58 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CompiledNoteChart.h"
+
+class USongConfiguration;
+
+/**
+ * Precompiled note charts for every track of a song
+ *
+ * Written at cook time from a USongConfiguration and its track sequences, stored as a
+ * binary blob in the song asset and read back with raw array copies (no track/section
+ * walk, no sort). All track charts index one song-wide lane and note asset palette,
+ * which the song asset keeps as regular UPROPERTY references.
+ */
+struct UNIVERSALBEAT_API FCookedSongChart
+{
+	/** One track of the song */
+	struct FTrack
+	{
+		/** Delay in seconds before the track starts (mirrors FNoteTrackEntry) */
+		float DelayOffset = 0.0f;
+
+		/** Loop count (mirrors FNoteTrackEntry) */
+		int32 LoopCount = 0;
+
+		/** Compiled chart of the track's sequence */
+		TSharedRef<FCompiledNoteChart, ESPMode::ThreadSafe> Chart = MakeShared<FCompiledNoteChart, ESPMode::ThreadSafe>();
+	};
+
+	/** Blob identifier and layout version; a mismatch falls back to compiling from the sequences */
+	static constexpr uint32 BlobMagic = 0x43434255; // 'UBCC'
+	static constexpr uint32 BlobVersion = 3;
+
+	/** Tracks in USongConfiguration::Tracks order */
+	TArray<FTrack> Tracks;
+
+	/** Serialize all tracks (header + raw chart arrays) */
+	void Serialize(FArchive& Ar);
+
+	/**
+	 * Read a cooked blob and bind it to the song's palette.
+	 * @return False if the blob is empty, truncated or from another version
+	 */
+	bool LoadFromBytes(TConstArrayView<uint8> Bytes, const TArray<FGameplayTag>& Lanes, const TArray<TObjectPtr<UNoteDataAsset>>& NoteAssets);
+
+#if WITH_EDITOR
+	/**
+	 * Compile every track of a song, loading its sequences.
+	 * @param OutLanes Song-wide lane palette the charts index into
+	 * @param OutNoteAssets Song-wide note asset palette the charts index into
+	 * @return True if at least one track compiled
+	 */
+	bool BuildFromSong(const USongConfiguration& Song, TArray<FGameplayTag>& OutLanes, TArray<TObjectPtr<UNoteDataAsset>>& OutNoteAssets);
+#endif
+};
@@ -22,16 +22,21 @@ struct UNIVERSALBEAT_API FNoteChannelValue
 	UPROPERTY(EditAnywhere, Category = "Note")
 	TObjectPtr<UNoteDataAsset> NoteData = nullptr;
 
+	/** Sustain length of Hold notes in the sequence tick resolution (ignored for other interaction types) */
+	UPROPERTY(EditAnywhere, Category = "Note")
+	FFrameNumber HoldDuration = 0;
+
 	FNoteChannelValue() = default;
 	
-	explicit FNoteChannelValue(UNoteDataAsset* InNoteData)
+	explicit FNoteChannelValue(UNoteDataAsset* InNoteData, FFrameNumber InHoldDuration = 0)
 		: NoteData(InNoteData)
+		, HoldDuration(InHoldDuration)
 	{}
 
 	/** Comparison for sorting/deduplication */
 	bool operator==(const FNoteChannelValue& Other) const
 	{
-		return NoteData == Other.NoteData;
+		return NoteData == Other.NoteData && HoldDuration == Other.HoldDuration;
 	}
 
 	bool operator!=(const FNoteChannelValue& Other) const
@@ -92,6 +97,19 @@ public:
 	 */
 	virtual int32 GetIndex(FKeyHandle Handle) override;
 
+	/**
+	 * Delete all keys in [StartFrame, EndFrame] (both inclusive) in one pass
+	 * @return Number of keys deleted
+	 */
+	int32 DeleteKeysInRange(FFrameNumber StartFrame, FFrameNumber EndFrame);
+
+	/**
+	 * Move every key in one pass, keeping handles valid
+	 * Remap must be non-decreasing so the keys stay sorted (snapping and quantizing are)
+	 * @return Number of keys whose time changed
+	 */
+	int32 RemapKeyTimes(TFunctionRef<FFrameNumber(FFrameNumber)> Remap);
+
 private:
 	/** Array of times for each key (frame numbers) */
 	UPROPERTY(meta=(KeyTimes))
@@ -11,10 +11,14 @@
 #include "MovieSceneNoteChannel.h"
 #include "MovieSceneNoteChartSection.generated.h"
 
+class UUniversalBeatSubsystem;
+struct FTempoMap;
+
 /**
  * Movie scene section that contains note chart data
  * Uses channel-based storage following event section patterns
- * Implements entity provider for frame-accurate note triggering
+ * Implements entity provider for frame-accurate note triggering: the section imports one
+ * entity, and UMovieSceneNoteChartSystem fires the keys playback crosses from a cursor
  */
 UCLASS()
 class UNIVERSALBEAT_API UMovieSceneNoteChartSection : public UMovieSceneSection, public IMovieSceneEntityProvider
@@ -32,10 +36,6 @@ public:
 	UPROPERTY()
 	TArray<FNoteInstance> Notes_DEPRECATED;
 
-	/** Transient cache for runtime queries to avoid allocations during playback */
-	UPROPERTY(Transient)
-	TArray<FNoteInstance> RuntimeNotes;
-
 	/** Snap grid resolution for note placement in editor */
 	UPROPERTY(EditAnywhere, Category = "Note Chart")
 	EMusicalNoteValue SnapGridResolution;
@@ -61,7 +61,7 @@ public:
 
 	/**
 	 * Add a note to the section at the specified timestamp
-	 * Adds to both channel and runtime notes array
+	 * Expands the section range to contain the note
 	 */
 	FKeyHandle AddNote(FFrameNumber Timestamp, UNoteDataAsset* NoteData);
 
@@ -71,12 +71,13 @@ public:
 	bool RemoveNote(FKeyHandle Handle);
 
 	/**
-	 * Remove all notes within a specific frame range
+	 * Remove all notes within a specific frame range (both ends inclusive) in one pass
 	 */
 	int32 RemoveNotesInRange(FFrameNumber StartFrame, FFrameNumber EndFrame);
 
 	/**
-	 * Get all notes within a specific frame range
+	 * Get all notes within a specific frame range (both ends inclusive)
+	 * Binary searches the sorted key times, so cost follows the notes returned
 	 */
 	void GetNotesInRange(FFrameNumber StartFrame, FFrameNumber EndFrame, TArray<FNoteInstance>& OutNotes) const;
 
@@ -90,6 +91,36 @@ public:
 	 */
 	int32 GetNoteCount() const { return NoteChannel.GetNumKeys(); }
 
+	/**
+	 * Pull every note towards the nearest grid line in one pass over the keys
+	 * @param Strength 0 = unchanged, 1 = exactly on the grid
+	 * @param TempoMap Tempo map the grid follows; empty = constant BPM from frame 0
+	 * @return Number of notes moved
+	 */
+	int32 QuantizeNotes(EMusicalNoteValue Grid, float Strength, FFrameRate TickResolution, const FTempoMap& TempoMap, float BPM);
+
+	/**
+	 * Snap every note to the nearest SnapGridResolution line
+	 */
+	int32 SnapNotesToGrid(FFrameRate TickResolution, const FTempoMap& TempoMap, float BPM)
+	{
+		return QuantizeNotes(SnapGridResolution, 1.0f, TickResolution, TempoMap, BPM);
+	}
+
+	/**
+	 * Mirror lanes in one pass: the note types used, ordered by tag, swap end for end
+	 * @return Number of notes changed
+	 */
+	int32 MirrorNoteLanes();
+
+	/**
+	 * Queue the notes playback crossed from AfterFrame (exclusive) to ToFrame (inclusive)
+	 * @param InOutCursor Index of the first key after AfterFrame; re-sought by binary search when stale or INDEX_NONE
+	 * @param Subsystem Receives the note events, null to only advance the cursor
+	 * @return Number of keys crossed
+	 */
+	int32 TriggerNotes(FFrameNumber AfterFrame, FFrameNumber ToFrame, int32& InOutCursor, UUniversalBeatSubsystem* Subsystem) const;
+
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EntitySystem/MovieSceneEntitySystem.h"
+#include "EntitySystem/MovieSceneEntityIDs.h"
+#include "MovieSceneNoteChartSystem.generated.h"
+
+class UMovieSceneNoteChartSection;
+
+/**
+ * Evaluation state of one note chart section
+ * A section imports a single entity however many notes it holds; the cursor walks its keys
+ */
+struct FNoteChartEvaluationComponent
+{
+	UMovieSceneNoteChartSection* Section = nullptr;
+
+	/** Index of the first key after LastFrame, re-sought when the keys or playback jump */
+	int32 Cursor = INDEX_NONE;
+
+	/** Frame evaluated last, unset until the entity is first evaluated */
+	TOptional<FFrameNumber> LastFrame;
+};
+
+/**
+ * Component types registered by the note chart track
+ */
+struct UNIVERSALBEAT_API FNoteChartComponentTypes
+{
+	static FNoteChartComponentTypes* Get();
+	static void Destroy();
+
+	UE::MovieScene::TComponentTypeID<FNoteChartEvaluationComponent> NoteChart;
+
+private:
+	FNoteChartComponentTypes();
+};
+
+/**
+ * Broadcasts the notes each note chart section crosses while its sequence plays
+ * Cost per frame is the notes crossed, not the size of the chart
+ */
+UCLASS()
+class UNIVERSALBEAT_API UMovieSceneNoteChartSystem : public UMovieSceneEntitySystem
+{
+	GENERATED_BODY()
+
+public:
+	UMovieSceneNoteChartSystem(const FObjectInitializer& ObjectInitializer);
+
+	virtual void OnRun(FSystemTaskPrerequisites& InPrerequisites, FSystemSubsequentTasks& Subsequents) override;
+};
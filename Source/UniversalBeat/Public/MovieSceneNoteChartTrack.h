@@ -6,6 +6,33 @@
 #include "MovieSceneNameableTrack.h"
 #include "MovieSceneNoteChartTrack.generated.h"
 
+struct FTempoMap;
+
+/**
+ * Tempo and time signature from a frame of the sequence onwards
+ */
+USTRUCT(BlueprintType)
+struct UNIVERSALBEAT_API FNoteChartTempoKey
+{
+	GENERATED_BODY()
+
+	/** Frame the tempo starts at (tick resolution) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tempo")
+	FFrameNumber Frame;
+
+	/** Quarter-note beats per minute */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tempo", meta = (ClampMin = "20.0", ClampMax = "400.0"))
+	float BPM = 120.0f;
+
+	/** Time signature numerator */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tempo", meta = (ClampMin = "1", ClampMax = "32"))
+	int32 BeatsPerBar = 4;
+
+	/** Time signature denominator */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tempo", meta = (ClampMin = "1", ClampMax = "32"))
+	int32 BeatUnit = 4;
+};
+
 /**
  * Movie scene track for note charts
  * Manages note chart sections within a level sequence
@@ -33,6 +60,17 @@ public:
 	virtual FText GetDisplayName() const override;
 #endif
 
+	/**
+	 * Tempo map of the chart, in any order. Compiled into a beat/seconds table when the
+	 * chart loads: note windows are baked at the tempo around each note, and the beat clock
+	 * follows the map during playback. Empty = the subsystem's BPM applies.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Tempo")
+	TArray<FNoteChartTempoKey> TempoKeys;
+
+	/** Add TempoKeys to a tempo map (the caller finalizes it) */
+	void AppendTempoKeys(FFrameRate TickResolution, FTempoMap& OutTempoMap) const;
+
 private:
 	/** All note chart sections in this track */
 	UPROPERTY()
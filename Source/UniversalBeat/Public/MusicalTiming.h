@@ -0,0 +1,105 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UniversalBeatTypes.h"
+
+/**
+ * Native musical-timing core
+ *
+ * Note values and subdivisions index constexpr tables instead of going through switches, so
+ * native callers (chart baking, beat ticks, judgement) inline to a load and a multiply. The
+ * Blueprint functions in UUniversalBeatFunctionLibrary are thin wrappers over these.
+ *
+ * Beats are quarter notes, matching FTempoMap.
+ */
+namespace MusicalTiming
+{
+	/** Beat clock ticks per beat: one tick per sixteenth note */
+	inline constexpr int32 TicksPerBeat = 16;
+
+	/** Length of each EMusicalNoteValue in beats */
+	inline constexpr float NoteValueBeats[] = { 0.25f, 0.5f, 1.0f, 2.0f, 4.0f };
+
+	inline constexpr int32 NumNoteValues = UE_ARRAY_COUNT(NoteValueBeats);
+	static_assert(NumNoteValues == static_cast<int32>(EMusicalNoteValue::Whole) + 1, "NoteValueBeats must cover EMusicalNoteValue");
+
+	/** Beat clock ticks between broadcasts of each EBeatSubdivision (0 = no broadcasts) */
+	inline constexpr int32 SubdivisionTicks[] = { 0, TicksPerBeat, TicksPerBeat / 2, TicksPerBeat / 4, TicksPerBeat / 8, TicksPerBeat / 16 };
+
+	/** Broadcasts per beat of each EBeatSubdivision (1 for None, so it can divide) */
+	inline constexpr int32 SubdivisionsPerBeat[] = { 1, 1, 2, 4, 8, 16 };
+
+	inline constexpr int32 NumSubdivisions = UE_ARRAY_COUNT(SubdivisionTicks);
+	static_assert(NumSubdivisions == static_cast<int32>(EBeatSubdivision::Sixteenth) + 1, "SubdivisionTicks must cover EBeatSubdivision");
+	static_assert(UE_ARRAY_COUNT(SubdivisionsPerBeat) == NumSubdivisions, "SubdivisionsPerBeat must cover EBeatSubdivision");
+
+	/** Beats in a note value (a quarter note for out-of-range values) */
+	FORCEINLINE constexpr float GetNoteValueBeats(EMusicalNoteValue NoteValue)
+	{
+		const uint8 Index = static_cast<uint8>(NoteValue);
+		return Index < NumNoteValues ? NoteValueBeats[Index] : 1.0f;
+	}
+
+	/** Beat clock ticks between broadcasts (0 for None and out-of-range values) */
+	FORCEINLINE constexpr int32 GetSubdivisionTicks(EBeatSubdivision Subdivision)
+	{
+		const uint8 Index = static_cast<uint8>(Subdivision);
+		return Index < NumSubdivisions ? SubdivisionTicks[Index] : 0;
+	}
+
+	/** Broadcasts per beat (1 for None and out-of-range values) */
+	FORCEINLINE constexpr int32 GetSubdivisionsPerBeat(EBeatSubdivision Subdivision)
+	{
+		const uint8 Index = static_cast<uint8>(Subdivision);
+		return Index < NumSubdivisions ? SubdivisionsPerBeat[Index] : 1;
+	}
+
+	/** Seconds in a note value at a tempo, 0 for a non-positive BPM */
+	FORCEINLINE float NoteValueToSeconds(EMusicalNoteValue NoteValue, float BPM)
+	{
+		return BPM > 0.0f ? GetNoteValueBeats(NoteValue) * (60.0f / BPM) : 0.0f;
+	}
+
+	/**
+	 * Window lengths of every note value at one tempo
+	 * Rebuilt only when the tempo changes, so per-note lookups are a table load
+	 */
+	struct FNoteWindowTable
+	{
+		FNoteWindowTable() = default;
+
+		explicit FNoteWindowTable(float InBPM)
+		{
+			SetBPM(InBPM);
+		}
+
+		/** Rebuild for a tempo; does nothing if the table is already at it */
+		void SetBPM(float InBPM)
+		{
+			if (InBPM == BPM)
+			{
+				return;
+			}
+
+			BPM = InBPM;
+			for (int32 Index = 0; Index < NumNoteValues; ++Index)
+			{
+				Seconds[Index] = NoteValueToSeconds(static_cast<EMusicalNoteValue>(Index), InBPM);
+			}
+		}
+
+		float GetBPM() const { return BPM; }
+
+		FORCEINLINE float GetSeconds(EMusicalNoteValue NoteValue) const
+		{
+			const uint8 Index = static_cast<uint8>(NoteValue);
+			return Index < NumNoteValues ? Seconds[Index] : Seconds[static_cast<uint8>(EMusicalNoteValue::Quarter)];
+		}
+
+	private:
+		float Seconds[NumNoteValues] = {};
+		float BPM = 0.0f;
+	};
+}
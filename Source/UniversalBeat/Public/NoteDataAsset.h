@@ -8,6 +8,8 @@
 #include "UniversalBeatTypes.h"
 #include "NoteDataAsset.generated.h"
 
+class UCurveFloat;
+
 /**
  * Data asset defining the properties of a note type
  * Configures timing windows, visual representation, and interaction mechanics
@@ -36,12 +38,20 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (Tooltip = "Timing window after the note - larger values = more forgiving"))
 	EMusicalNoteValue PostTiming;
 
+	/**
+	 * Optional accuracy shaping for this note type.
+	 * X = linear accuracy (0 = edge of the window, 1 = perfect), Y = reported accuracy.
+	 * Baked into a lookup table when the chart compiles; empty = linear.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Timing", meta = (Tooltip = "Maps linear accuracy (0 = window edge, 1 = perfect) to the reported accuracy. Empty = linear."))
+	TObjectPtr<UCurveFloat> AccuracyCurve;
+
 	/** Icon texture for visual identification in UI and sequence editor */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visual", meta = (Tooltip = "Icon displayed in UI and sequencer track"))
 	TObjectPtr<UTexture2D> IconTexture;
 
 	/** Interaction type: Press, Hold, or Release */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction", meta = (Tooltip = "Type of input interaction required (Press validation only in v1)"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction", meta = (Tooltip = "Type of input interaction required. Hold notes sustain for the key's HoldDuration; Release notes are judged on input release"))
 	ENoteInteractionType InteractionType;
 
 	// Blueprint getter functions for const access
@@ -57,6 +67,9 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UniversalBeat|Notes", meta = (Tooltip = "Get the post-timing window as musical note value"))
 	EMusicalNoteValue GetPostTiming() const { return PostTiming; }
 
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UniversalBeat|Notes", meta = (Tooltip = "Get the accuracy curve of this note type (may be null)"))
+	UCurveFloat* GetAccuracyCurve() const { return AccuracyCurve; }
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UniversalBeat|Notes", meta = (Tooltip = "Get the icon texture for UI display"))
 	UTexture2D* GetIconTexture() const { return IconTexture; }
 
@@ -0,0 +1,173 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UniversalBeatTypes.h"
+
+struct FCompiledNoteChart;
+
+/**
+ * Judgement state of one input stream over one compiled chart
+ *
+ * Plain data: copy it to snapshot, assign it back to roll back. Together with the chart
+ * and the timestamped inputs it fully determines every judgement, so a server can
+ * re-simulate late inputs from a snapshot and replays can be verified off the game thread.
+ */
+struct UNIVERSALBEAT_API FNoteJudgementState
+{
+	/** Holds that can be sustained at once; a player has only so many fingers */
+	static constexpr int32 MaxActiveHolds = 16;
+
+	/** A Hold note whose head was hit and whose release is pending */
+	struct FActiveHold
+	{
+		int32 NoteIndex = INDEX_NONE;
+
+		/** Entry of the note in the chart's Lane* arrays */
+		int32 LaneEntry = INDEX_NONE;
+
+		/** Chart time of the head press */
+		double PressTime = 0.0;
+
+		/** Accuracy of the head press */
+		float PressAccuracy = 0.0f;
+	};
+
+	/** Consumed flag per compiled note index */
+	TBitArray<> ConsumedNotes;
+
+	/** Missed flag per compiled note index (window closed without a hit) */
+	TBitArray<> MissedNotes;
+
+	/** Per-lane search cursor: first lane entry whose note is not resolved yet */
+	TArray<int32> LaneCursors;
+
+	/** Miss sweep cursor: first compiled note whose window has not been swept closed */
+	int32 MissCursor = 0;
+
+	/** Notes marked missed since Init/Rewind */
+	int32 NumMissed = 0;
+
+	/** Sustained holds, inline storage: nothing is touched between a hold's press and release */
+	TArray<FActiveHold, TFixedAllocator<MaxActiveHolds>> ActiveHolds;
+
+	/** Earliest sustain end among ActiveHolds (max double when none), so completion checks are O(1) */
+	double NextHoldEnd = TNumericLimits<double>::Max();
+
+	/** Size the state for a chart with every note unconsumed */
+	void Init(const FCompiledNoteChart& Chart);
+
+	/** Mark every note unconsumed again without reallocating (loops, restarts) */
+	void Rewind(const FCompiledNoteChart& Chart);
+
+	/** Release all state */
+	void Empty();
+
+	/** Whether the state was sized for this chart */
+	bool IsValidFor(const FCompiledNoteChart& Chart) const;
+
+	bool IsConsumed(int32 NoteIndex) const { return ConsumedNotes[NoteIndex]; }
+	bool IsMissed(int32 NoteIndex) const { return MissedNotes[NoteIndex]; }
+
+	/** Hit or missed: the note can no longer be judged */
+	bool IsResolved(int32 NoteIndex) const { return ConsumedNotes[NoteIndex] || MissedNotes[NoteIndex]; }
+
+	/** Active hold in a lane, INDEX_NONE if the lane is not being held */
+	int32 FindActiveHold(const FCompiledNoteChart& Chart, int32 LaneIndex) const;
+
+	/** Heap memory used by the state */
+	SIZE_T GetAllocatedSize() const { return ConsumedNotes.GetAllocatedSize() + MissedNotes.GetAllocatedSize() + LaneCursors.GetAllocatedSize(); }
+};
+
+/** Outcome of judging one input; holds no engine or UObject references */
+struct FNoteJudgement
+{
+	/** Compiled note index that was hit, INDEX_NONE on a miss */
+	int32 NoteIndex = INDEX_NONE;
+
+	/** 1.0 = perfect, 0.0 = edge of the note's window */
+	float Accuracy = 0.0f;
+
+	/** Input time minus note time in seconds (negative = early) */
+	float TimingOffset = 0.0f;
+
+	/** Misses report Late (no note was open for the input) */
+	ENoteTimingDirection TimingDirection = ENoteTimingDirection::Late;
+
+	/** Interaction type of the judged note */
+	ENoteInteractionType InteractionType = ENoteInteractionType::Press;
+
+	/** Set when this judgement ends a hold (release or completion) rather than judging a note head */
+	bool bHoldEnd = false;
+
+	/** Hold ended early: NoteIndex names the hold, but the judgement is not a hit */
+	bool bDropped = false;
+
+	/** Sixteenth-note ticks the hold was sustained for (hold ends only) */
+	int32 SustainTicks = 0;
+
+	/** SustainTicks over the hold's total ticks, 1.0 for a completed hold (hold ends only) */
+	float SustainRatio = 0.0f;
+
+	bool IsHit() const { return NoteIndex != INDEX_NONE && !bDropped; }
+};
+
+/**
+ * Deterministic note judgement
+ *
+ * Functions of (chart, state, input) only: no clock, world or subsystem access, safe to run
+ * on any thread as long as each thread owns its state and the chart's windows are not
+ * re-baked concurrently. Inputs may arrive out of timestamp order: a note is only passed over
+ * once it is consumed or missed, never because a later input's window has moved beyond it.
+ */
+namespace NoteJudgement
+{
+	/**
+	 * Find the first unresolved note of a lane whose baked window contains ChartTime.
+	 * Advances the lane cursor past resolved notes at the front of the lane only.
+	 * @param OutLaneEntry Optional, receives the note's entry in the chart's Lane* arrays
+	 * @param bReleaseInput Match Release notes (true) or Press/Hold notes (false)
+	 * @return Compiled note index, or INDEX_NONE
+	 */
+	UNIVERSALBEAT_API int32 FindOpenNote(const FCompiledNoteChart& Chart, FNoteJudgementState& State, int32 LaneIndex, double ChartTime, int32* OutLaneEntry = nullptr, bool bReleaseInput = false);
+
+	/**
+	 * Judge one press at a chart time, consuming the note on a hit.
+	 * Hitting the head of a Hold note starts an active hold in its lane.
+	 */
+	UNIVERSALBEAT_API FNoteJudgement JudgeInput(const FCompiledNoteChart& Chart, FNoteJudgementState& State, FGameplayTag InputTag, double ChartTime);
+
+	/**
+	 * Judge one release at a chart time.
+	 * Ends the lane's active hold if there is one: sustain ticks are counted between the note
+	 * and the release, and a release inside the head's pre-window of the sustain end completes
+	 * the hold, anything earlier drops it. Otherwise judges an open Release note of the lane.
+	 */
+	UNIVERSALBEAT_API FNoteJudgement JudgeRelease(const FCompiledNoteChart& Chart, FNoteJudgementState& State, FGameplayTag InputTag, double ChartTime);
+
+	/**
+	 * Complete the active holds whose sustain ended by ChartTime, as if released on their end.
+	 * O(1) while no hold is due.
+	 * @param OutCompleted Optional, receives the completion judgements
+	 * @return Number of holds completed
+	 */
+	UNIVERSALBEAT_API int32 CompleteHolds(const FCompiledNoteChart& Chart, FNoteJudgementState& State, double ChartTime, TArray<FNoteJudgement>* OutCompleted = nullptr);
+
+	/**
+	 * Advance the miss cursor over notes whose window closed before ChartTime and mark the
+	 * unconsumed ones missed. The cursor walks NoteWindowEnd in note order and stops at the
+	 * first open window, so a call costs O(notes swept). Missed notes can no longer be hit.
+	 * @param OutMissed Optional, receives the compiled indices of the newly missed notes
+	 * @return Number of notes newly marked missed
+	 */
+	UNIVERSALBEAT_API int32 SweepMisses(const FCompiledNoteChart& Chart, FNoteJudgementState& State, double ChartTime, TArray<int32>* OutMissed = nullptr);
+
+	/**
+	 * Copy a judgement into a Blueprint-facing result; the note fields are only written when a
+	 * note was judged (input tag and timestamp are left to the caller).
+	 * Resolves the note asset: call on the game thread.
+	 */
+	UNIVERSALBEAT_API void FillValidationResult(const FCompiledNoteChart& Chart, const FNoteJudgement& Judgement, FNoteValidationResult& OutResult);
+}
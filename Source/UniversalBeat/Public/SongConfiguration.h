@@ -8,6 +8,9 @@
 #include "UniversalBeatTypes.h"
 #include "SongConfiguration.generated.h"
 
+struct FCookedSongChart;
+class UNoteDataAsset;
+
 /**
  * Data asset defining a song with multiple coordinated note tracks
  * Configures track sequences, delays, looping, and lifecycle events
@@ -32,6 +35,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracks", meta = (Tooltip = "Note chart tracks with timing and looping configuration"))
 	TArray<FNoteTrackEntry> Tracks;
 
+	/**
+	 * Play all tracks at once (layered stems), each starting DelayOffset seconds after the song starts,
+	 * instead of one after another. Their charts are judged as one merged chart.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracks", meta = (Tooltip = "Play all tracks simultaneously, each offset by its DelayOffset"))
+	bool bPlayTracksConcurrently = false;
+
 	// Blueprint getter functions for const access
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UniversalBeat|Songs", meta = (Tooltip = "Get the display label for this song"))
 	const FString& GetSongLabel() const { return SongLabel; }
@@ -59,11 +69,34 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UniversalBeat|Songs", meta = (Tooltip = "Get list of configuration problems"))
 	TArray<FString> GetValidationErrors() const;
 
+	/**
+	 * Get the precompiled charts of all tracks.
+	 * Only available in cooked builds; editor builds compile charts from the live sequences.
+	 * @return Cooked charts, or null if the song has none or the blob is out of date
+	 */
+	TSharedPtr<const FCookedSongChart, ESPMode::ThreadSafe> GetCookedChart();
+
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
 #endif
 
 private:
 	/** Internal validation helper */
 	void ValidateConfiguration(TArray<FString>& OutErrors) const;
+
+	/** Binary chart blob written at cook time (see FCookedSongChart), released once read */
+	UPROPERTY()
+	TArray<uint8> CookedChartBlob;
+
+	/** Lane palette the cooked charts index into */
+	UPROPERTY()
+	TArray<FGameplayTag> CookedChartLanes;
+
+	/** Note asset palette the cooked charts index into (keeps those assets loaded with the song) */
+	UPROPERTY()
+	TArray<TObjectPtr<UNoteDataAsset>> CookedChartNoteAssets;
+
+	/** Charts read from CookedChartBlob on first use */
+	TSharedPtr<const FCookedSongChart, ESPMode::ThreadSafe> CookedChart;
 };
\ No newline at end of file
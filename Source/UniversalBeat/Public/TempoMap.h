@@ -0,0 +1,69 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Piecewise-linear beat <-> seconds table
+ *
+ * One segment per tempo key, in structure-of-arrays form sorted by time. Within a segment
+ * the tempo is constant, so both directions are a binary search over the segment starts
+ * followed by one multiply-add. Times before the first key use the first key's tempo,
+ * which puts beat 0 at time 0.
+ *
+ * Beats are quarter notes, matching ConvertMusicalNoteToSeconds; the time signature only
+ * affects bar numbers.
+ */
+struct UNIVERSALBEAT_API FTempoMap
+{
+	/** Segment start in seconds from sequence start (ascending) */
+	TArray<double> SegmentSeconds;
+
+	/** Beat position at each segment start (ascending) */
+	TArray<double> SegmentBeats;
+
+	/** Bar position at each segment start */
+	TArray<double> SegmentBars;
+
+	/** Duration of one beat within each segment */
+	TArray<double> SegmentSecondsPerBeat;
+
+	/** Time signature of each segment */
+	TArray<uint8> SegmentBeatsPerBar;
+	TArray<uint8> SegmentBeatUnit;
+
+public:
+	/** Append a tempo key (call Finalize when done); keys at the same time replace earlier ones */
+	void AddKey(double Seconds, float BPM, int32 BeatsPerBar = 4, int32 BeatUnit = 4);
+
+	/** Sort the keys and accumulate beat and bar positions */
+	void Finalize();
+
+	/** Remove all segments */
+	void Reset();
+
+	int32 Num() const { return SegmentSeconds.Num(); }
+	bool IsEmpty() const { return SegmentSeconds.Num() == 0; }
+
+	/** Segment containing a time (0 before the first key), INDEX_NONE if the map is empty */
+	int32 FindSegment(double Seconds) const;
+
+	/** Segment containing a beat position (0 before the first key), INDEX_NONE if the map is empty */
+	int32 FindSegmentByBeat(double Beat) const;
+
+	/** Fractional beat position at a time */
+	double SecondsToBeats(double Seconds) const;
+
+	/** Time of a fractional beat position */
+	double BeatsToSeconds(double Beat) const;
+
+	/** Fractional bar position at a time */
+	double SecondsToBars(double Seconds) const;
+
+	/** Tempo of a segment */
+	float GetBPM(int32 SegmentIndex) const { return static_cast<float>(60.0 / SegmentSecondsPerBeat[SegmentIndex]); }
+
+	/** Heap memory used by the map */
+	SIZE_T GetAllocatedSize() const;
+};
@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+
+struct FRichCurve;
+
+/**
+ * Curve over [0, 1] baked into a fixed-size table
+ *
+ * Sampling is a clamp, one multiply and a lerp between two neighbouring entries: constant
+ * cost regardless of how many keys the source curve had, no key search, and no logging.
+ * Values are clamped to [0, 1] at bake time. Plain data, safe to read from any thread.
+ */
+struct UNIVERSALBEAT_API FTimingCurveLUT
+{
+	/** Intervals over [0, 1]; the table holds NumSamples + 1 points */
+	static constexpr int32 NumSamples = 256;
+
+	FTimingCurveLUT() { BakeIdentity(); }
+
+	/**
+	 * Sample a curve into the table.
+	 * @return Number of samples that were outside [0, 1] and got clamped
+	 */
+	int32 Bake(const FRichCurve& Curve);
+
+	/** Triangle wave: rises 0 -> 1 over [0, 0.5], falls back to 0 over [0.5, 1] */
+	void BakeTriangle();
+
+	/** y = x */
+	void BakeIdentity();
+
+	/** Sample at X (clamped to [0, 1]) */
+	FORCEINLINE float Evaluate(float X) const
+	{
+		const float Scaled = FMath::Clamp(X, 0.0f, 1.0f) * NumSamples;
+		const int32 Index = FMath::Min(static_cast<int32>(Scaled), NumSamples - 1);
+		return FMath::Lerp(Samples[Index], Samples[Index + 1], Scaled - static_cast<float>(Index));
+	}
+
+	/** Sample many inputs at once (Out must have at least In.Num() elements) */
+	void EvaluateBatch(TConstArrayView<float> In, TArrayView<float> Out) const;
+
+private:
+	TStaticArray<float, NumSamples + 1> Samples;
+};
@@ -5,8 +5,20 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "UniversalBeatTypes.h"
+#include "BeatClock.h"
+#include "BeatTimingSource.h"
+#include "CompiledNoteChart.h"
+#include "NoteJudgement.h"
+#include "BeatSession.h"
+#include "BeatEvent.h"
+#include "TimingCurveLUT.h"
+#include "BeatTimingStats.h"
+#include "BeatReplay.h"
+#include "BeatCalibrationEstimator.h"
+#include "Containers/Queue.h"
 #include "Curves/CurveFloat.h"
 #include "Engine/TimerHandle.h"
+#include "InputCoreTypes.h"
 #include "UniversalBeatSubsystem.generated.h"
 
 // Forward declarations
@@ -15,9 +27,14 @@ class ULevelSequencePlayer;
 class ULevelSequence;
 class UMovieSceneNoteChartSection;
 class ALevelSequenceActor;
+class UAudioComponent;
+class UNoteDataAsset;
+struct FStreamableHandle;
+class FBeatInputPreprocessor;
 
 // Event dispatcher delegates
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnBeatInputCheck, FName, LabelName, FGameplayTag, InputTag, float, TimingValue);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBeatInputBatchCheck, const TArray<FNoteValidationResult>&, Results, int32, NumHits);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBeat, FBeatEventData, BeatData);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCalibrationComplete, float, CalculatedOffsetMs, bool, bSuccess);
 
@@ -27,7 +44,81 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnSongStarted);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnSongEnded);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTrackStarted, int32, TrackIndex);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTrackEnded, int32, TrackIndex);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSongReady, FGameplayTag, SongTag);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNoteBeat, FNoteInstance, NoteData);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnNoteApproach, FNoteInstance, NoteData, float, TimeUntilHit);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNoteMissed, FNoteInstance, NoteData);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNotesMissed, const TArray<FNoteInstance>&, MissedNotes);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnNoteHoldCompleted, FNoteInstance, NoteData, float, Accuracy);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnJudgementSessionEvaluated, FBeatSessionHandle, Session, const TArray<FNoteValidationResult>&, Results, int32, NumHits);
+
+/** One track of a song playing its tracks concurrently, placed on the merged chart timeline */
+struct FActiveSongTrack
+{
+	/** Index into the song's Tracks */
+	int32 TrackIndex = INDEX_NONE;
+
+	/** Pooled player slot evaluating the track's cosmetic tracks (see AcquireSongPlayer) */
+	int32 PlayerSlot = INDEX_NONE;
+
+	/** Merged chart time the track starts at (its DelayOffset) */
+	double StartSeconds = 0.0;
+
+	/** Sequence time of the track's playback range start */
+	double RangeStartSeconds = 0.0;
+
+	/** Length of one pass over the track's playback range */
+	double PassSeconds = 0.0;
+
+	/** 1 + LoopCount */
+	int32 NumPasses = 1;
+
+	/** Display rate of the track's sequence, cosmetic tracks are evaluated at most once per display frame */
+	FFrameRate DisplayRate;
+
+	/** Sequence has tracks besides note charts (or bindings) that need sequencer evaluation */
+	bool bEvaluatesSequencer = false;
+
+	/** Pass and display frame last evaluated (INDEX_NONE = not evaluated yet) */
+	int32 LastEvaluatedPass = INDEX_NONE;
+	int32 LastEvaluatedDisplayFrame = INDEX_NONE;
+
+	bool bStarted = false;
+	bool bEnded = false;
+
+	double GetEndSeconds() const { return StartSeconds + PassSeconds * NumPasses; }
+};
+
+/**
+ * Next track of a sequential song queue, made ready while the current track plays
+ *
+ * Holds the back buffer of the double-buffered chart state: the compiled chart, a judgement
+ * state sized for it and a player (slot 1) with the sequence bound. Starting the track swaps
+ * these with the live ones, so the track boundary costs no load, compile or allocation.
+ */
+struct FPreparedSongTrack
+{
+	FNoteTrackEntry Track;
+
+	/** Song the track belongs to: the current song, or the next queued one for its first track */
+	TWeakObjectPtr<USongConfiguration> Song;
+
+	/** Index into the song's Tracks */
+	int32 TrackIndex = INDEX_NONE;
+
+	/** Compiled chart, windows baked at the BPM it was prepared at (null if the sequence has no notes) */
+	TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> Chart;
+	FNoteJudgementState JudgementState;
+
+	/** Playback range of the sequence, as passed to StartChartPlaybackRange */
+	double RangeStartSeconds = 0.0;
+	double DurationSeconds = 0.0;
+	FFrameRate TickResolution;
+	FFrameRate DisplayRate;
+	bool bEvaluatesSequencer = false;
+
+	bool bReady = false;
+};
 
 /**
  * UniversalBeat Subsystem - Game thread only
@@ -35,28 +126,38 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNoteBeat, FNoteInstance, NoteData
  * Genre-agnostic rhythm game system providing beat tracking, timing checks,
  * and event-driven integration for Blueprint-based rhythm mechanics.
  * 
- * **Architecture (v1.1 - Timer-Based System)**:
- * - Universal Beat Timer runs at hardcoded Sixteenth note rate
- * - Beat broadcasts and timing checks synchronized via single timer source
- * - BeatPhase calculated from GetTimerRemaining() for symmetric timing windows
+ * **Architecture (v1.2 - Analytic Beat Clock)**:
+ * - Beat ticks (Sixteenth note rate) are found analytically each frame: every tick crossed
+ *   since the last frame is delivered with its exact ideal time, none are collapsed
+ * - BeatPhase, beat number and tick are computed from an FBeatClock anchor + BPM,
+ *   so timing checks are not quantized to the frame a tick was delivered on
  * - Timing curves evaluated with abs(BeatPhase) for equal early/late scoring
  * 
  * **Thread Safety**:
  * This subsystem must only be accessed from the game thread.
  * Do not call subsystem methods from async tasks or other threads.
+ * Exception: GetBeatClock() returns a snapshot that may be queried from any thread.
  * 
  * **Performance Requirements**:
  * - 30+ FPS: Full timing accuracy maintained
  * - <30 FPS: Timing accuracy may degrade, warning logged once per session
  * - 60+ FPS: Optimal performance target
- * - Timer callback overhead: <0.05ms per callback
+ * - Beat tick overhead: <0.05ms per tick
  * - Timing check overhead: <0.1ms per check (100+ checks/frame supported)
+ * Both are measured by "stat UniversalBeat"; beat tick jitter, input latency and judgement
+ * offsets are kept as histograms (GetTimingStats) and traced on the UniversalBeat
+ * Insights channel.
  * 
  * **Note Chart System**:
- * Uses a dedicated "SongPlayer" LevelSequenceActor for all note chart playback.
+ * Uses a dedicated "SongPlayer" LevelSequenceActor for all note chart playback. Songs that play
+ * their tracks concurrently take one pooled actor per track with cosmetic content (the SongPlayer
+ * first); pooled actors are reused across songs, never respawned. Sequential songs pre-roll the
+ * next track on player slot 1 while the current one plays and swap the two on the beat the
+ * current track ends, so back-to-back tracks and songs play without a gap.
  */
+
 UCLASS()
-class UNIVERSALBEAT_API UUniversalBeatSubsystem : public UWorldSubsystem
+class UNIVERSALBEAT_API UUniversalBeatSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -66,10 +167,18 @@ public:
 	virtual void Deinitialize() override;
 	/** End USubsystem implementation */
 
+	/** UObject interface (reports judgement session note assets) */
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
 	/** UWorldSubsystem interface */
 	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
 	/** End UWorldSubsystem interface */
 
+	/** FTickableGameObject interface */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/** End FTickableGameObject interface */
+
 	// ====================================================================
 	// 1. BPM Configuration
 	// ====================================================================
@@ -78,7 +187,9 @@ public:
 	 * Set the beats per minute for rhythm tracking.
 	 * 
 	 * BPM changes are QUEUED and applied at the next whole beat boundary to avoid phase discontinuity.
-	 * Maximum latency is one timer cycle (~312ms @ 120 BPM for Sixteenth subdivision).
+	 * Maximum latency is one beat (500ms @ 120 BPM).
+	 * Beat number and phase continue across the change.
+	 * While a chart with a tempo map plays, the map sets the tempo at each of its keys.
 	 * 
 	 * Validation rules:
 	 * - Invalid values (<=0, NaN, Inf): Logs error, resets to 120 BPM default
@@ -105,6 +216,17 @@ public:
 	UFUNCTION(BlueprintPure, Category = "UniversalBeat|Configuration", meta = (Tooltip = "Get seconds per beat at current BPM."))
 	float GetSecondsPerBeat() const;
 
+	/**
+	 * Get the time signature at the current chart position.
+	 * Comes from the tempo map of the playing chart; 4/4 when there is none.
+	 *
+	 * @param OutBeatsPerBar Time signature numerator
+	 * @param OutBeatUnit Time signature denominator
+	 * @return Fractional bar position in the chart (0 without a tempo map)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Configuration", meta = (Tooltip = "Get the chart's time signature and bar position."))
+	float GetTimeSignature(int32& OutBeatsPerBar, int32& OutBeatUnit) const;
+
 	/**
 	 * Set whether beat timing respects game time dilation (slow-motion, pause).
 	 * 
@@ -125,6 +247,37 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Configuration", meta = (Tooltip = "Pause or unpause beat timer."))
 	void PauseBeatTimer(bool bPause);
 
+	/**
+	 * Drive beat timing from the audio render clock of the song being played.
+	 * 
+	 * The song position is read from the audio mixer each rendered buffer and interpolated
+	 * on the game thread, so phase queries and note validation follow the music's sample
+	 * clock instead of game time. Call after the component has started playing the song.
+	 * The beat clock is re-anchored so beat 0 is the start of the sound.
+	 * 
+	 * @param SongAudio Audio component playing the song (null clears the audio clock source)
+	 * @return True if the audio clock source was attached
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Configuration", meta = (Tooltip = "Sync beat timing to the audio render clock of a playing song."))
+	bool SetAudioClockSource(UAudioComponent* SongAudio);
+
+	/**
+	 * Revert to the default timing source (real time, or world time when respecting time dilation).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Configuration", meta = (Tooltip = "Revert to default (game/real time) beat timing."))
+	void ClearTimingSource();
+
+	/**
+	 * Install a custom timing source (C++ only).
+	 * Song-position sources re-anchor the beat clock to song time 0; others keep the beat position.
+	 * 
+	 * @param InSource Timing source, or null to revert to the default
+	 */
+	void SetTimingSource(TSharedPtr<IBeatTimingSource, ESPMode::ThreadSafe> InSource);
+
+	/** Get the active custom timing source (null when using the default) */
+	TSharedPtr<IBeatTimingSource, ESPMode::ThreadSafe> GetTimingSource() const { return TimingSource; }
+
 
 	// ====================================================================
 	// 2. Timing Checks
@@ -153,6 +306,88 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Timing", meta = (Tooltip = "Check timing accuracy with detailed feedback. Enhanced for note charts."))
 	FNoteValidationResult CheckBeatTimingByTag(FGameplayTag InputTag);
 
+	/**
+	 * Validate a batch of timestamped inputs against the note chart in one pass.
+	 * Inputs are judged in timestamp order (the order they would have arrived live), so an
+	 * earlier press takes a contested note first; results are written in input order.
+	 * Broadcasts OnBeatInputBatchCheck once instead of OnBeatInputCheck per input.
+	 * With no chart loaded, each input gets the standard beat timing at its timestamp, mapped to
+	 * the beat clock from the current playback time.
+	 *
+	 * @param Inputs Inputs to validate; FBeatInputEvent::Timestamp is chart time in seconds (the
+	 *               timeline of GetCurrentPlaybackTime and note times), not FPlatformTime::Seconds()
+	 * @param OutResults Reset and filled with one result per input (keeps its allocation across calls)
+	 * @return Number of inputs that hit a note
+	 */
+	int32 CheckBeatTimingBatch(TConstArrayView<FBeatInputEvent> Inputs, TArray<FNoteValidationResult>& OutResults);
+
+	/**
+	 * Check beat timing accuracy for an input that happened at a known time.
+	 * Same as CheckBeatTimingByLabel, but the beat phase is evaluated at the input's time
+	 * rather than at call time, so frame and dispatch latency don't count against the player.
+	 *
+	 * @param LabelName String identifier for this input (e.g., "Jump"). Empty/null treated as "Default".
+	 * @param InputPlatformTime When the input happened, in FPlatformTime::Seconds() (see GetLastInputTimestamp)
+	 * @return Timing accuracy: 0.0 = mid-beat (worst), 1.0 = on-beat (perfect)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Timing", meta = (Tooltip = "Check timing accuracy at the time the input happened. Returns 0.0-1.0."))
+	float CheckBeatTimingByLabelAtTime(FName LabelName, double InputPlatformTime);
+
+	/**
+	 * Validate an input that happened at a known time against the note chart.
+	 * Same as CheckBeatTimingByTag, but the chart is judged at the input's time rather than at call time.
+	 *
+	 * @param InputTag Gameplay tag identifier for this input
+	 * @param InputPlatformTime When the input happened, in FPlatformTime::Seconds() (see GetLastInputTimestamp)
+	 * @return Detailed validation result; InputTimestamp is InputPlatformTime
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Timing", meta = (Tooltip = "Validate an input at the time it happened. Enhanced for note charts."))
+	FNoteValidationResult CheckBeatTimingByTagAtTime(FGameplayTag InputTag, double InputPlatformTime);
+
+	/**
+	 * Validate the release of an input against the note chart.
+	 * Ends the hold the input is sustaining in that lane (the result carries the sustain ticks,
+	 * bHit is false if it was let go too early), otherwise judges an open Release note.
+	 * Holds sustained to their end complete on their own (OnNoteHoldCompleted); a release after
+	 * that finds nothing. Without a chart there is nothing to release and the result is a miss.
+	 *
+	 * @param InputTag Gameplay tag identifier for this input
+	 * @return Detailed validation result
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Timing", meta = (Tooltip = "Validate an input release: ends holds and judges Release notes."))
+	FNoteValidationResult CheckBeatReleaseByTag(FGameplayTag InputTag);
+
+	/**
+	 * Same as CheckBeatReleaseByTag, but the chart is judged at the release's time rather than at call time.
+	 *
+	 * @param InputTag Gameplay tag identifier for this input
+	 * @param InputPlatformTime When the release happened, in FPlatformTime::Seconds() (see GetLastReleaseTimestamp)
+	 * @return Detailed validation result; InputTimestamp is InputPlatformTime
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Timing", meta = (Tooltip = "Validate an input release at the time it happened."))
+	FNoteValidationResult CheckBeatReleaseByTagAtTime(FGameplayTag InputTag, double InputPlatformTime);
+
+	/**
+	 * Time the key was last pressed, captured by the subsystem's input preprocessor before the
+	 * press reaches widgets, the player controller or Enhanced Input.
+	 * Feed this to the *AtTime checks from an input handler.
+	 *
+	 * @param Key Key or button to query
+	 * @return FPlatformTime::Seconds() of the latest press, or the current time if none was captured
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UniversalBeat|Timing", meta = (Tooltip = "Platform time of the latest press of a key."))
+	double GetLastInputTimestamp(FKey Key) const;
+
+	/**
+	 * Time the key was last released, captured by the input preprocessor like GetLastInputTimestamp.
+	 * Feed this to CheckBeatReleaseByTagAtTime from a release handler.
+	 *
+	 * @param Key Key or button to query
+	 * @return FPlatformTime::Seconds() of the latest release, or the current time if none was captured
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UniversalBeat|Timing", meta = (Tooltip = "Platform time of the latest release of a key."))
+	double GetLastReleaseTimestamp(FKey Key) const;
+
 	/**
 	 * Set the curve asset used to calculate timing accuracy from beat phase.
 	 * 
@@ -163,6 +398,9 @@ public:
 	 * Example: A curve with Y=1.0 at X=0.0 dropping to Y=0.85 at X=0.1 gives a tight perfect window.
 	 * Early and late inputs at the same distance from the peak (e.g., 25% and 75%) will score identically.
 	 * 
+	 * The curve is baked into a fixed-size lookup table here, so checks cost the same however many
+	 * keys it has. Call again after editing the curve asset at runtime.
+	 * 
 	 * @param NewCurve Curve asset (null will use linear fallback: TimingValue = 1.0 - CurveInput)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Timing", meta = (Tooltip = "Set timing curve asset for symmetric timing windows. Curve input: abs(BeatPhase) where 0=perfect, 1=missed. Null uses linear fallback."))
@@ -199,14 +437,43 @@ public:
 
 	/**
 	 * Run an automated calibration sequence to measure player timing offset.
-	 * System presents prompts at beat intervals, player responds, average offset calculated.
-	 * Broadcasts OnCalibrationComplete when finished.
+	 * The player taps along to the beat; every beat timing check (by label, or by tag without a chart)
+	 * during the sequence is one sample, measured from its input timestamp against the beat clock.
+	 * Outlying taps are rejected and the sequence finishes as soon as the estimate is confident,
+	 * after NumPrompts taps, or when NumPrompts beats (plus two of grace) pass without either.
+	 * Broadcasts OnCalibrationComplete with the offset to pass to SetCalibrationOffset.
 	 * 
-	 * @param NumPrompts Number of prompts to present (5-20 recommended)
+	 * @param NumPrompts Maximum number of taps to collect (5-20)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Calibration", meta = (Tooltip = "Run automated calibration sequence. Broadcasts OnCalibrationComplete when done."))
 	void RunCalibrationSequence(int32 NumPrompts = 10);
 
+	/** Whether a calibration sequence is collecting taps */
+	UFUNCTION(BlueprintPure, Category = "UniversalBeat|Calibration", meta = (Tooltip = "Check if a calibration sequence is running."))
+	bool IsCalibrating() const;
+
+	/**
+	 * Keep estimating the player's offset during normal play, from note hits and beat timing checks.
+	 * With bAutoApply, a confident estimate that differs from the current offset by more than a few
+	 * milliseconds is applied through SetCalibrationOffset and broadcast on OnCalibrationComplete.
+	 * Enabling starts a fresh estimate.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Calibration", meta = (Tooltip = "Estimate calibration continuously during play, optionally applying it."))
+	void EnablePassiveCalibration(bool bEnabled, bool bAutoApply = false);
+
+	UFUNCTION(BlueprintPure, Category = "UniversalBeat|Calibration", meta = (Tooltip = "Check if passive calibration is enabled."))
+	bool IsPassiveCalibrationEnabled() const;
+
+	/**
+	 * Current passive estimate of the calibration offset.
+	 * 
+	 * @param OutStandardErrorMs Confidence of the estimate (lower is better, large until enough samples)
+	 * @param OutNumSamples Samples the estimate is based on
+	 * @return Estimated offset in milliseconds
+	 */
+	UFUNCTION(BlueprintPure, Category = "UniversalBeat|Calibration", meta = (Tooltip = "Get the passive calibration estimate in milliseconds."))
+	float GetPassiveCalibrationEstimate(float& OutStandardErrorMs, int32& OutNumSamples) const;
+
 	// ====================================================================
 	// 4. Beat Broadcasting
 	// ====================================================================
@@ -235,6 +502,20 @@ public:
 	UFUNCTION(BlueprintPure, Category = "UniversalBeat|Broadcasting", meta = (Tooltip = "Check if beat broadcasting is enabled."))
 	bool IsBeatBroadcastingEnabled() const;
 
+	/**
+	 * Deliver beat events ahead of their time.
+	 * Each frame also delivers the ticks due within this many seconds, with a positive TimeUntil,
+	 * so audio and VFX can be scheduled onto the beat instead of reacting a frame late.
+	 * Predictions assume the current tempo; a queued BPM change holds them back until it applies.
+	 *
+	 * @param Seconds Lookahead, 0 = deliver ticks once they have passed (clamped to [0, 1])
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Broadcasting", meta = (Tooltip = "Deliver beat events this many seconds ahead of their time."))
+	void SetBeatEventLookahead(float Seconds);
+
+	UFUNCTION(BlueprintPure, Category = "UniversalBeat|Broadcasting", meta = (Tooltip = "Seconds beat events are delivered ahead of their time."))
+	float GetBeatEventLookahead() const { return BeatEventLookaheadSeconds; }
+
 	// ====================================================================
 	// 5. Note Chart System
 	// ====================================================================
@@ -264,6 +545,37 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UniversalBeat|NoteChart", meta = (Tooltip = "Get all loaded notes."))
 	TArray<FNoteInstance> GetAllNotes() const;
 
+	/**
+	 * Set how long before their time notes enter the lookahead window.
+	 * OnNoteApproach fires as each note enters; notes leave once their window closes.
+	 * The window follows the chart clock with moving cursors.
+	 *
+	 * @param Lookahead Window length (0 disables the window)
+	 * @param bInBeats True = Lookahead is in beats at the current BPM, false = in seconds
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|NoteChart", meta = (Tooltip = "Set the note lookahead window for approach and miss events."))
+	void SetNoteLookahead(float Lookahead, bool bInBeats = true);
+
+	/**
+	 * Get the lookahead window length in seconds at the current BPM.
+	 *
+	 * @return Lookahead in seconds (0 = disabled)
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UniversalBeat|NoteChart", meta = (Tooltip = "Get the note lookahead window in seconds."))
+	float GetNoteLookaheadSeconds() const;
+
+	/** Notes that have entered the lookahead window and whose window is still open, in time order (C++, no copy) */
+	FCompiledNoteRange GetLookaheadNotes() const;
+
+	/**
+	 * Get the number of notes of the active chart whose window closed without a hit
+	 * since the chart was loaded or last rewound.
+	 *
+	 * @return Missed note count
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UniversalBeat|NoteChart", meta = (Tooltip = "Get the number of missed notes in the current pass."))
+	int32 GetMissedNoteCount() const { return JudgementState.NumMissed; }
+
 	/**
 	 * Get the total number of loaded notes.
 	 * 
@@ -279,6 +591,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|NoteChart", meta = (Tooltip = "Reset consumed notes for looping."))
 	void ResetConsumedNotes();
 
+	/** Active compiled chart (null when none is loaded); read-only input for NoteJudgement */
+	TSharedPtr<const FCompiledNoteChart, ESPMode::ThreadSafe> GetNoteChart() const { return NoteChart; }
+
+	/** Judgement state of the local input stream; copy it to snapshot for rollback or replay */
+	const FNoteJudgementState& GetJudgementState() const { return JudgementState; }
+
+	/**
+	 * Roll the local judgement state back to a snapshot taken from GetJudgementState.
+	 * @return False if the snapshot was not taken for the active chart
+	 */
+	bool RestoreJudgementState(const FNoteJudgementState& Snapshot);
+
 	/**
 	 * Check if a note chart sequence is currently playing.
 	 * 
@@ -287,6 +611,12 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UniversalBeat|NoteChart", meta = (Tooltip = "Check if note chart is playing."))
 	bool IsPlayingNoteChart() const;
 
+	/**
+	 * Whether note events come from the subsystem's chart clock.
+	 * Note chart sections skip their own OnNoteBeat broadcast while this is true.
+	 */
+	bool IsDrivingNoteEvents() const { return bChartPlaybackActive; }
+
 
 	/**
 	 * Register a song configuration for playback by tag.
@@ -320,10 +650,11 @@ public:
 	/**
 	 * Play a song by directly passing its data asset reference.
 	 * Song will be automatically registered if not already registered.
+	 * If the asset is not resident it is streamed asynchronously and queued/started once loaded.
 	 * 
 	 * @param SongAsset Soft object reference to the song configuration data asset
 	 * @param bQueue If true, enqueue song after current. If false, clear queue and play immediately.
-	 * @return True if song asset is valid and queued/started successfully
+	 * @return True if song asset is valid and queued/started (or its load was requested)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Songs", meta = (Tooltip = "Play song by asset reference. Auto-registers if needed. Queue=true adds to playlist, Queue=false plays immediately."))
 	bool PlaySongByAsset(TSoftObjectPtr<USongConfiguration> SongAsset, bool bQueue = false);
@@ -351,6 +682,67 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UniversalBeat|Songs", meta = (Tooltip = "Check if any song is currently playing."))
 	bool IsPlayingSong() const;
 
+	// ====================================================================
+	// 5. Note Chart System - Judgement Sessions
+	// ====================================================================
+
+	/**
+	 * Create an independent judgement session (own consumption state, calibration and input queue).
+	 * Sessions over the same sequence share one read-only compiled chart. All sessions with queued
+	 * inputs are judged together once per frame, in parallel across worker threads.
+	 *
+	 * @param ChartSequence Sequence whose note chart the session plays (null = the active note chart)
+	 * @param CalibrationOffsetMs Per-session input offset in milliseconds (positive = player presses late)
+	 * @return Session handle, invalid if the sequence has no notes
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Sessions", meta = (Tooltip = "Create an independent judgement session over a sequence's note chart."))
+	FBeatSessionHandle CreateJudgementSession(ULevelSequence* ChartSequence, float CalibrationOffsetMs = 0.0f);
+
+	/** Create a judgement session over an already compiled chart (C++). */
+	FBeatSessionHandle CreateJudgementSessionForChart(const TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe>& Chart, float CalibrationOffsetMs = 0.0f);
+
+	/**
+	 * Destroy a judgement session.
+	 * @return False if the handle is stale
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Sessions", meta = (Tooltip = "Destroy a judgement session."))
+	bool DestroyJudgementSession(FBeatSessionHandle Session);
+
+	/**
+	 * Queue an input for a session; it is judged with the session's other inputs in the next Tick.
+	 * @param Input Input tag and chart time of the press
+	 * @return False if the handle is stale
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Sessions", meta = (Tooltip = "Queue an input for a judgement session."))
+	bool QueueJudgementSessionInput(FBeatSessionHandle Session, const FBeatInputEvent& Input);
+
+	/**
+	 * Set a session's calibration offset.
+	 * @return False if the handle is stale
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Sessions", meta = (Tooltip = "Set a judgement session's calibration offset in milliseconds."))
+	bool SetJudgementSessionCalibration(FBeatSessionHandle Session, float CalibrationOffsetMs);
+
+	/**
+	 * Mark every note of a session unconsumed again (loops, restarts).
+	 * @return False if the handle is stale
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Sessions", meta = (Tooltip = "Reset a judgement session's consumed notes."))
+	bool ResetJudgementSession(FBeatSessionHandle Session);
+
+	/** Number of live judgement sessions */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UniversalBeat|Sessions", meta = (Tooltip = "Get number of judgement sessions."))
+	int32 GetJudgementSessionCount() const { return JudgementSessions.Num(); }
+
+	/** Session state and last results (C++), null if the handle is stale */
+	const FBeatSession* FindJudgementSession(FBeatSessionHandle Session) const;
+
+	/**
+	 * Roll a session's judgement state back to a snapshot of it.
+	 * @return False if the handle is stale or the snapshot was taken for another chart
+	 */
+	bool RestoreJudgementSessionState(FBeatSessionHandle Session, const FNoteJudgementState& Snapshot);
+
 	// ====================================================================
 	// 6. Debug & Utility
 	// ====================================================================
@@ -372,6 +764,53 @@ public:
 	UFUNCTION(BlueprintPure, Category = "UniversalBeat|Debug", meta = (Tooltip = "Check if debug logging is enabled."))
 	bool IsDebugLoggingEnabled() const;
 
+	/**
+	 * Get heap memory held by the loaded note chart and its tracking state.
+	 * Fixed for the lifetime of a chart, including looping playback (also reported as "stat UniversalBeat").
+	 * 
+	 * @return Bytes allocated (0 if no chart is loaded)
+	 */
+	UFUNCTION(BlueprintPure, Category = "UniversalBeat|Debug", meta = (Tooltip = "Get memory used by the loaded note chart in bytes."))
+	int64 GetNoteChartMemoryUsage() const;
+
+	/**
+	 * Get a percentile of a timing measurement collected since the last ResetTimingStats.
+	 * Collected in every build; "UniversalBeat.DumpTimingStats" logs all of them.
+	 * 
+	 * @param Metric Measurement to query
+	 * @param Percentile 0-100 (50 = median)
+	 * @return Milliseconds, accurate to the histogram's bin width (0 if nothing was recorded)
+	 */
+	UFUNCTION(BlueprintPure, Category = "UniversalBeat|Debug", meta = (Tooltip = "Get a percentile of beat tick jitter, input latency or judgement offset in ms."))
+	float GetTimingStatPercentile(EBeatTimingMetric Metric, float Percentile = 50.0f) const;
+
+	/** Clear the timing histograms and counters */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Debug", meta = (Tooltip = "Clear the collected timing measurements."))
+	void ResetTimingStats();
+
+	/** Timing histograms and counters since the last reset */
+	const FBeatTimingStats& GetTimingStats() const { return TimingStats; }
+
+	/**
+	 * Start recording every timing check, tempo and calibration change to a replay file
+	 * (see FBeatReplayRecorder). Replaces a recording in progress.
+	 * 
+	 * @param Filename Output path; relative paths are under the project's Saved/Replays directory
+	 * @return False if the file could not be opened
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Debug", meta = (Tooltip = "Record timing inputs to a compact replay file."))
+	bool StartReplayRecording(const FString& Filename);
+
+	/** Flush and close the replay being recorded */
+	UFUNCTION(BlueprintCallable, Category = "UniversalBeat|Debug", meta = (Tooltip = "Stop recording the input replay."))
+	void StopReplayRecording();
+
+	UFUNCTION(BlueprintPure, Category = "UniversalBeat|Debug", meta = (Tooltip = "Check if an input replay is being recorded."))
+	bool IsRecordingReplay() const { return ReplayRecorder.IsRecording(); }
+
+	/** Recorder of the input replay (C++: in-memory recordings, dropped event counts) */
+	FBeatReplayRecorder& GetReplayRecorder() { return ReplayRecorder; }
+
 	/**
 	 * Get the current beat number since system started.
 	 * 
@@ -392,27 +831,63 @@ public:
 	UFUNCTION(BlueprintPure, Category = "UniversalBeat|Utility", meta = (Tooltip = "Get current beat phase (-1.0 to +1.0). -1.0=edge, 0.0=peak, +1.0=edge"))
 	float GetCurrentBeatPhase() const;
 
+	/**
+	 * Get a copy of the beat clock for lock-free evaluation.
+	 * Safe to call from any thread; the snapshot stays valid until the next BPM,
+	 * calibration or pause change on the game thread.
+	 * 
+	 * @return Beat clock snapshot (query with GetBeatClockTime()-domain timestamps)
+	 */
+	FBeatClock GetBeatClock() const;
+
+	/**
+	 * Current time in the beat clock's domain.
+	 * The custom timing source if set; otherwise real time (FPlatformTime::Seconds),
+	 * or world time when time dilation is respected.
+	 */
+	double GetBeatClockTime() const;
+
 	// ====================================================================
 	// 7. Event Dispatchers
 	// ====================================================================
 
+	/**
+	 * Native subscription to beat, note, input check and BPM events (C++ only).
+	 * Events are queued lock-free when raised and delivered once per frame at the end of Tick,
+	 * without UFunction invocation. The Blueprint events below are fed from the same queue.
+	 */
+	FOnBeatEventNative& OnBeatEventNative() { return BeatEventNative; }
+
+	/** Native subscription receiving every event of a frame in one call, in the order raised */
+	FOnBeatEventBatchNative& OnBeatEventBatchNative() { return BeatEventBatchNative; }
+
+	/** Raise an event for the next dispatch (safe from any thread) */
+	void EnqueueBeatEvent(const FBeatEvent& Event) { PendingBeatEvents.Enqueue(Event); }
+
 	/**
 	 * Event fired when a beat timing check occurs.
 	 * Receives LabelName, InputTag, and TimingValue.
 	 * 
-	 * Performance: Standard UE5 multicast delegate. Scales to hundreds of listeners.
-	 * For best performance, avoid expensive operations in event handlers.
-	 * Use Unreal Insights to profile event handler performance if needed.
+	 * Delivered from the event queue at the end of the frame's Tick.
+	 * Performance: Dynamic multicast delegate; C++ listeners should use OnBeatEventNative instead.
 	 */
 	UPROPERTY(BlueprintAssignable, Category = "UniversalBeat|Events")
 	FOnBeatInputCheck OnBeatInputCheck;
 
+	/**
+	 * Event fired once per CheckBeatTimingBatch call.
+	 * Receives all results of the batch (input order) and how many of them hit.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "UniversalBeat|Events")
+	FOnBeatInputBatchCheck OnBeatInputBatchCheck;
+
 	/**
 	 * Event fired when a beat or beat subdivision occurs (if broadcasting enabled).
-	 * Receives FBeatEventData with beat number, subdivision info, and timestamp.
+	 * Receives FBeatEventData with beat number, subdivision info, the beat's ideal time and
+	 * the time until it (see SetBeatEventLookahead).
 	 * 
-	 * Performance: Standard UE5 multicast delegate. Scales to hundreds of listeners.
-	 * Use Unreal Insights to profile event handler performance if needed.
+	 * Delivered from the event queue at the end of the frame's Tick, one event per beat crossed.
+	 * Performance: Dynamic multicast delegate; C++ listeners should use OnBeatEventNative instead.
 	 */
 	UPROPERTY(BlueprintAssignable, Category = "UniversalBeat|Events")
 	FOnBeat OnBeat;
@@ -440,6 +915,14 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "UniversalBeat|Song Events")
 	FOnSongEnded OnSongEnded;
 
+	/**
+	 * Event fired when the first track of a song is resident in memory and playback can begin.
+	 * Tracks are streamed asynchronously, so this fires after OnSongStarted and before OnTrackStarted.
+	 * Receives the song tag.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "UniversalBeat|Song Events")
+	FOnSongReady OnSongReady;
+
 	/**
 	 * Event fired when an individual track starts playing (after delay).
 	 * Receives song tag and track index.
@@ -468,6 +951,43 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "UniversalBeat|Note Events")
 	FOnNoteBeat OnNoteBeat;
 
+	/**
+	 * Event fired when a note enters the lookahead window (see SetNoteLookahead).
+	 * Receives the note and the seconds left until its time; use it to spawn approaching visuals.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "UniversalBeat|Note Events")
+	FOnNoteApproach OnNoteApproach;
+
+	/**
+	 * Event fired when a note's timing window closes without a hit.
+	 * The subsystem sweeps the chart once per frame; missed notes can no longer be hit.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "UniversalBeat|Note Events")
+	FOnNoteMissed OnNoteMissed;
+
+	/**
+	 * Event fired once per frame with every note missed that frame (after the OnNoteMissed calls).
+	 * Prefer this for combo/score bookkeeping.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "UniversalBeat|Note Events")
+	FOnNotesMissed OnNotesMissed;
+
+	/**
+	 * Event fired when a Hold note is sustained to its end, or released within tolerance of it.
+	 * Receives the note and the accuracy of its head press. Early releases are reported by
+	 * the CheckBeatRelease* result instead.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "UniversalBeat|Note Events")
+	FOnNoteHoldCompleted OnNoteHoldCompleted;
+
+	/**
+	 * Event fired for each judgement session that had inputs this frame.
+	 * Receives the session, its results in queue order and how many hit.
+	 * Results are only converted for Blueprint when something is bound.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "UniversalBeat|Sessions")
+	FOnJudgementSessionEvaluated OnJudgementSessionEvaluated;
+
 private:
 	// ====================================================================
 	// Internal State
@@ -476,11 +996,14 @@ private:
 	/** Current beats per minute */
 	float CurrentBPM = 120.0f;
 
-	/** Queued BPM change awaiting next timer cycle completion */
+	/** Queued BPM change awaiting the next whole beat */
 	float PendingBPM = 0.0f;
 
-	/** Counter for timer fires since subsystem start (for subdivision filtering) */
-	int32 CurrentBeatTick = 0;
+	/** Last beat clock tick delivered (for subdivision filtering) */
+	int64 CurrentBeatTick = 0;
+
+	/** Seconds ahead of their ideal time that beat ticks are delivered */
+	float BeatEventLookaheadSeconds = 0.0f;
 
 	/** Whether beat timing follows time dilation */
 	bool bRespectTimeDilation = false;
@@ -489,6 +1012,9 @@ private:
 	UPROPERTY()
 	TObjectPtr<UCurveFloat> TimingCurve = nullptr;
 
+	/** TimingCurve (or the triangle fallback) baked over [0, 1] */
+	FTimingCurveLUT TimingCurveLUT;
+
 	/** Player calibration offset in milliseconds */
 	float CalibrationOffsetMs = 0.0f;
 
@@ -498,38 +1024,67 @@ private:
 	/** Current subdivision level for broadcasting */
 	EBeatSubdivision CurrentSubdivision = EBeatSubdivision::None;
 
-	/** Current subdivision level for beat timing */
-	uint8 InternalSubdivision = 16;
-
 	/** Whether debug logging is enabled */
 	bool bDebugLoggingEnabled = false;
 
+	/** Beat tick jitter, input latency and judgement offset measurements */
+	FBeatTimingStats TimingStats;
+
+	/** Input replay, idle until StartReplayRecording */
+	FBeatReplayRecorder ReplayRecorder;
+
 	/** Event fired when BPM changes */
 	UPROPERTY(BlueprintAssignable, Category = "UniversalBeat|Events")
 	FOnBPMChanged OnBPMChanged;
 
-	/** Timer handle for beat broadcasting (Universal Beat Timer) */
-	FTimerHandle BeatBroadcastTimer;
-
 	/** Timer handle for calibration sequence */
 	FTimerHandle CalibrationTimer;
 
-	/** Calibration sequence state */
+	/** Calibration sequence state (CalibrationTotalPrompts is 0 when no sequence runs) */
 	int32 CalibrationPromptsRemaining = 0;
 	int32 CalibrationTotalPrompts = 0;
-	TArray<float> CalibrationOffsets;
+	FBeatCalibrationEstimator CalibrationEstimator;
+
+	/** Passive recalibration during play */
+	FBeatCalibrationEstimator PassiveCalibrationEstimator;
+	bool bPassiveCalibrationEnabled = false;
+	bool bPassiveCalibrationAutoApply = false;
 
 	/** Flag to prevent repeated curve fallback warnings */
 	bool bCurveFallbackWarningLogged = false;
 
-	/** Cached beat phase when entering pause (for pause handling) */
-	mutable float CachedPausePhase = 0.0f;
-	
-	/** Cached time when entering pause */
-	mutable double CachedPauseTime = 0.0;
-	
-	/** Whether we are currently in a paused state */
-	mutable bool bIsPaused = false;
+	/** Analytic beat clock (source of phase, beat number and tick) */
+	FBeatClock BeatClock;
+
+	/** Guards BeatClock for snapshots taken off the game thread */
+	mutable FRWLock BeatClockLock;
+
+	/** Custom timing source (null = default real/world time) */
+	TSharedPtr<IBeatTimingSource, ESPMode::ThreadSafe> TimingSource;
+
+	/** Slate preprocessor capturing press timestamps (game worlds only) */
+	TSharedPtr<FBeatInputPreprocessor> InputPreprocessor;
+
+	/** Independent judgement sessions, addressed by FBeatSessionHandle */
+	TSparseArray<FBeatSession> JudgementSessions;
+
+	/** Generation handed to the next created session */
+	uint32 NextJudgementSessionSerial = 1;
+
+	/** Charts compiled for sessions, shared between sessions on the same sequence */
+	TMap<TWeakObjectPtr<const ULevelSequence>, TWeakPtr<FCompiledNoteChart, ESPMode::ThreadSafe>> JudgementSessionCharts;
+
+	/** Reused when converting session results for OnJudgementSessionEvaluated */
+	TArray<FNoteValidationResult> JudgementSessionResultScratch;
+
+	/** Events raised since the last dispatch (multiple producers, drained on the game thread) */
+	TQueue<FBeatEvent, EQueueMode::Mpsc> PendingBeatEvents;
+
+	/** Events of the current dispatch, reused across frames */
+	TArray<FBeatEvent> DispatchedBeatEvents;
+
+	FOnBeatEventNative BeatEventNative;
+	FOnBeatEventBatchNative BeatEventBatchNative;
 
 	// Note Chart System State
 
@@ -543,6 +1098,16 @@ private:
 	/** Queue of tracks from current song to play sequentially */
 	TQueue<FNoteTrackEntry> QueuedTracks;
 
+	/** Tracks of the current song while it plays them concurrently (empty for sequential songs) */
+	TArray<FActiveSongTrack> ActiveSongTracks;
+
+	/** Next track of the queue, pre-rolled for a gapless start (see PrepareNextTrack) */
+	FPreparedSongTrack PreparedTrack;
+
+	/** Keeps the prepared chart's note assets reachable, swapped with NoteChartAssets on start */
+	UPROPERTY()
+	TArray<TObjectPtr<UNoteDataAsset>> PreparedNoteChartAssets;
+
 	/** Currently playing song configuration */
 	UPROPERTY()
 	TObjectPtr<USongConfiguration> CurrentlyPlayingSong = nullptr;
@@ -553,56 +1118,161 @@ private:
 	/** Timer handle for delayed track start */
 	FTimerHandle TrackDelayTimer;
 
+	/** Async load of the current track (sequence + the note assets and icons it references) */
+	TSharedPtr<FStreamableHandle> TrackLoadHandle;
+
+	/** Async prefetch of the next queued track, keeps it resident until it plays */
+	TSharedPtr<FStreamableHandle> TrackPrefetchHandle;
+
+	/** In-flight loads requested by PlaySongByAsset */
+	TArray<TSharedPtr<FStreamableHandle>> SongLoadHandles;
+
+	/** Incremented per track load request; stale load callbacks are ignored */
+	uint32 TrackLoadSerial = 0;
+
+	/** Whether OnSongReady has fired for the current song */
+	bool bCurrentSongReady = false;
+
 	// Note Chart Tracking (moved from UNoteChartDirector)
 
-	/** Dedicated sequence actor for note chart playback */
+	/** Dedicated sequence actor for note chart playback (player slot 0) */
 	UPROPERTY()
 	TObjectPtr<ALevelSequenceActor> SongPlayerActor = nullptr;
 
+	/** Further sequence actors for concurrent tracks (player slots 1..N), kept and reused across songs */
+	UPROPERTY()
+	TArray<TObjectPtr<ALevelSequenceActor>> SongPlayerPool;
+
 	/** Currently loaded note chart sequence */
 	UPROPERTY()
 	TObjectPtr<ULevelSequence> CurrentNoteChartSequence = nullptr;
 
-	/** Cached sorted notes from all note chart sections */
-	UPROPERTY()
-	TArray<FNoteInstance> CachedNotesSorted;
+	/** Compiled note chart of the loaded sequence (null when no chart is loaded) */
+	TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> NoteChart;
 
-	/** Set of consumed note timestamps (for fast lookup) */
+	/** Keeps the compiled chart's note assets reachable; the chart itself is not a UObject */
 	UPROPERTY()
-	TSet<int32> ConsumedNoteTimestamps;
+	TArray<TObjectPtr<UNoteDataAsset>> NoteChartAssets;
 
-	/** Current note index for sequential playback tracking */
-	int32 CurrentNoteIndex = 0;
+	/** Consumption and lane cursors of the local input stream over NoteChart */
+	FNoteJudgementState JudgementState;
 
-	/** Frame rate of the registered sequence (cached for performance) */
+	/** Tick resolution of the registered sequence (note keys are stored in ticks, not display frames) */
 	FFrameRate CachedSequenceFrameRate;
 
+	// Chart Playback Clock
+
+	/** Whether chart time is advancing (notes fire from Tick, not from sequencer evaluation) */
+	bool bChartPlaybackActive = false;
+
+	/** Beat clock time at which the current pass started (same domain as GetBeatClockTime) */
+	double ChartStartTime = 0.0;
+
+	/** Sequence time of the playback range start; chart time = ChartRangeStartSeconds + elapsed */
+	double ChartRangeStartSeconds = 0.0;
+
+	/** Chart time held while the beat timer is paused */
+	double ChartPausedTime = 0.0;
+
+	/** Whether chart time is frozen */
+	bool bChartPaused = false;
+
+	/** Length of one pass over the sequence playback range in seconds */
+	double ChartDurationSeconds = 0.0;
+
+	/** Remaining extra passes over the sequence (FNoteTrackEntry::LoopCount semantics) */
+	int32 ChartLoopsRemaining = 0;
+
+	/** Tempo map segment of the chart currently applied to the beat clock (INDEX_NONE = no tempo map) */
+	int32 ChartTempoSegment = INDEX_NONE;
+
+	/** Next compiled note to broadcast through OnNoteBeat */
+	int32 NextTriggerNote = 0;
+
+	/** Lookahead window length and unit (see SetNoteLookahead) */
+	float NoteLookahead = 0.0f;
+	bool bNoteLookaheadInBeats = true;
+
+	/** Next compiled note to enter the lookahead window */
+	int32 LookaheadEnterCursor = 0;
+
+	/** Compiled indices returned by this frame's miss sweep */
+	TArray<int32> MissedNoteScratch;
+
+	/** Reused for the OnNotesMissed batch */
+	TArray<FNoteInstance> MissedNoteInstances;
+
+	/** Judgements returned by this frame's hold completion */
+	TArray<FNoteJudgement> CompletedHoldScratch;
+
+	/** Sequence has tracks besides note charts (or bindings) that need sequencer evaluation */
+	bool bChartEvaluatesSequencer = false;
+
+	/** Display rate of the sequence, cosmetic tracks are evaluated at most once per display frame */
+	FFrameRate ChartDisplayRate;
+
+	/** Last display frame the sequencer was evaluated at (INDEX_NONE = not evaluated this pass) */
+	int32 LastEvaluatedDisplayFrame = INDEX_NONE;
+
 	// ====================================================================
 	// Internal Helper Functions
 	// ====================================================================
 
-	/** Get timer rate in seconds (1/16th note interval) */
-	float GetTimerRate() const;
-
-	/** Recreate timer with current or new rate */
+	/** Restart the beat clock at the current BPM and calibration offset */
 	void RecreateTimerWithNewRate();
 
-	/** Calculate current beat phase (0.0-1.0 within beat) */
+	/** Continue tick delivery from the clock's current tick after it was restarted (no ticks are replayed) */
+	void ResetBeatTickCursor();
+
+	/**
+	 * Switch tempo at a beat clock time while keeping beat number and phase continuous.
+	 * Re-bakes windows of charts without a tempo map.
+	 */
+	void ApplyTempoChange(float NewBPM, double ClockTime);
+
+	/** Apply every tempo map segment of the chart that starts at or before ChartTime */
+	void UpdateChartTempo(const FCompiledNoteChart& Chart, double ChartTime);
+
+	/** Anchor the beat clock to the chart's beat grid at the start of a pass */
+	void AlignBeatClockToChart(const FCompiledNoteChart& Chart);
+
+	/** Calculate current beat phase (-1.0 to +1.0 within tick) from the beat clock */
 	float CalculateBeatPhase() const;
 
-	/** Evaluate timing curve with validation and fallback */
+	/** Sample the baked timing curve (warns once while running on the fallback) */
 	float EvaluateTimingCurve(float BeatPhase);
 
 	/** Internal timing check implementation shared by label and tag versions */
-	float CheckBeatTimingInternal(FName LabelName, FGameplayTag InputTag);
+	float CheckBeatTimingInternal(FName LabelName, FGameplayTag InputTag, double ClockTime);
+
+	/** Map an FPlatformTime::Seconds() timestamp into the beat clock's time domain */
+	double PlatformTimeToBeatClockTime(double PlatformSeconds) const;
+
+	/** Deliver every beat tick crossed since the last frame (and within the lookahead), applying a queued BPM change on its beat */
+	void AdvanceBeatTicks();
+
+	/** Record and broadcast one tick at its ideal clock time; Now is the clock time of this frame */
+	void BroadcastBeatEvent(int64 Tick, double IdealTickTime, double Now);
+
+	/** Map a beat clock time into the FPlatformTime::Seconds() domain */
+	double BeatClockTimeToPlatformTime(double ClockTime) const;
 
-	/** Beat broadcasting callback */
-	void BroadcastBeatEvent();
+	/** Drain the event queue: native batch listeners, native listeners, then Blueprint events */
+	void DispatchBeatEvents();
 
 	/** Calibration sequence callbacks */
 	void PresentCalibrationPrompt();
-	void ProcessCalibrationInput(float TimingValue);
+	void ProcessCalibrationInput(double ClockTime);
 	void CompleteCalibrationSequence();
+
+	/** Feed the passive estimator one sample in milliseconds and apply it if configured */
+	void AddPassiveCalibrationSample(float OffsetMs);
+
+	/**
+	 * Offset of a beat tap at ClockTime from the nearest beat, in milliseconds (positive = late),
+	 * measured against the uncalibrated beat so it is directly a calibration offset
+	 */
+	float GetCalibrationSampleMs(double ClockTime) const;
 	
 	/** Check if game is currently paused */
 	bool IsPausedState() const;
@@ -618,6 +1288,35 @@ private:
 	/** Dequeue and play next track from current song */
 	void PlayTrack();
 
+	/** Current track's assets are resident: broadcast readiness, prefetch the next track and apply the delay */
+	void OnTrackLoaded();
+
+	/** Stream in the next queued track, or the first track of the next queued song, and pre-roll it */
+	void PrefetchNextTrack();
+
+	/** Compile the next track's chart and bind its sequence to the back player (see FPreparedSongTrack) */
+	void PrepareNextTrack();
+
+	/** Drop the pre-rolled track */
+	void ResetPreparedTrack();
+
+	/** Prepared track is the next one the queue would play */
+	bool IsPreparedTrackNext() const;
+
+	/**
+	 * Move on to the pre-rolled track when the current one ends, without unloading anything.
+	 * Crosses into the next queued song when the prepared track is its first.
+	 * @param EndClockTime Beat clock time the current track ended at
+	 * @return False if nothing is prepared for the next track (the caller falls back to PlayTrack)
+	 */
+	bool AdvanceToPreparedTrack(double EndClockTime);
+
+	/** Swap the prepared chart, judgement state and player in and start the chart clock at StartClockTime */
+	void StartPreparedTrack(double StartClockTime);
+
+	/** Register and play an already loaded song asset */
+	bool PlayLoadedSongAsset(USongConfiguration* LoadedSong, bool bQueue);
+
 	/** Start a track with delay */
 	void StartTrackWithDelay(float DelaySeconds);
 
@@ -627,14 +1326,19 @@ private:
 	/** Callback when a track sequence finishes */
 	UFUNCTION()
 	void OnTrackSequenceFinished();
-	
-	/** Callback when SongPlayerActor finishes (delegates to OnTrackSequenceFinished) */
-	UFUNCTION()
-	void OnSongPlayerFinished();
 
 	/** Check if all non-looping tracks have completed */
 	bool CheckSongCompletion() const;
 
+	/** Stream every track of the current song at once (bPlayTracksConcurrently) */
+	void PlayConcurrentTracks();
+
+	/** All tracks are resident: merge their charts, assign pooled players and start the merged chart clock */
+	void OnConcurrentTracksLoaded();
+
+	/** Start, end and evaluate the concurrent tracks at a merged chart time; at the end of the pass every track ends */
+	void UpdateConcurrentTracks(double ChartTime, bool bPassEnded);
+
 	// Note Chart Helpers (moved from UNoteChartDirector)
 
 	/** Load notes from a level sequence for validation tracking */
@@ -643,14 +1347,32 @@ private:
 	/** Clear all loaded notes and reset tracking state */
 	void ClearNoteChart();
 
-	/** Find next note with matching tag within timing window */
-	bool GetNextNoteForTag(FGameplayTag NoteTag, float CurrentTime, FNoteInstance& OutNote);
+	/**
+	 * Make a compiled chart the active one: bake windows for the current BPM and reset consumption.
+	 * A chart still shared elsewhere (a song's cooked chart) is baked as a copy rather than retargeted.
+	 */
+	void SetActiveNoteChart(TSharedPtr<FCompiledNoteChart, ESPMode::ThreadSafe> InChart);
+
+	/** Rebake the active and session charts' lane windows for the current BPM, copying shared ones */
+	void RebuildNoteLaneWindows();
+
+	/** Judge the queued inputs of all sessions (parallel), then broadcast results on the game thread */
+	void EvaluateJudgementSessions();
+
+	/** Resolve a session handle, null if stale */
+	FBeatSession* ResolveJudgementSession(FBeatSessionHandle Session);
+
+	/** Record the latency of an input stamped at InputPlatformTime that is being judged now */
+	void RecordInputLatency(double InputPlatformTime);
+
+	/** Shared body of the CheckBeatTimingByTag* and CheckBeatRelease* queries */
+	FNoteValidationResult CheckNoteInputAtTime(FGameplayTag InputTag, double InputPlatformTime, bool bRelease);
 
-	/** Mark a note as consumed (prevents re-validation) */
-	void MarkNoteConsumed(const FNoteInstance& Note);
+	/** Validate one press or release at a chart time against the loaded chart, consuming the note on a hit */
+	void JudgeNoteInput(FGameplayTag InputTag, double ChartTime, FNoteValidationResult& OutResult, bool bRelease = false);
 
-	/** Check if a note has been consumed */
-	bool IsNoteConsumed(const FNoteInstance& Note) const;
+	/** Queue the completion event of a hold */
+	void EnqueueHoldCompleted(const FCompiledNoteChart& Chart, const FNoteJudgement& Judgement);
 
 	/** Convert frame number to seconds using cached sequence frame rate */
 	float FrameToSeconds(FFrameNumber Frame) const;
@@ -658,12 +1380,61 @@ private:
 	/** Convert seconds to frame number using cached sequence frame rate */
 	FFrameNumber SecondsToFrame(float Seconds) const;
 
-	/** Get current playback time from song player */
+	/** Get current playback time: chart time while the chart clock runs, else the song player position */
 	float GetCurrentPlaybackTime() const;
 
+	/** Start the chart clock for a sequence at the current beat clock time */
+	void StartChartPlayback(ULevelSequence* Sequence, int32 LoopCount);
+
+	/**
+	 * Start the chart clock over an explicit range
+	 * @param DebugName Shown in the debug log
+	 * @param StartClockTime Beat clock time the range starts at (may have just passed, for a gapless track switch)
+	 */
+	void StartChartPlaybackRange(double RangeStartSeconds, double DurationSeconds, int32 LoopCount, FFrameRate DisplayRate, bool bEvaluatesSequencer, const FString& DebugName, double StartClockTime);
+
+	/** Stop the chart clock */
+	void StopChartPlayback();
+
+	/** Advance chart time: fire due notes, handle loops and track end, evaluate cosmetic tracks */
+	void AdvanceChartPlayback();
+
+	/** Current chart time in sequence seconds (same timeline as compiled note times) */
+	double GetChartTime() const;
+
+	/** Chart time at a beat clock time */
+	double GetChartTimeAt(double ClockTime) const;
+
+	/** Beat clock time at a chart time (inverse of GetChartTimeAt while the chart plays) */
+	double ChartTimeToBeatClockTime(double ChartTime) const;
+
+	/** Move the lookahead enter cursor to a chart time; at the end of a pass every remaining note enters */
+	void UpdateNoteLookahead(const FCompiledNoteChart& Chart, double ChartTime, bool bPassEnded);
+
+	/** Sweep notes whose window closed before ChartTime and queue their miss events */
+	void SweepMissedNotes(const FCompiledNoteChart& Chart, double ChartTime);
+
+	/** Complete the holds whose sustain ended by ChartTime and queue their events */
+	void CompleteHeldNotes(const FCompiledNoteChart& Chart, double ChartTime);
+
+	/** Queue the OnNoteBeat event of a compiled note */
+	void EnqueueNoteEvent(const FCompiledNoteChart& Chart, int32 NoteIndex);
+
+	/** Evaluate the song player at a display frame of the current sequence */
+	void EvaluateSequencerAt(int32 DisplayFrame, bool bJump);
+
 	/** Create or get the SongPlayer actor and player using static factory method */
 	void EnsureSongPlayerActor();
 
+	/** Spawn one transient, non-autoplaying sequence actor */
+	ALevelSequenceActor* SpawnSongPlayerActor(FName ActorName);
+
+	/** Get the sequence actor of a player slot, spawning it the first time the slot is used */
+	ALevelSequenceActor* AcquireSongPlayer(int32 Slot);
+
+	/** Stop every player of the pool that is playing */
+	void StopSongPlayers();
+
 	/** Get the sequence player from SongPlayerActor with validation */
 	ULevelSequencePlayer* GetSongPlayer() const;
 };
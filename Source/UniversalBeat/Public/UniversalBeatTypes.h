@@ -80,15 +80,25 @@ struct UNIVERSALBEAT_API FBeatEventData
 	UPROPERTY(BlueprintReadOnly, Category = "UniversalBeat")
 	EBeatSubdivision SubdivisionType = EBeatSubdivision::None;
 
-	/** Absolute time of this beat event (from FPlatformTime::Seconds) */
+	/** Ideal time of this beat on the FPlatformTime::Seconds timeline (not the time it was delivered) */
 	UPROPERTY(BlueprintReadOnly, Category = "UniversalBeat")
 	double EventTimestamp = 0.0;
 
+	/** Ideal time of this beat on the beat clock (the audio clock when one drives timing) */
+	UPROPERTY(BlueprintReadOnly, Category = "UniversalBeat")
+	double BeatClockTime = 0.0;
+
+	/** Seconds from delivery until the beat: negative once it has passed, positive when delivered ahead */
+	UPROPERTY(BlueprintReadOnly, Category = "UniversalBeat")
+	float TimeUntil = 0.0f;
+
 	FBeatEventData()
 		: BeatNumber(0)
 		, SubdivisionIndex(0)
 		, SubdivisionType(EBeatSubdivision::None)
 		, EventTimestamp(0.0)
+		, BeatClockTime(0.0)
+		, TimeUntil(0.0f)
 	{
 	}
 };
@@ -128,6 +138,17 @@ enum class ENoteInteractionType : uint8
 	Release		UMETA(DisplayName = "Release")
 };
 
+/**
+ * Timing measurements collected by the subsystem (see GetTimingStatPercentile)
+ */
+UENUM(BlueprintType)
+enum class EBeatTimingMetric : uint8
+{
+	TickJitter		UMETA(DisplayName = "Tick Jitter", ToolTip = "Beat tick delivery time minus ideal tick time"),
+	InputLatency	UMETA(DisplayName = "Input Latency", ToolTip = "Time from a timestamped input to its judgement"),
+	JudgementOffset	UMETA(DisplayName = "Judgement Offset", ToolTip = "Input time minus note time of note hits")
+};
+
 /**
  * Timing direction indicators for input validation feedback
  */
@@ -180,6 +201,22 @@ struct UNIVERSALBEAT_API FNoteValidationResult
 	UPROPERTY(BlueprintReadOnly, Category = "UniversalBeat|Notes")
 	TObjectPtr<const UNoteDataAsset> NoteData = nullptr;
 
+	/** Interaction type of the judged note */
+	UPROPERTY(BlueprintReadOnly, Category = "UniversalBeat|Notes")
+	ENoteInteractionType InteractionType = ENoteInteractionType::Press;
+
+	/** Whether this result ends a hold; TimingOffset is then relative to the sustain end */
+	UPROPERTY(BlueprintReadOnly, Category = "UniversalBeat|Notes")
+	bool bHoldEnd = false;
+
+	/** Sixteenth-note ticks the hold was sustained for (hold ends only) */
+	UPROPERTY(BlueprintReadOnly, Category = "UniversalBeat|Notes")
+	int32 SustainTicks = 0;
+
+	/** Fraction of the hold's ticks that were sustained, 1.0 when completed (hold ends only) */
+	UPROPERTY(BlueprintReadOnly, Category = "UniversalBeat|Notes")
+	float SustainRatio = 0.0f;
+
 	FNoteValidationResult()
 		: bHit(false)
 		, Accuracy(0.0f)
@@ -191,6 +228,61 @@ struct UNIVERSALBEAT_API FNoteValidationResult
 	}
 };
 
+/**
+ * One timestamped input for batched note validation
+ */
+USTRUCT(BlueprintType)
+struct UNIVERSALBEAT_API FBeatInputEvent
+{
+	GENERATED_BODY()
+
+	/** Gameplay tag of the pressed input */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "UniversalBeat|Notes")
+	FGameplayTag InputTag;
+
+	/** Chart time of the press in seconds (same timeline as note timestamps) */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "UniversalBeat|Notes")
+	double Timestamp = 0.0;
+
+	/** Input was released rather than pressed (ends holds, judges Release notes) */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "UniversalBeat|Notes")
+	bool bIsRelease = false;
+
+	FBeatInputEvent()
+		: Timestamp(0.0)
+	{
+	}
+
+	FBeatInputEvent(FGameplayTag InInputTag, double InTimestamp, bool bInIsRelease = false)
+		: InputTag(InInputTag)
+		, Timestamp(InTimestamp)
+		, bIsRelease(bInIsRelease)
+	{
+	}
+};
+
+/**
+ * Handle to an independent judgement session of the UniversalBeat subsystem
+ */
+USTRUCT(BlueprintType)
+struct UNIVERSALBEAT_API FBeatSessionHandle
+{
+	GENERATED_BODY()
+
+	/** Slot in the subsystem's session array */
+	int32 Index = INDEX_NONE;
+
+	/** Slot generation; a handle to a destroyed session never resolves to its replacement */
+	uint32 Serial = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	bool operator==(const FBeatSessionHandle& Other) const { return Index == Other.Index && Serial == Other.Serial; }
+	bool operator!=(const FBeatSessionHandle& Other) const { return !(*this == Other); }
+
+	friend uint32 GetTypeHash(const FBeatSessionHandle& Handle) { return HashCombine(::GetTypeHash(Handle.Index), ::GetTypeHash(Handle.Serial)); }
+};
+
 /**
  * Instance of a note within a sequence at a specific timestamp
  */
@@ -18,6 +18,7 @@ public class UniversalBeat : ModuleRules
 				"CoreUObject",
 				"Engine",
 				"GameplayTags",
+				"InputCore",
 				"LevelSequence",
 				"MovieScene",
 				"MovieSceneTracks"
@@ -25,9 +26,13 @@ public class UniversalBeat : ModuleRules
 		);
 		PrivateDependencyModuleNames.AddRange(new string[]
 			{
+				"Slate",
 				"SlateCore",
+				"TraceLog",
 				"AnimGraphRuntime",
-				"PropertyPath"
+				"PropertyPath",
+				"AudioMixer",
+				"AudioMixerCore"
 			});
 		if (Target.bBuildWithEditorOnlyData && Target.bBuildEditor)
 		{
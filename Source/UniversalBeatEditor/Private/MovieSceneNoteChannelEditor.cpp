@@ -10,34 +10,25 @@ namespace Sequencer
 
 void DrawKeys(FMovieSceneNoteChannel* Channel, TArrayView<const FKeyHandle> InKeyHandles, const UMovieSceneSection* InOwner, TArrayView<FKeyDrawParams> OutKeyDrawParams)
 {
-	// Get channel data to retrieve note information
-	TMovieSceneChannelData<const FNoteChannelValue> ChannelData = Channel->GetData();
+	// Sequencer only asks for the keys on screen (FMovieSceneNoteChannel::GetKeys binary searches
+	// the visible range); every key shares one brush so Slate draws them in a single batch
+	const FSlateBrush* KeyBrush = FAppStyle::Get().GetBrush("Sequencer.KeyDiamond");
+	const FLinearColor ValidTint(0.3f, 0.8f, 0.3f, 1.0f); // Green for valid notes
+	const FLinearColor InvalidTint(0.8f, 0.3f, 0.3f, 1.0f); // Red for invalid notes
+
+	TMovieSceneChannelData<FNoteChannelValue> ChannelData = Channel->GetData();
+	TArrayView<const FNoteChannelValue> KeyValues = ChannelData.GetValues();
 	
-	// Draw each key as a diamond marker
 	for (int32 Index = 0; Index < InKeyHandles.Num(); ++Index)
 	{
 		FKeyDrawParams& Params = OutKeyDrawParams[Index];
 		
-		// Get the key index from handle using the channel's GetIndex method
-		int32 KeyIndex = Channel->GetIndex(InKeyHandles[Index]);
-		
-		if (KeyIndex != INDEX_NONE && ChannelData.GetValues().IsValidIndex(KeyIndex))
+		const int32 KeyIndex = ChannelData.GetIndex(InKeyHandles[Index]);
+		if (KeyValues.IsValidIndex(KeyIndex))
 		{
-			const FNoteChannelValue& NoteValue = ChannelData.GetValues()[KeyIndex];
-			
-			// Set visual style for note keys
-			Params.BorderBrush = FAppStyle::Get().GetBrush("Sequencer.KeyDiamond");
-			Params.FillBrush = FAppStyle::Get().GetBrush("Sequencer.KeyDiamond");
-			
-			// Use different color if note has no data assigned
-			if (NoteValue.NoteData)
-			{
-				Params.FillTint = FLinearColor(0.3f, 0.8f, 0.3f, 1.0f); // Green for valid notes
-			}
-			else
-			{
-				Params.FillTint = FLinearColor(0.8f, 0.3f, 0.3f, 1.0f); // Red for invalid notes
-			}
+			Params.BorderBrush = KeyBrush;
+			Params.FillBrush = KeyBrush;
+			Params.FillTint = KeyValues[KeyIndex].NoteData ? ValidTint : InvalidTint;
 		}
 	}
 }
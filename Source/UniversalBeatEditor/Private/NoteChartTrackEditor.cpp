@@ -3,23 +3,50 @@
 #include "NoteChartTrackEditor.h"
 #include "MovieSceneNoteChartTrack.h"
 #include "MovieSceneNoteChartSection.h"
+#include "NoteDataAsset.h"
+#include "TempoMap.h"
 #include "ISequencer.h"
 #include "ISequencerSection.h"
 #include "SequencerSectionPainter.h"
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 #include "Styling/AppStyle.h"
+#include "Algo/BinarySearch.h"
+#include "Engine/Texture2D.h"
+#include "ScopedTransaction.h"
+#include "TimeToPixel.h"
+#include "UObject/ObjectKey.h"
 
 #define LOCTEXT_NAMESPACE "FNoteChartTrackEditor"
 
+namespace NoteChartSectionDrawing
+{
+	/** Icon edge length in slate units */
+	static constexpr float IconSize = 14.0f;
+
+	/** Below this much room per visible note, notes are drawn as density bars instead of icons */
+	static constexpr float MinPixelsPerIcon = 16.0f;
+
+	/** Width of one density bar column */
+	static constexpr float DensityBarWidth = 4.0f;
+
+	/** Must match the tint DrawKeys gives valid notes */
+	static const FLinearColor DensityBarColor(0.3f, 0.8f, 0.3f, 0.8f);
+}
+
 /**
  * Section interface for note chart sections
  * Handles visual display and interaction in the Sequencer timeline
+ *
+ * Painting only visits the notes on screen (binary search over the sorted key times). Zoomed
+ * in, each note's icon is drawn with one cached brush per note type so Slate batches them;
+ * zoomed out, the visible notes are summarised as density bars, one binary search per column.
  */
 class FNoteChartSection : public ISequencerSection
 {
 public:
-	FNoteChartSection(UMovieSceneSection& InSectionObject)
+	FNoteChartSection(UMovieSceneSection& InSectionObject, TWeakPtr<ISequencer> InSequencer)
 		: SectionObject(InSectionObject)
+		, Sequencer(InSequencer)
 	{
 	}
 
@@ -41,11 +68,272 @@ public:
 
 	virtual int32 OnPaintSection(FSequencerSectionPainter& Painter) const override
 	{
-		return Painter.PaintSectionBackground();
+		using namespace NoteChartSectionDrawing;
+
+		const int32 LayerId = Painter.PaintSectionBackground();
+
+		const UMovieSceneNoteChartSection* NoteSection = Cast<UMovieSceneNoteChartSection>(&SectionObject);
+		if (!NoteSection)
+		{
+			return LayerId;
+		}
+
+		// Only the part of the section that is on screen
+		const FVector2D SectionSize = Painter.SectionGeometry.GetLocalSize();
+		const FVector2D ClipMin = Painter.SectionGeometry.AbsoluteToLocal(Painter.SectionClippingRect.GetTopLeft());
+		const FVector2D ClipMax = Painter.SectionGeometry.AbsoluteToLocal(Painter.SectionClippingRect.GetBottomRight());
+		const float MinX = FMath::Max<float>(ClipMin.X, 0.0f);
+		const float MaxX = FMath::Min<float>(ClipMax.X, SectionSize.X);
+		if (MaxX <= MinX)
+		{
+			return LayerId;
+		}
+
+		const FTimeToPixel& TimeToPixel = Painter.GetTimeConverter();
+		const FFrameNumber StartFrame = TimeToPixel.PixelToFrame(MinX).FloorToFrame();
+		const FFrameNumber EndFrame = TimeToPixel.PixelToFrame(MaxX).CeilToFrame();
+
+		TMovieSceneChannelData<const FNoteChannelValue> ChannelData = NoteSection->GetNoteChannel().GetData();
+		TArrayView<const FFrameNumber> KeyTimes = ChannelData.GetTimes();
+		const int32 FirstKey = Algo::LowerBound(KeyTimes, StartFrame);
+		const int32 EndKey = Algo::UpperBound(KeyTimes, EndFrame);
+		if (EndKey <= FirstKey)
+		{
+			return LayerId;
+		}
+
+		const float PixelsPerNote = (MaxX - MinX) / (EndKey - FirstKey);
+		return PixelsPerNote < MinPixelsPerIcon
+			? PaintDensityBars(Painter, LayerId, KeyTimes, FirstKey, EndKey, MinX, MaxX)
+			: PaintNoteIcons(Painter, LayerId, ChannelData, FirstKey, EndKey);
+	}
+
+	virtual void BuildSectionContextMenu(FMenuBuilder& MenuBuilder, const FGuid& ObjectBinding) override
+	{
+		TWeakObjectPtr<UMovieSceneNoteChartSection> WeakSection = Cast<UMovieSceneNoteChartSection>(&SectionObject);
+		TWeakPtr<ISequencer> WeakSequencer = Sequencer;
+
+		MenuBuilder.BeginSection(NAME_None, LOCTEXT("NotesMenuSection", "Notes"));
+
+		const FCanExecuteAction CanEditGrid = FCanExecuteAction::CreateLambda([WeakSection]() { return HasTempoKeys(WeakSection); });
+		const FText NeedsTempoTooltip = LOCTEXT("GridNeedsTempoTooltip", "Add a tempo key to this track first: the grid follows the track's tempo map");
+
+		const FText SnapTooltip = LOCTEXT("SnapNotesToGridTooltip", "Move every note onto the nearest line of the section's snap grid");
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("SnapNotesToGrid", "Snap Notes to Grid"),
+			TAttribute<FText>::CreateLambda([WeakSection, SnapTooltip, NeedsTempoTooltip]() { return HasTempoKeys(WeakSection) ? SnapTooltip : NeedsTempoTooltip; }),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateLambda([WeakSection, WeakSequencer]()
+			{
+				ApplyBulkNoteEdit(WeakSection, WeakSequencer, LOCTEXT("SnapNotesToGrid_Transaction", "Snap Notes to Grid"),
+					[](UMovieSceneNoteChartSection& Section, FFrameRate TickResolution, const FTempoMap& TempoMap)
+					{
+						// Keys with an invalid BPM leave the map empty
+						return TempoMap.IsEmpty() ? 0 : Section.SnapNotesToGrid(TickResolution, TempoMap, TempoMap.GetBPM(0));
+					});
+			}), CanEditGrid)
+		);
+
+		const FText QuantizeTooltip = LOCTEXT("QuantizeNotesTooltip", "Move every note halfway towards the nearest line of the section's snap grid");
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("QuantizeNotes", "Quantize Notes (50%)"),
+			TAttribute<FText>::CreateLambda([WeakSection, QuantizeTooltip, NeedsTempoTooltip]() { return HasTempoKeys(WeakSection) ? QuantizeTooltip : NeedsTempoTooltip; }),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateLambda([WeakSection, WeakSequencer]()
+			{
+				ApplyBulkNoteEdit(WeakSection, WeakSequencer, LOCTEXT("QuantizeNotes_Transaction", "Quantize Notes"),
+					[](UMovieSceneNoteChartSection& Section, FFrameRate TickResolution, const FTempoMap& TempoMap)
+					{
+						return TempoMap.IsEmpty() ? 0 : Section.QuantizeNotes(Section.SnapGridResolution, 0.5f, TickResolution, TempoMap, TempoMap.GetBPM(0));
+					});
+			}), CanEditGrid)
+		);
+
+		MenuBuilder.AddMenuEntry(
+			LOCTEXT("MirrorNoteLanes", "Mirror Lanes"),
+			LOCTEXT("MirrorNoteLanesTooltip", "Swap the note types used in this section end for end, ordered by tag"),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateLambda([WeakSection, WeakSequencer]()
+			{
+				ApplyBulkNoteEdit(WeakSection, WeakSequencer, LOCTEXT("MirrorNoteLanes_Transaction", "Mirror Lanes"),
+					[](UMovieSceneNoteChartSection& Section, FFrameRate TickResolution, const FTempoMap& TempoMap)
+					{
+						return Section.MirrorNoteLanes();
+					});
+			}))
+		);
+
+		MenuBuilder.EndSection();
 	}
 
 private:
+	/** One bar per column of pixels, scaled to the busiest visible column */
+	int32 PaintDensityBars(FSequencerSectionPainter& Painter, int32 LayerId, TArrayView<const FFrameNumber> KeyTimes, int32 FirstKey, int32 EndKey, float MinX, float MaxX) const
+	{
+		using namespace NoteChartSectionDrawing;
+
+		const FTimeToPixel& TimeToPixel = Painter.GetTimeConverter();
+		const int32 NumColumns = FMath::CeilToInt32((MaxX - MinX) / DensityBarWidth);
+
+		TArray<int32, TInlineAllocator<512>> ColumnCounts;
+		ColumnCounts.SetNumUninitialized(NumColumns);
+
+		int32 ColumnBegin = FirstKey;
+		int32 MaxCount = 1;
+		for (int32 Column = 0; Column < NumColumns; ++Column)
+		{
+			int32 ColumnEnd = EndKey;
+			if (Column < NumColumns - 1)
+			{
+				const FFrameNumber ColumnEndFrame = TimeToPixel.PixelToFrame(MinX + (Column + 1) * DensityBarWidth).FloorToFrame();
+				ColumnEnd = ColumnBegin + Algo::UpperBound(KeyTimes.Slice(ColumnBegin, EndKey - ColumnBegin), ColumnEndFrame);
+			}
+
+			ColumnCounts[Column] = ColumnEnd - ColumnBegin;
+			MaxCount = FMath::Max(MaxCount, ColumnCounts[Column]);
+			ColumnBegin = ColumnEnd;
+		}
+
+		const FSlateBrush* BarBrush = FAppStyle::GetBrush("WhiteBrush");
+		const ESlateDrawEffect DrawEffects = Painter.bParentEnabled ? ESlateDrawEffect::None : ESlateDrawEffect::DisabledEffect;
+		const FLinearColor BarColor = DensityBarColor.CopyWithNewOpacity(DensityBarColor.A * Painter.GhostAlpha);
+		const float SectionHeight = Painter.SectionGeometry.GetLocalSize().Y;
+		const float MaxBarHeight = SectionHeight - 4.0f;
+
+		for (int32 Column = 0; Column < NumColumns; ++Column)
+		{
+			if (ColumnCounts[Column] == 0)
+			{
+				continue;
+			}
+
+			const float BarHeight = FMath::Max(1.0f, MaxBarHeight * ColumnCounts[Column] / MaxCount);
+			FSlateDrawElement::MakeBox(
+				Painter.DrawElements,
+				LayerId,
+				Painter.SectionGeometry.ToPaintGeometry(
+					FVector2D(DensityBarWidth - 1.0f, BarHeight),
+					FSlateLayoutTransform(FVector2D(MinX + Column * DensityBarWidth, SectionHeight - 2.0f - BarHeight))),
+				BarBrush,
+				DrawEffects,
+				BarColor
+			);
+		}
+
+		return LayerId + 1;
+	}
+
+	/** Icon of each visible note along the bottom of the section */
+	int32 PaintNoteIcons(FSequencerSectionPainter& Painter, int32 LayerId, const TMovieSceneChannelData<const FNoteChannelValue>& ChannelData, int32 FirstKey, int32 EndKey) const
+	{
+		using namespace NoteChartSectionDrawing;
+
+		TArrayView<const FFrameNumber> KeyTimes = ChannelData.GetTimes();
+		TArrayView<const FNoteChannelValue> KeyValues = ChannelData.GetValues();
+
+		const FTimeToPixel& TimeToPixel = Painter.GetTimeConverter();
+		const ESlateDrawEffect DrawEffects = Painter.bParentEnabled ? ESlateDrawEffect::None : ESlateDrawEffect::DisabledEffect;
+		const FLinearColor IconColor = FLinearColor::White.CopyWithNewOpacity(Painter.GhostAlpha);
+		const float IconY = Painter.SectionGeometry.GetLocalSize().Y - IconSize - 2.0f;
+
+		for (int32 KeyIndex = FirstKey; KeyIndex < EndKey; ++KeyIndex)
+		{
+			const FSlateBrush* IconBrush = KeyValues[KeyIndex].NoteData ? GetIconBrush(*KeyValues[KeyIndex].NoteData) : nullptr;
+			if (!IconBrush)
+			{
+				continue;
+			}
+
+			const float KeyX = TimeToPixel.FrameToPixel(KeyTimes[KeyIndex]);
+			FSlateDrawElement::MakeBox(
+				Painter.DrawElements,
+				LayerId,
+				Painter.SectionGeometry.ToPaintGeometry(
+					FVector2D(IconSize, IconSize),
+					FSlateLayoutTransform(FVector2D(KeyX - 0.5f * IconSize, IconY))),
+				IconBrush,
+				DrawEffects,
+				IconColor
+			);
+		}
+
+		return LayerId + 1;
+	}
+
+	/** Cached brush of a note type's icon, null if it has none */
+	const FSlateBrush* GetIconBrush(const UNoteDataAsset& NoteData) const
+	{
+		UTexture2D* IconTexture = NoteData.GetIconTexture();
+		if (!IconTexture)
+		{
+			return nullptr;
+		}
+
+		TSharedPtr<FSlateBrush>& IconBrush = IconBrushes.FindOrAdd(TObjectKey<UNoteDataAsset>(&NoteData));
+		if (!IconBrush.IsValid() || IconBrush->GetResourceObject() != IconTexture)
+		{
+			IconBrush = MakeShared<FSlateBrush>();
+			IconBrush->SetResourceObject(IconTexture);
+			IconBrush->ImageSize = FVector2D(IconSize, IconSize);
+		}
+		return IconBrush.Get();
+	}
+
+	/**
+	 * Grid edits need a tempo: the song's BPM is only known to the subsystem at runtime, so
+	 * without tempo keys on the track there is no grid to snap to
+	 */
+	static bool HasTempoKeys(TWeakObjectPtr<UMovieSceneNoteChartSection> WeakSection)
+	{
+		const UMovieSceneNoteChartSection* Section = WeakSection.Get();
+		const UMovieSceneNoteChartTrack* Track = Section ? Section->GetTypedOuter<UMovieSceneNoteChartTrack>() : nullptr;
+		return Track && Track->TempoKeys.Num() > 0;
+	}
+
+	/**
+	 * Run one bulk edit over a section as an undoable transaction
+	 * The edit returns the number of notes it changed; nothing changed cancels the transaction
+	 */
+	static void ApplyBulkNoteEdit(
+		TWeakObjectPtr<UMovieSceneNoteChartSection> WeakSection,
+		TWeakPtr<ISequencer> WeakSequencer,
+		const FText& TransactionText,
+		TFunctionRef<int32(UMovieSceneNoteChartSection&, FFrameRate, const FTempoMap&)> Edit)
+	{
+		UMovieSceneNoteChartSection* Section = WeakSection.Get();
+		TSharedPtr<ISequencer> SequencerPtr = WeakSequencer.Pin();
+		const UMovieScene* MovieScene = Section ? Section->GetTypedOuter<UMovieScene>() : nullptr;
+		if (!SequencerPtr.IsValid() || !MovieScene || MovieScene->IsReadOnly())
+		{
+			return;
+		}
+
+		const FFrameRate TickResolution = MovieScene->GetTickResolution();
+		FTempoMap TempoMap;
+		if (const UMovieSceneNoteChartTrack* Track = Section->GetTypedOuter<UMovieSceneNoteChartTrack>())
+		{
+			Track->AppendTempoKeys(TickResolution, TempoMap);
+		}
+		TempoMap.Finalize();
+
+		FScopedTransaction Transaction(TransactionText);
+		Section->Modify();
+
+		if (Edit(*Section, TickResolution, TempoMap) == 0)
+		{
+			Transaction.Cancel();
+			return;
+		}
+
+		SequencerPtr->NotifyMovieSceneDataChanged(EMovieSceneDataChangeType::TrackValueChanged);
+	}
+
 	UMovieSceneSection& SectionObject;
+
+	TWeakPtr<ISequencer> Sequencer;
+
+	/** One brush per note type, so every icon of a type shares a resource and draws in one batch */
+	mutable TMap<TObjectKey<UNoteDataAsset>, TSharedPtr<FSlateBrush>> IconBrushes;
 };
 
 // FNoteChartTrackEditor implementation
@@ -70,7 +358,7 @@ TSharedRef<ISequencerSection> FNoteChartTrackEditor::MakeSectionInterface(
 	UMovieSceneTrack& Track,
 	FGuid ObjectBinding)
 {
-	return MakeShareable(new FNoteChartSection(SectionObject));
+	return MakeShareable(new FNoteChartSection(SectionObject, GetSequencer()));
 }
 
 void FNoteChartTrackEditor::BuildAddTrackMenu(FMenuBuilder& MenuBuilder)